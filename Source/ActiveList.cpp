@@ -0,0 +1,76 @@
+#include "ActiveList.h"
+#include "Snapshot.h"
+
+void ActiveList::reset(int capacity)
+{
+	slots.clear();
+	slots.reserve(capacity);
+	positions.assign(capacity, -1);
+}
+
+void ActiveList::add(int slot)
+{
+	if (positions[slot] >= 0)
+	{
+		return;
+	}
+	positions[slot] = (int)slots.size();
+	slots.push_back(slot);
+}
+
+/**
+*   @brief   Remove
+*   @details Moves the last entry into the removed entry's place and
+			 shrinks the list by one.
+*   @return  void
+*/
+void ActiveList::remove(int slot)
+{
+	int idx = positions[slot];
+	if (idx < 0)
+	{
+		return;
+	}
+	int last = slots.back();
+	slots[idx] = last;
+	positions[last] = idx;
+	slots.pop_back();
+	positions[slot] = -1;
+}
+
+bool ActiveList::contains(int slot) const
+{
+	return positions[slot] >= 0;
+}
+
+int ActiveList::size() const
+{
+	return (int)slots.size();
+}
+
+int ActiveList::operator[](int idx) const
+{
+	return slots[idx];
+}
+
+const int* ActiveList::begin() const
+{
+	return slots.data();
+}
+
+const int* ActiveList::end() const
+{
+	return slots.data() + slots.size();
+}
+
+void ActiveList::save(Snapshot& snapshot) const
+{
+	snapshot.writeVector(slots);
+	snapshot.writeVector(positions);
+}
+
+void ActiveList::restore(SnapshotReader& reader)
+{
+	reader.readVector(slots);
+	reader.readVector(positions);
+}
@@ -0,0 +1,61 @@
+#pragma once
+#include <vector>
+
+class Snapshot;
+class SnapshotReader;
+
+/**
+*  A dense list of the live slots of a fixed size array.
+*  Slots are added and removed in constant time. Removing a slot moves
+*  the last entry into its place, so the list stays packed and walking
+*  it costs only as much as there are live slots, in no fixed order.
+*  Removing the entry being visited is safe when walking backwards.
+*/
+class ActiveList
+{
+public:
+	/**
+	*  Default constructor.
+	*/
+	ActiveList() = default;
+
+	/**
+	*  Empties the list and sizes it for an array.
+	*  @param [in] capacity The number of slots in the array
+	*/
+	void reset(int capacity);
+
+	/**
+	*  Adds a slot to the list if it is not already in it.
+	*  @param [in] slot The slot to add
+	*/
+	void add(int slot);
+
+	/**
+	*  Removes a slot from the list if it is in it.
+	*  @param [in] slot The slot to remove
+	*/
+	void remove(int slot);
+
+	/**
+	*  Appends the list to a snapshot.
+	*  @param [in] snapshot The snapshot to write to
+	*/
+	void save(Snapshot& snapshot) const;
+
+	/**
+	*  Replaces the list with the next one in a snapshot.
+	*  @param [in] reader The snapshot being read
+	*/
+	void restore(SnapshotReader& reader);
+
+	bool contains(int slot) const;
+	int  size() const;
+	int  operator[](int idx) const;
+	const int* begin() const;
+	const int* end() const;
+
+private:
+	std::vector<int> slots;
+	std::vector<int> positions;
+};
@@ -0,0 +1,236 @@
+#include <Engine\Renderer.h>
+#include <Engine\Sprite.h>
+#include "AsgeBackend.h"
+#include "DrawBuffer.h"
+#include "MemoryTracker.h"
+
+AsgeBackend::~AsgeBackend()
+{
+	freeTextures();
+}
+
+void AsgeBackend::init(ASGE::Renderer* new_renderer)
+{
+	renderer = new_renderer;
+	freeTextures();
+	static_valid = false;
+}
+
+/**
+*   @brief   Add Texture
+*   @details Returns the id of the file if it is already loaded.
+			 Otherwise loads it into the first free slot, or a new
+			 one, and accounts its pixels as texture memory.
+*   @return  int
+*/
+int AsgeBackend::addTexture(const std::string& file_name)
+{
+	int free_slot = -1;
+	for (size_t i = 0; i < texture_files.size(); i++)
+	{
+		if (textures[i] == nullptr)
+		{
+			free_slot = free_slot < 0 ? (int)i : free_slot;
+		}
+		else if (texture_files[i] == file_name)
+		{
+			return (int)i;
+		}
+	}
+
+	ASGE::Sprite* sprite = renderer->createRawSprite();
+	if (!sprite->loadTexture(file_name))
+	{
+		delete sprite;
+		return -1;
+	}
+
+	static_valid = false;
+	const float* source = sprite->srcRect();
+	size_t bytes = (size_t)source[2] * (size_t)source[3] * 4;
+	trackAllocation(MEMORY_TEXTURES, bytes);
+	if (free_slot < 0)
+	{
+		textures.push_back(sprite);
+		texture_files.push_back(file_name);
+		texture_bytes.push_back(bytes);
+		return (int)textures.size() - 1;
+	}
+
+	textures[free_slot] = sprite;
+	texture_files[free_slot] = file_name;
+	texture_bytes[free_slot] = bytes;
+	return free_slot;
+}
+
+void AsgeBackend::releaseTexture(int id)
+{
+	if (id < 0 || id >= (int)textures.size() || textures[id] == nullptr)
+	{
+		return;
+	}
+
+	static_valid = false;
+	trackRelease(MEMORY_TEXTURES, texture_bytes[id]);
+	delete textures[id];
+	textures[id] = nullptr;
+	texture_files[id].clear();
+	texture_bytes[id] = 0;
+}
+
+bool AsgeBackend::getTextureSize(int id, float& width, float& height) const
+{
+	if (id < 0 || id >= (int)textures.size() || textures[id] == nullptr)
+	{
+		return false;
+	}
+	const float* source = textures[id]->srcRect();
+	width = source[2];
+	height = source[3];
+	return true;
+}
+
+void AsgeBackend::freeTextures()
+{
+	for (size_t i = 0; i < textures.size(); i++)
+	{
+		trackRelease(MEMORY_TEXTURES, texture_bytes[i]);
+		delete textures[i];
+	}
+	textures.clear();
+	texture_files.clear();
+	texture_bytes.clear();
+}
+
+/**
+*   @brief   Draw
+*   @details Draws the static layer, if there is one, then the
+			 commands in order. ASGE has no offscreen targets, so the
+			 static layer is drawn again every frame, but from the
+			 commands placed when it was last recorded. Sprite commands
+			 are placed by the view, then applied to the backend's
+			 sprite for their texture.
+*   @return  void
+*/
+void AsgeBackend::draw(const DrawBuffer& buffer)
+{
+	if (buffer.hasClearColour())
+	{
+		renderer->setClearColour(buffer.getClearColour());
+	}
+	renderer->setFont(0);
+
+	draw_calls = 0;
+	texture_switches = 0;
+	int bound = -1;
+	const DrawBuffer* layer = buffer.getStaticLayer();
+	if (layer != nullptr)
+	{
+		if (!static_valid || static_revision != layer->getRevision() ||
+			!static_view.matches(view))
+		{
+			placeStatic(*layer);
+		}
+		for (const DrawCommand& command : static_placed)
+		{
+			drawCommand(*layer, command, bound);
+		}
+	}
+	drawCommands(buffer, bound);
+}
+
+/**
+*   @brief   Place Static
+*   @details Places the commands of the static layer through the
+			 view and drops the ones whose texture is not loaded, so
+			 frames drawing the same recording skip both.
+*   @return  void
+*/
+void AsgeBackend::placeStatic(const DrawBuffer& layer)
+{
+	static_placed.clear();
+	for (const DrawCommand& recorded : layer.getCommands())
+	{
+		DrawCommand command = view.apply(recorded);
+		if (command.type == DRAW_TEXT || (command.texture >= 0 &&
+			command.texture < (int)textures.size() && textures[command.texture] != nullptr))
+		{
+			static_placed.push_back(command);
+		}
+	}
+	static_revision = layer.getRevision();
+	static_view = view;
+	static_valid = true;
+	static_placements++;
+}
+
+/**
+*   @brief   Draw Commands
+*   @details Draws the commands of one buffer, carrying the bound
+			 texture over from the buffer drawn before it.
+*   @return  void
+*/
+void AsgeBackend::drawCommands(const DrawBuffer& buffer, int& bound)
+{
+	for (const DrawCommand& recorded : buffer.getCommands())
+	{
+		drawCommand(buffer, view.apply(recorded), bound);
+	}
+}
+
+/**
+*   @brief   Draw Command
+*   @details Draws one command already placed by the view.
+*   @return  void
+*/
+void AsgeBackend::drawCommand(const DrawBuffer& buffer, const DrawCommand& command, int& bound)
+{
+	draw_calls++;
+	if (command.type == DRAW_TEXT)
+	{
+		renderer->renderText(buffer.getText(command), (int)command.x, (int)command.y,
+			command.scale, command.colour, (float)command.layer);
+		return;
+	}
+	if (command.texture < 0 || command.texture >= (int)textures.size() ||
+		textures[command.texture] == nullptr)
+	{
+		return;
+	}
+	if (command.texture != bound)
+	{
+		bound = command.texture;
+		texture_switches++;
+	}
+
+	ASGE::Sprite* sprite = textures[command.texture];
+	float* source = sprite->srcRect();
+	for (int i = 0; i < 4; i++)
+	{
+		source[i] = command.source[i];
+	}
+	sprite->xPos(command.x);
+	sprite->yPos(command.y);
+	sprite->width(command.width);
+	sprite->height(command.height);
+	sprite->rotationInRadians(command.rotation);
+	sprite->opacity(command.opacity);
+	sprite->scale(command.scale);
+	sprite->colour(command.colour);
+	renderer->renderSprite(*sprite, (float)command.layer);
+}
+
+int AsgeBackend::drawCalls() const
+{
+	return draw_calls;
+}
+
+int AsgeBackend::textureSwitches() const
+{
+	return texture_switches;
+}
+
+int AsgeBackend::staticPlacements() const
+{
+	return static_placements;
+}
@@ -0,0 +1,102 @@
+#pragma once
+#include <string>
+#include <vector>
+#include "DrawCommand.h"
+#include "RenderBackend.h"
+
+namespace ASGE {
+	class Renderer;
+	class Sprite;
+}
+
+/**
+*  Draws recorded frames through the ASGE renderer.
+*  Every texture is registered once and gets a sprite owned by the
+*  backend. Sprite commands are drawn by applying their state to that
+*  sprite, so many commands can share one sprite. As the sprites are
+*  never the game's own, frames can be drawn while the game updates.
+*  ASGE clears the screen every frame and has no offscreen targets, so
+*  the static layer is submitted every frame. It is only placed through
+*  the view again when it is recorded again or the view changes.
+*  Counts the draws and texture switches of the last frame. The first
+*  texture counts as a switch, so the switch count is the number of
+*  batches drawn.
+*  Textures are accounted as texture memory at four bytes a pixel,
+*  the size they take once uploaded.
+*/
+class AsgeBackend : public RenderBackend
+{
+public:
+	/**
+	*  Default constructor.
+	*/
+	AsgeBackend() = default;
+
+	/**
+	*  Destructor. Frees the backend's sprites.
+	*/
+	~AsgeBackend();
+
+	/**
+	*  Sets the renderer to draw with and forgets every texture.
+	*  @param [in] renderer The renderer used to draw
+	*/
+	void init(ASGE::Renderer* renderer);
+
+	/**
+	*  Registers a texture file.
+	*  Files already registered get the same id. New files take the
+	*  id of a released texture before a new one.
+	*  @param [in] file_name The path of the texture file
+	*  @return the id used by draw commands, or -1 if it failed to load
+	*/
+	int  addTexture(const std::string& file_name);
+
+	/**
+	*  Frees a texture. Commands still using its id draw nothing
+	*  until the id is given to another texture.
+	*  @param [in] id The id given by addTexture
+	*/
+	void releaseTexture(int id);
+
+	/**
+	*  Reads the size of a registered texture.
+	*  @param [in] id The id given by addTexture
+	*  @param [out] width The width of the texture in pixels
+	*  @param [out] height The height of the texture in pixels
+	*  @return false if there is no texture with that id
+	*/
+	bool getTextureSize(int id, float& width, float& height) const;
+
+	void draw(const DrawBuffer& buffer) override;
+
+	int drawCalls() const;
+	int textureSwitches() const;
+
+	/**
+	*  @return the number of times the static layer was placed
+	*/
+	int staticPlacements() const;
+
+private:
+	void drawCommands(const DrawBuffer& buffer, int& bound);
+	void drawCommand(const DrawBuffer& buffer, const DrawCommand& command, int& bound);
+	void placeStatic(const DrawBuffer& layer);
+
+	void freeTextures();
+
+	ASGE::Renderer* renderer = nullptr;
+	std::vector<ASGE::Sprite*> textures;
+	std::vector<std::string> texture_files;
+	std::vector<size_t> texture_bytes;
+	int draw_calls = 0;
+	int texture_switches = 0;
+
+	// the static layer placed on screen, kept until it is recorded
+	// again, the view changes or a texture is added or released
+	std::vector<DrawCommand> static_placed;
+	unsigned int static_revision = 0;
+	ViewTransform static_view;
+	bool static_valid = false;
+	int static_placements = 0;
+};
@@ -0,0 +1,224 @@
+#pragma once
+#include <atomic>
+#include <memory>
+#include "Constants.h"
+#include "MemoryTracker.h"
+#include "Snapshot.h"
+
+/**
+*  Sparse set storage for one kind of component.
+*  Components are kept packed in the order they were added, so systems
+*  walk them linearly and touch nothing else. A sparse index maps an
+*  entity to its component in constant time. Removing a component
+*  moves the last one into its place.
+*  The packed components live in fixed size pages, and copying a pool
+*  shares its pages and index instead of duplicating them. A page is
+*  only copied the first time one of the pools sharing it writes to
+*  it, so a copy costs a pointer per page and grows by a page for each
+*  page it changes. Reading never copies, so call the const accessors
+*  when nothing is written. Copies can be used from different threads,
+*  but a single pool is not thread safe.
+*  Storage is counted against the pool's memory tag.
+*/
+template <class T, int Tag = MEMORY_PHYSICS>
+class ComponentPool
+{
+public:
+	/**
+	*  Default constructor.
+	*/
+	ComponentPool() = default;
+
+	/**
+	*  Gives an entity the component, leaving one it already has.
+	*  @param [in] entity The entity to add the component to
+	*  @return the entity's component
+	*/
+	T& add(int entity)
+	{
+		if (!has(entity))
+		{
+			Index& owned = writableIndex();
+			if (entity >= (int)owned.positions.size())
+			{
+				owned.positions.resize(entity + 1, -1);
+			}
+			if (count == (int)pages.size() * COMPONENT_PAGE_SIZE)
+			{
+				pages.push_back(std::allocate_shared<Page>(TaggedAllocator<Page, Tag>()));
+			}
+			owned.positions[entity] = count;
+			owned.entities.push_back(entity);
+			(*this)[count] = T();
+			count++;
+		}
+		return get(entity);
+	}
+
+	/**
+	*  Takes the component from an entity if it has one.
+	*  @param [in] entity The entity to remove the component from
+	*/
+	void remove(int entity)
+	{
+		if (!has(entity))
+		{
+			return;
+		}
+		Index& owned = writableIndex();
+		int idx = owned.positions[entity];
+		int last = owned.entities.back();
+		if (idx != count - 1)
+		{
+			(*this)[idx] = component(count - 1);
+		}
+		owned.entities[idx] = last;
+		owned.positions[last] = idx;
+		owned.entities.pop_back();
+		owned.positions[entity] = -1;
+		count--;
+	}
+
+	bool has(int entity) const
+	{
+		return index && entity >= 0 && entity < (int)index->positions.size() &&
+			index->positions[entity] >= 0;
+	}
+
+	T& get(int entity)
+	{
+		return (*this)[index->positions[entity]];
+	}
+
+	const T& get(int entity) const
+	{
+		return component(index->positions[entity]);
+	}
+
+	/**
+	*  Appends the pool to a snapshot.
+	*  @param [in] snapshot The snapshot to write to
+	*/
+	void save(Snapshot& snapshot) const
+	{
+		snapshot.write(count);
+		for (int first = 0; first < count; first += COMPONENT_PAGE_SIZE)
+		{
+			int length = count - first < COMPONENT_PAGE_SIZE ? count - first : COMPONENT_PAGE_SIZE;
+			snapshot.writeArray(pages[first / COMPONENT_PAGE_SIZE]->items, length);
+		}
+		const Index empty;
+		const Index& saved = index ? *index : empty;
+		snapshot.writeVector(saved.entities);
+		snapshot.writeVector(saved.positions);
+	}
+
+	/**
+	*  Replaces the pool with the next one in a snapshot.
+	*  Pages shared with other pools are copied before being written.
+	*  @param [in] reader The snapshot being read
+	*/
+	void restore(SnapshotReader& reader)
+	{
+		int saved = 0;
+		reader.read(saved);
+		count = 0;
+		while (count < saved && reader.good())
+		{
+			int length = saved - count < COMPONENT_PAGE_SIZE ? saved - count : COMPONENT_PAGE_SIZE;
+			if (count == (int)pages.size() * COMPONENT_PAGE_SIZE)
+			{
+				pages.push_back(std::allocate_shared<Page>(TaggedAllocator<Page, Tag>()));
+			}
+			reader.readArray(writablePage(count / COMPONENT_PAGE_SIZE).items, length);
+			count += length;
+		}
+		Index& owned = writableIndex();
+		reader.readVector(owned.entities);
+		reader.readVector(owned.positions);
+	}
+
+	/**
+	*  @return the number of entities with the component
+	*/
+	int size() const
+	{
+		return count;
+	}
+
+	/**
+	*  @param [in] idx The position in the packed array
+	*  @return the entity owning the component at that position
+	*/
+	int entity(int idx) const
+	{
+		return index->entities[idx];
+	}
+
+	/**
+	*  Writable access, copying the component's page first if it is
+	*  shared with another pool.
+	*/
+	T& operator[](int idx)
+	{
+		return writablePage(idx / COMPONENT_PAGE_SIZE).items[idx % COMPONENT_PAGE_SIZE];
+	}
+
+	const T& operator[](int idx) const
+	{
+		return component(idx);
+	}
+
+private:
+	struct Page
+	{
+		T items[COMPONENT_PAGE_SIZE];
+	};
+
+	struct Index
+	{
+		TaggedVector<int, Tag> entities;
+		TaggedVector<int, Tag> positions;
+	};
+
+	const T& component(int idx) const
+	{
+		return pages[idx / COMPONENT_PAGE_SIZE]->items[idx % COMPONENT_PAGE_SIZE];
+	}
+
+	Page& writablePage(int page)
+	{
+		std::shared_ptr<Page>& shared = pages[page];
+		if (shared.use_count() != 1)
+		{
+			shared = std::allocate_shared<Page>(TaggedAllocator<Page, Tag>(), *shared);
+		}
+		else
+		{
+			// pairs with the release of the last other pool that held it
+			std::atomic_thread_fence(std::memory_order_acquire);
+		}
+		return *shared;
+	}
+
+	Index& writableIndex()
+	{
+		if (!index)
+		{
+			index = std::allocate_shared<Index>(TaggedAllocator<Index, Tag>());
+		}
+		else if (index.use_count() != 1)
+		{
+			index = std::allocate_shared<Index>(TaggedAllocator<Index, Tag>(), *index);
+		}
+		else
+		{
+			std::atomic_thread_fence(std::memory_order_acquire);
+		}
+		return *index;
+	}
+
+	TaggedVector<std::shared_ptr<Page>, Tag> pages;
+	std::shared_ptr<Index> index;
+	int count = 0;
+};
@@ -0,0 +1,88 @@
+#pragma once
+#include "Constants.h"
+
+/*! \file Components.h
+@brief   The components entities in the world are built from.
+@details Components are plain data without pointers, so they can be
+		 stored packed and copied freely. Behaviour lives in the
+		 systems that walk them.
+*/
+
+/**
+*  Where an entity is and how big it is, in world units.
+*/
+struct Transform
+{
+	float x = 0;
+	float y = 0;
+	float width = 0;
+	float height = 0;
+	float rotation = 0;
+	float scale = 1;
+};
+
+/**
+*  How fast an entity moves.
+*  The integrate system moves it speed_scale world units a second per
+*  unit of velocity and pulls it down by gravity. Bodies without a
+*  speed scale are moved by other means, such as a solved flight path.
+*/
+struct Velocity
+{
+	float x = 0;
+	float y = 0;
+	float speed_scale = 0;
+	float gravity = 0;
+};
+
+/**
+*  A short lived body kept outside the world, such as a bomb.
+*  @see EffectPool
+*/
+struct EffectBody
+{
+	Transform transform;
+	Velocity velocity;
+};
+
+/**
+*  Makes an entity something projectiles and debris can hit.
+*  What a hit does follows from the entity's other components. Bodies
+*  with a material break, bodies with health but no material are
+*  knocked out, and bodies with neither are solid ground.
+*/
+struct Collider
+{
+};
+
+/**
+*  How an entity is drawn.
+*  The texture is the id given by the render backend and the source
+*  rectangle is in texture pixels. Fixed sprites only change between
+*  levels, so they are drawn into the static layer.
+*/
+struct Sprite
+{
+	int texture = -1;
+	float source[4]{ 0, 0, 0, 0 };
+	float colour[3]{ 1, 1, 1 };
+	float opacity = 1;
+	int layer = 0;
+	bool fixed = false;
+};
+
+/**
+*  What a breakable body is made of.
+*/
+struct Material
+{
+	int type = MATERIAL_GLASS;
+};
+
+/**
+*  How much blast damage an entity can still take.
+*/
+struct Health
+{
+	float value = 1.f;
+};
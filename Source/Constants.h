@@ -5,6 +5,10 @@
 @details Add any new constants to this file.
 */
 
+/**< The size of the world, in the fixed units the game is simulated in. */
+constexpr float WORLD_WIDTH = 1920.f;
+constexpr float WORLD_HEIGHT = 1080.f;
+
 /**< The window width. Defines how wide the game window is. */
 constexpr float GAMEPLAY_AREA_WIDTH = 1.2f;
 /**< The window height. Defines the height of the gameplay area */
@@ -15,19 +19,105 @@ constexpr float PI = 3.14159265f;
 /**< Value of the amount of energy left after a collision. */
 constexpr float RESTITUTION = 0.8f;
 
+/**< Defines the flight model used for projectiles. */
+constexpr float FLIGHT_SPEED_SCALE = 5.f;
+constexpr float FLIGHT_GRAVITY = 8.f;
+constexpr float FLIGHT_DRAG = 0.05f;
+
 /**< Defines the size of a single projectile sprite. */
 constexpr float PROJECTILE_SIZE = 0.03f;
 constexpr float BOMB_SIZE = 0.01f;
 
 /**< Defines the maximum number of game objects for arrays. */
 constexpr int NUM_PROJECTILES_SCATTER = 2;
+constexpr int MAX_SUB_PROJECTILES = 64;
+constexpr int MAX_BOMBS = 2;
 constexpr int NUM_PROJECTILES = 5;
 constexpr int NUM_ENEMIES = 6;
 constexpr int NUM_BLOCKS = 41;
 constexpr int NUM_LEVELS = 3;
 constexpr int NUM_PLATFORMS = 10;
 constexpr int GRID_SIZE = 150;
+constexpr int MAX_EXPLOSIONS = 32;
+
+/**< Defines where each material starts in the blocks array. */
+constexpr int FIRST_WOOD_BLOCK = 10;
+constexpr int FIRST_STONE_BLOCK = 30;
+constexpr int FIRST_EXPLOSIVE_BLOCK = 40;
+
+/**< Defines how much blast damage each object can take. */
+constexpr float HEALTH_GLASS = 0.2f;
+constexpr float HEALTH_WOOD = 0.45f;
+constexpr float HEALTH_STONE = 0.7f;
+constexpr float HEALTH_EXPLOSIVE = 0.1f;
+constexpr float HEALTH_ENEMY = 0.3f;
+
+/**< Defines the blasts, radii are multiples of the exploding object's size. */
+constexpr float BOMB_BLAST_RADIUS = 4.5f;
+constexpr float EXPLOSIVE_BLAST_RADIUS = 2.5f;
+constexpr float EXPLOSION_IMPULSE = 1.f;
+constexpr float EXPLOSION_PUSH = 20.f;
+
+/**< Defines how broken blocks fall apart into debris. */
+constexpr int MAX_DEBRIS = 96;
+constexpr int DEBRIS_SPAWN_BUDGET = 32;
+constexpr int DEBRIS_MAX_PIECES = 8;
+constexpr float DEBRIS_LIFETIME = 2.5f;
+constexpr float DEBRIS_FADE = 0.5f;
+constexpr float DEBRIS_INHERIT = 0.5f;
+constexpr float DEBRIS_SCATTER = 6.f;
+constexpr float DEBRIS_SPIN = 6.f;
+constexpr float DEBRIS_RESTITUTION = 0.3f;
+
+/**< Defines the reach of the wind ability, in bird widths. */
+constexpr float WIND_REACH = 4.f;
+
+
+/**< Defines how many components share a page, the unit a forked world copies when it writes. */
+constexpr int COMPONENT_PAGE_SIZE = 16;
+
+/**< Defines the jobs that can be queued at once, the dependants reserved for each and the most pieces a parallel loop is cut into. */
+constexpr int JOB_CAPACITY = 1024;
+constexpr int JOB_CONTINUATIONS = 4;
+constexpr int JOB_MAX_SPLIT = 64;
+
+/**< Defines how shots are forecast: the candidates flown by each job, the tick, the longest flight in ticks and the speed lost to each block. */
+constexpr int FORECAST_GRAIN = 4;
+constexpr float FORECAST_STEP = 1.f / 60.f;
+constexpr int FORECAST_MAX_TICKS = 600;
+constexpr float FORECAST_BLOCK_SLOWDOWN = 0.1f;
 
+/**< Defines the snapshot check: the gap the bird starts from its block, its launch speed and the ticks replayed. */
+constexpr float SNAPSHOT_CHECK_LEAD = 20.f;
+constexpr float SNAPSHOT_CHECK_SPEED = 120.f;
+constexpr int SNAPSHOT_CHECK_TICKS = 120;
+
+/**< Defines the memory set aside for each level, and the buffers its map is read through. */
+constexpr int LEVEL_ARENA_SIZE = 16 * 1024;
+constexpr int LEVEL_FILE_BUFFER = 512;
+constexpr int LEVEL_LINE_LENGTH = 64;
+
+/**< Defines the longest line of the debug overlay. */
+constexpr int STATS_LINE_LENGTH = 64;
+
+/**< Defines the most memory each subsystem may hold at once, in bytes. */
+constexpr int MEMORY_BUDGET_TEXTURES = 32 * 1024 * 1024;
+constexpr int MEMORY_BUDGET_SPRITES = 256 * 1024;
+constexpr int MEMORY_BUDGET_LEVELS = 64 * 1024;
+constexpr int MEMORY_BUDGET_UI = 64 * 1024;
+constexpr int MEMORY_BUDGET_PHYSICS = 256 * 1024;
+
+/**< Defines the frame rate each screen is paced to, 0 leaves it uncapped. */
+constexpr int FRAME_RATE_IN_GAME = 0;
+constexpr int FRAME_RATE_SPLASH = 60;
+constexpr int FRAME_RATE_MENU = 30;
+/**< Defines how long before a frame is due the pacer stops sleeping and spins, in microseconds. */
+constexpr int PACER_SPIN_US = 2000;
+
+/**< Defines how pigs and bombs fall, in world units a second per unit of velocity. */
+constexpr float ENEMY_FALL_SCALE = 50.f;
+constexpr float ENEMY_GRAVITY = 20.f;
+constexpr float BOMB_FALL_SCALE = 5.f;
 
 /**< Defines the maximum number of High scores. */
 constexpr int NUM_HIGH_SCORES = 10;
@@ -55,5 +145,31 @@ constexpr float SLINGSHOT_WIDTH = 0.04;
 enum {	SPLASH_SCREEN, MAIN_SCREEN, HIGH_SCORES_SCREEN,
 	GAME_OVER_SCREEN, NEW_HIGH_SCORE, IN_GAME};
 
+// defines the draw layers used in game, higher layers are drawn in front
+enum { LAYER_BACKGROUND, LAYER_LEVEL, LAYER_ENEMIES, LAYER_DEBRIS,
+	LAYER_PROJECTILES, LAYER_SLINGSHOT, LAYER_TEXT };
+
+// defines the text cache slot of each string drawn on screen
+enum { TEXT_TITLE, TEXT_PLAY, TEXT_HIGH_SCORES_OPTION, TEXT_QUIT,
+	TEXT_SCORE_LABEL, TEXT_SCORE, TEXT_ENEMIES_LEFT, TEXT_GAME_OVER,
+	TEXT_FINAL_SCORE_LABEL, TEXT_HIGH_SCORES_TITLE, TEXT_HIGH_SCORES_RETURN,
+	TEXT_NEW_HIGH_SCORE, TEXT_NEW_HIGH_SCORE_HELP,
+	TEXT_DRAW_STATS, TEXT_BOMB_STATS, TEXT_SCATTER_STATS,
+	TEXT_INITIALS, TEXT_HIGH_SCORE_VALUES = TEXT_INITIALS + 10,
+	NUM_TEXT_SLOTS = TEXT_HIGH_SCORE_VALUES + 10 };
+
+// defines what a hit on a collider does
+enum { HIT_SOLID, HIT_BREAK, HIT_KNOCK_OUT };
+
+// defines what blocks are made of
+enum { MATERIAL_GLASS, MATERIAL_WOOD, MATERIAL_STONE, MATERIAL_EXPLOSIVE };
+
+// defines the subsystems memory is accounted to
+enum { MEMORY_TEXTURES, MEMORY_SPRITES, MEMORY_LEVELS, MEMORY_UI, MEMORY_PHYSICS,
+	NUM_MEMORY_TAGS };
+
+// defines what a full effect pool does with a new effect
+enum { POOL_REJECT, POOL_RECYCLE_OLDEST };
+
 // defines main menu options
 enum { ONE_PLAYER, HIGH_SCORES, EXIT_GAME };
\ No newline at end of file
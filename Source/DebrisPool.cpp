@@ -0,0 +1,269 @@
+#include "DebrisPool.h"
+#include "DrawBuffer.h"
+#include "Random.h"
+#include "Snapshot.h"
+#include "Trajectory.h"
+
+/**
+*   @brief   Spawn
+*   @details Takes the next slot in ring order. Every fragment lives
+			 for the same time, so this slot is either free or holds
+			 the oldest fragment, which is recycled.
+*   @return  int
+*/
+int DebrisPool::spawn()
+{
+	int idx = next;
+	next = (next + 1) % MAX_DEBRIS;
+	if (!fragments[idx].live)
+	{
+		count++;
+	}
+	fragments[idx].live = true;
+	fragments[idx].age = 0.f;
+	return idx;
+}
+
+/**
+*   @brief   Shatter
+*   @details Splits the bounds and the source region into the same
+			 grid, two rows deep for even counts and laid out along
+			 the longest side of the sprite.
+*   @return  int
+*/
+int DebrisPool::shatter(int texture, const float source[4], const rect& bounds,
+	vector2 velocity, int pieces, Random& random)
+{
+	pieces = pieces > DEBRIS_MAX_PIECES ? DEBRIS_MAX_PIECES : pieces;
+	pieces = pieces > spawn_budget ? spawn_budget : pieces;
+	if (pieces < 2)
+	{
+		return 0;
+	}
+	spawn_budget -= pieces;
+
+	int across = (pieces >= 4 && pieces % 2 == 0) ? pieces / 2 : pieces;
+	int down = pieces / across;
+	if (bounds.height > bounds.length)
+	{
+		int swap = across;
+		across = down;
+		down = swap;
+	}
+
+	float centre_x = bounds.x + bounds.length * 0.5f;
+	float centre_y = bounds.y + bounds.height * 0.5f;
+	float size = bounds.length > bounds.height ? bounds.length : bounds.height;
+	for (int row = 0; row < down; row++)
+	{
+		for (int column = 0; column < across; column++)
+		{
+			Fragment& fragment = fragments[spawn()];
+			fragment.texture = texture;
+			fragment.source[0] = source[0] + (source[2] * column) / across;
+			fragment.source[1] = source[1] + (source[3] * row) / down;
+			fragment.source[2] = source[2] / across;
+			fragment.source[3] = source[3] / down;
+			fragment.width = bounds.length / across;
+			fragment.height = bounds.height / down;
+			fragment.x = bounds.x + fragment.width * column;
+			fragment.y = bounds.y + fragment.height * row;
+
+			// push outwards from the centre with a little jitter
+			float offset_x = (fragment.x + fragment.width * 0.5f - centre_x) / size;
+			float offset_y = (fragment.y + fragment.height * 0.5f - centre_y) / size;
+			float jitter = (random.below(100) / 100.f) - 0.5f;
+			fragment.vel_x = velocity.getX() * DEBRIS_INHERIT +
+				(offset_x + jitter) * DEBRIS_SCATTER;
+			fragment.vel_y = velocity.getY() * DEBRIS_INHERIT +
+				(offset_y - jitter) * DEBRIS_SCATTER;
+			fragment.rotation = 0.f;
+			fragment.spin = jitter * DEBRIS_SPIN;
+		}
+	}
+	return pieces;
+}
+
+/**
+*   @brief   Update
+*   @details Applies the shared flight model step to every live
+			 fragment. Cost is bounded by the size of the pool.
+*   @return  void
+*/
+void DebrisPool::update(float dt)
+{
+	spawn_budget = DEBRIS_SPAWN_BUDGET;
+	if (count == 0)
+	{
+		return;
+	}
+
+#ifdef DETERMINISTIC_PHYSICS
+	FixedFlightStep step(dt);
+#else
+	vector2 a, b, c, e;
+	Trajectory::stepCoefficients(dt, a, b, c, e);
+#endif
+	for (Fragment& fragment : fragments)
+	{
+		if (!fragment.live)
+		{
+			continue;
+		}
+
+		fragment.age += dt;
+		if (fragment.age >= DEBRIS_LIFETIME)
+		{
+			fragment.live = false;
+			count--;
+			continue;
+		}
+
+#ifdef DETERMINISTIC_PHYSICS
+		step.apply(fragment.x, fragment.y, fragment.vel_x, fragment.vel_y);
+#else
+		fragment.x += a.getX() * fragment.vel_x + b.getX();
+		fragment.y += a.getY() * fragment.vel_y + b.getY();
+		fragment.vel_x = e.getX() * fragment.vel_x + c.getX();
+		fragment.vel_y = e.getY() * fragment.vel_y + c.getY();
+#endif
+		fragment.rotation += fragment.spin * dt;
+	}
+}
+
+/**
+*   @brief   Bounce
+*   @details Resolves the overlap along the shallowest axis. Landing
+			 on top of a solid also applies friction and damps the spin
+			 so debris settles instead of sliding forever.
+*   @return  void
+*/
+void DebrisPool::bounce(int idx, const rect& solid, float restitution)
+{
+	Fragment& fragment = fragments[idx];
+	float push_left = (fragment.x + fragment.width) - solid.x;
+	float push_right = (solid.x + solid.length) - fragment.x;
+	float push_up = (fragment.y + fragment.height) - solid.y;
+	float push_down = (solid.y + solid.height) - fragment.y;
+	float push_x = push_left < push_right ? -push_left : push_right;
+	float push_y = push_up < push_down ? -push_up : push_down;
+
+	if ((push_x < 0.f ? -push_x : push_x) < (push_y < 0.f ? -push_y : push_y))
+	{
+		fragment.x += push_x;
+		fragment.vel_x = -fragment.vel_x * restitution;
+	}
+	else
+	{
+		fragment.y += push_y;
+		if (push_y < 0.f && fragment.vel_y > 0.f)
+		{
+			fragment.vel_x *= restitution;
+			fragment.spin *= restitution;
+		}
+		fragment.vel_y = -fragment.vel_y * restitution;
+	}
+}
+
+/**
+*   @brief   Cull
+*   @details Removes fragments that have left the area.
+*   @return  void
+*/
+void DebrisPool::cull(const rect& area)
+{
+	for (Fragment& fragment : fragments)
+	{
+		if (fragment.live &&
+			(fragment.x + fragment.width < area.x || fragment.x > area.x + area.length ||
+			fragment.y > area.y + area.height))
+		{
+			fragment.live = false;
+			count--;
+		}
+	}
+}
+
+/**
+*   @brief   Render
+*   @details Records each fragment as a draw of the texture it was
+			 broken from, fading it out over the end of its life.
+*   @return  void
+*/
+void DebrisPool::render(DrawBuffer& buffer, int layer) const
+{
+	for (const Fragment& fragment : fragments)
+	{
+		if (!fragment.live)
+		{
+			continue;
+		}
+
+		float remaining = DEBRIS_LIFETIME - fragment.age;
+		DrawCommand command;
+		command.layer = layer;
+		command.texture = fragment.texture;
+		command.x = fragment.x;
+		command.y = fragment.y;
+		command.width = fragment.width;
+		command.height = fragment.height;
+		command.rotation = fragment.rotation;
+		command.opacity = remaining < DEBRIS_FADE ? remaining / DEBRIS_FADE : 1.f;
+		for (int i = 0; i < 4; i++)
+		{
+			command.source[i] = fragment.source[i];
+		}
+		buffer.record(command);
+	}
+}
+
+void DebrisPool::clear()
+{
+	for (Fragment& fragment : fragments)
+	{
+		fragment.live = false;
+	}
+	next = 0;
+	count = 0;
+}
+
+void DebrisPool::save(Snapshot& snapshot) const
+{
+	snapshot.writeArray(fragments, MAX_DEBRIS);
+	snapshot.write(next);
+	snapshot.write(count);
+	snapshot.write(spawn_budget);
+}
+
+void DebrisPool::restore(SnapshotReader& reader)
+{
+	reader.readArray(fragments, MAX_DEBRIS);
+	reader.read(next);
+	reader.read(count);
+	reader.read(spawn_budget);
+}
+
+bool DebrisPool::isLive(int idx) const
+{
+	return fragments[idx].live;
+}
+
+rect DebrisPool::getBoundingBox(int idx) const
+{
+	rect bounding_box;
+	bounding_box.x = fragments[idx].x;
+	bounding_box.y = fragments[idx].y;
+	bounding_box.length = fragments[idx].width;
+	bounding_box.height = fragments[idx].height;
+	return bounding_box;
+}
+
+int DebrisPool::capacity() const
+{
+	return MAX_DEBRIS;
+}
+
+int DebrisPool::size() const
+{
+	return count;
+}
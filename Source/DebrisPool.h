@@ -0,0 +1,120 @@
+#pragma once
+#include "Rect.h"
+#include "Vector2.h"
+#include "Constants.h"
+
+class Random;
+
+class DrawBuffer;
+class Snapshot;
+class SnapshotReader;
+
+/**
+*  A piece of a broken block.
+*  Fragments draw a sub region of the texture belonging to the
+*  sprite they were broken from.
+*/
+struct Fragment
+{
+	int   texture = -1;
+	float source[4]{ 0, 0, 0, 0 };
+	float x = 0;
+	float y = 0;
+	float width = 0;
+	float height = 0;
+	float vel_x = 0;
+	float vel_y = 0;
+	float rotation = 0;
+	float spin = 0;
+	float age = 0;
+	bool  live = false;
+};
+
+/**
+*  Fixed size pool of debris fragments.
+*  Storage is allocated once and never grows. Fragments are handed out
+*  in ring order, so when the pool is full the least recently spawned
+*  fragment is recycled. The number of fragments spawned per frame is
+*  also capped, which keeps the cost of a collapsing tower bounded.
+*  Debris does not collide with itself, only with the level.
+*/
+class DebrisPool
+{
+public:
+	/**
+	*  Default constructor.
+	*/
+	DebrisPool() = default;
+
+	/**
+	*  Breaks a sprite into a grid of fragments.
+	*  Each fragment inherits the velocity and is pushed away from the
+	*  centre of the original bounds. Fewer pieces are spawned if the
+	*  per frame budget is running out.
+	*  @param [in] texture The texture id the fragments draw
+	*  @param [in] source The region of the texture the sprite drew
+	*  @param [in] bounds The area the sprite covered
+	*  @param [in] velocity The velocity inherited by every fragment
+	*  @param [in] pieces The number of fragments, between 2 and 8
+	*  @param [in,out] random The generator the jitter is drawn from
+	*  @return the number of fragments spawned
+	*/
+	int  shatter(int texture, const float source[4], const rect& bounds,
+		vector2 velocity, int pieces, Random& random);
+
+	/**
+	*  Moves every fragment along the flight model and ages it.
+	*  Fragments are removed once they reach the end of their life.
+	*  Also resets the spawn budget for the next frame.
+	*  @param [in] dt The time step in seconds
+	*/
+	void update(float dt);
+
+	/**
+	*  Pushes a fragment out of a solid rectangle and reflects its
+	*  velocity, scaled by the restitution.
+	*  @param [in] idx The fragment to resolve
+	*  @param [in] solid The rectangle it is overlapping
+	*  @param [in] restitution The energy kept after the bounce
+	*/
+	void bounce(int idx, const rect& solid, float restitution);
+
+	/**
+	*  Removes every fragment that has left the area.
+	*  @param [in] area The area fragments must stay inside
+	*/
+	void cull(const rect& area);
+
+	/**
+	*  Records every fragment as a draw of the texture it came from.
+	*  @param [in] buffer The buffer to record into
+	*  @param [in] layer The layer to draw the fragments on
+	*/
+	void render(DrawBuffer& buffer, int layer) const;
+
+	/**
+	*  Appends the fragments to a snapshot.
+	*  @param [in] snapshot The snapshot to write to
+	*/
+	void save(Snapshot& snapshot) const;
+
+	/**
+	*  Replaces the fragments with the next one in a snapshot.
+	*  @param [in] reader The snapshot being read
+	*/
+	void restore(SnapshotReader& reader);
+
+	void clear();
+	bool isLive(int idx) const;
+	rect getBoundingBox(int idx) const;
+	int  capacity() const;
+	int  size() const;
+
+private:
+	int  spawn();
+
+	Fragment fragments[MAX_DEBRIS];
+	int next = 0;
+	int count = 0;
+	int spawn_budget = DEBRIS_SPAWN_BUDGET;
+};
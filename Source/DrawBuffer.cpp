@@ -0,0 +1,185 @@
+#include <algorithm>
+#include <atomic>
+#include <string.h>
+#include "DrawBuffer.h"
+#include "Components.h"
+
+namespace
+{
+	std::atomic<unsigned int> next_revision{ 1 };
+}
+
+void DrawBuffer::begin()
+{
+	revision = next_revision++;
+	commands.clear();
+	text_runs.clear();
+	glyph_runs.clear();
+	clear_colour_set = false;
+	static_layer = nullptr;
+}
+
+/**
+*   @brief   Sprite
+*   @details Copies the transform and sprite into a new command.
+*   @return  DrawCommand&
+*/
+DrawCommand& DrawBuffer::sprite(const Transform& transform, const Sprite& sprite, int layer)
+{
+	DrawCommand command;
+	command.type = DRAW_SPRITE;
+	command.layer = layer;
+	command.texture = sprite.texture;
+	command.x = transform.x;
+	command.y = transform.y;
+	command.width = transform.width;
+	command.height = transform.height;
+	command.rotation = transform.rotation;
+	command.opacity = sprite.opacity;
+	command.scale = transform.scale;
+	for (int i = 0; i < 4; i++)
+	{
+		command.source[i] = sprite.source[i];
+	}
+	for (int i = 0; i < 3; i++)
+	{
+		command.colour[i] = sprite.colour[i];
+	}
+	record(command);
+	return commands.back();
+}
+
+void DrawBuffer::record(const DrawCommand& command)
+{
+	commands.push_back(command);
+	commands.back().sequence = (int)commands.size() - 1;
+}
+
+/**
+*   @brief   Text
+*   @details Appends the characters, null terminated, and the glyphs
+			 of the layout to the buffer's text store and records
+			 where they start.
+*   @return  void
+*/
+void DrawBuffer::text(const TextLayout& layout, float x, float y, float scale,
+	const float colour[3], int layer)
+{
+	const TaggedString<MEMORY_UI>& characters = layout.getText();
+	const TaggedVector<Glyph, MEMORY_UI>& glyphs = layout.getGlyphs();
+
+	DrawCommand command;
+	command.type = DRAW_TEXT;
+	command.layer = layer;
+	command.x = x;
+	command.y = y;
+	command.width = (float)layout.getColumns();
+	command.height = (float)layout.getLines();
+	command.scale = scale;
+	command.colour[0] = colour[0];
+	command.colour[1] = colour[1];
+	command.colour[2] = colour[2];
+	command.text_offset = (int)text_runs.size();
+	command.text_length = (int)characters.size();
+	command.glyph_offset = (int)glyph_runs.size();
+	command.glyph_count = (int)glyphs.size();
+	text_runs.insert(text_runs.end(), characters.begin(), characters.end());
+	text_runs.push_back('\0');
+	glyph_runs.insert(glyph_runs.end(), glyphs.begin(), glyphs.end());
+	record(command);
+}
+
+void DrawBuffer::clearColour(const float colour[3])
+{
+	for (int i = 0; i < 3; i++)
+	{
+		clear_colour[i] = colour[i];
+	}
+	clear_colour_set = true;
+}
+
+void DrawBuffer::setStaticLayer(const DrawBuffer* layer)
+{
+	static_layer = layer;
+}
+
+void DrawBuffer::sort()
+{
+	std::sort(commands.begin(), commands.end(),
+		[](const DrawCommand& lhs, const DrawCommand& rhs)
+	{
+		if (lhs.layer != rhs.layer)
+		{
+			return lhs.layer < rhs.layer;
+		}
+		if (lhs.texture != rhs.texture)
+		{
+			return lhs.texture < rhs.texture;
+		}
+		return lhs.sequence < rhs.sequence;
+	});
+}
+
+/**
+*   @brief   Matches
+*   @details Commands are plain data, so the buffers are compared
+			 byte for byte.
+*   @return  bool
+*/
+bool DrawBuffer::matches(const DrawBuffer& other) const
+{
+	if (commands.size() != other.commands.size() ||
+		text_runs != other.text_runs ||
+		clear_colour_set != other.clear_colour_set ||
+		(static_layer == nullptr) != (other.static_layer == nullptr))
+	{
+		return false;
+	}
+	if (static_layer != nullptr && !static_layer->matches(*other.static_layer))
+	{
+		return false;
+	}
+	if (clear_colour_set &&
+		memcmp(clear_colour, other.clear_colour, sizeof(clear_colour)) != 0)
+	{
+		return false;
+	}
+	return commands.empty() ||
+		memcmp(commands.data(), other.commands.data(),
+			commands.size() * sizeof(DrawCommand)) == 0;
+}
+
+const TaggedVector<DrawCommand, MEMORY_SPRITES>& DrawBuffer::getCommands() const
+{
+	return commands;
+}
+
+const char* DrawBuffer::getText(const DrawCommand& command) const
+{
+	return &text_runs[command.text_offset];
+}
+
+const Glyph* DrawBuffer::getGlyphs(const DrawCommand& command) const
+{
+	return glyph_runs.data() + command.glyph_offset;
+}
+
+bool DrawBuffer::hasClearColour() const
+{
+	return clear_colour_set;
+}
+
+const float* DrawBuffer::getClearColour() const
+{
+	return clear_colour;
+}
+
+const DrawBuffer* DrawBuffer::getStaticLayer() const
+{
+	return static_layer;
+}
+
+unsigned int DrawBuffer::getRevision() const
+{
+	return revision;
+}
@@ -0,0 +1,117 @@
+#pragma once
+#include <string>
+#include <vector>
+#include "DrawCommand.h"
+#include "TextLayout.h"
+
+struct Transform;
+struct Sprite;
+
+/**
+*  Records the draws that make up a frame.
+*  Frame building only writes commands into the buffer and never talks
+*  to the renderer, so a finished buffer can be handed to any backend.
+*  Sorting orders the commands by layer first, so the z order is
+*  explicit, then by texture so consecutive draws share a texture and
+*  can be batched. Submission order is kept for commands on the same
+*  layer and texture.
+*  @see RenderBackend
+*/
+class DrawBuffer
+{
+public:
+	/**
+	*  Default constructor.
+	*/
+	DrawBuffer() = default;
+
+	/**
+	*  Empties the buffer for a new frame and gives it a new revision.
+	*/
+	void begin();
+
+	/**
+	*  Records a sprite as it currently is.
+	*  The returned command can be changed to stamp the same sprite at
+	*  another position, size or source rectangle. It is only valid
+	*  until the next command is recorded.
+	*  @param [in] transform Where the sprite is drawn
+	*  @param [in] sprite How the sprite is drawn
+	*  @param [in] layer The layer to draw it on, higher is in front
+	*  @return the recorded command
+	*/
+	DrawCommand& sprite(const Transform& transform, const Sprite& sprite, int layer);
+
+	/**
+	*  Records a command filled in by the caller.
+	*  @param [in] command The command to record
+	*/
+	void record(const DrawCommand& command);
+
+	/**
+	*  Records a run of shaped text.
+	*  The characters and glyphs are copied into the buffer, so the
+	*  layout can change once the call returns. Nothing is shaped or
+	*  allocated once the buffer has grown to fit a frame.
+	*  @param [in] layout The shaped text to draw
+	*  @param [in] x The position of the text on the x axis
+	*  @param [in] y The position of the baseline of the first line
+	*  @param [in] scale The scale of the font
+	*  @param [in] colour The colour of the text
+	*  @param [in] layer The layer to draw it on, higher is in front
+	*/
+	void text(const TextLayout& layout, float x, float y, float scale,
+		const float colour[3], int layer);
+
+	/**
+	*  Sets the colour the frame is cleared to. When no colour is set
+	*  the backend keeps the one from the previous frame.
+	*/
+	void clearColour(const float colour[3]);
+
+	/**
+	*  Sets a buffer holding the parts of the frame that do not move.
+	*  It is drawn under every command of this buffer, and backends
+	*  that can render offscreen keep it composited until its commands
+	*  change. It should only be recorded again when it changes, as
+	*  backends keep work keyed on its revision. Cleared by begin.
+	*  @param [in] layer The sorted static layer, which must outlive
+	*  the draw of this buffer
+	*/
+	void setStaticLayer(const DrawBuffer* layer);
+
+	/**
+	*  Sorts the commands by layer, texture and submission order.
+	*/
+	void sort();
+
+	/**
+	*  Compares the recorded frame with another buffer.
+	*  @return true if both buffers would draw the same frame
+	*/
+	bool matches(const DrawBuffer& other) const;
+
+	const TaggedVector<DrawCommand, MEMORY_SPRITES>& getCommands() const;
+	const char* getText(const DrawCommand& command) const;
+	const Glyph* getGlyphs(const DrawCommand& command) const;
+	bool hasClearColour() const;
+	const float* getClearColour() const;
+	const DrawBuffer* getStaticLayer() const;
+
+	/**
+	*  Identifies the recording since the last begin. A buffer that is
+	*  kept and drawn again without being recorded keeps its revision,
+	*  so backends can key what they keep of it on the revision.
+	*  @return the revision, 0 if the buffer was never begun
+	*/
+	unsigned int getRevision() const;
+
+private:
+	TaggedVector<DrawCommand, MEMORY_SPRITES> commands;
+	TaggedVector<char, MEMORY_UI> text_runs;
+	TaggedVector<Glyph, MEMORY_UI> glyph_runs;
+	float clear_colour[3]{ 0, 0, 0 };
+	bool clear_colour_set = false;
+	const DrawBuffer* static_layer = nullptr;
+	unsigned int revision = 0;
+};
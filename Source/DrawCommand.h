@@ -0,0 +1,34 @@
+#pragma once
+
+// defines the kinds of draw command
+enum { DRAW_SPRITE, DRAW_TEXT };
+
+/**
+*  A single recorded draw.
+*  Plain data only, so commands can be copied between threads, compared
+*  with memcmp or written to a file. Sprites refer to a texture by the
+*  id the backend gave it and carry their own transform and source
+*  rectangle in texture pixels. Text refers to a run of characters and
+*  a run of shaped glyphs in the buffer that recorded it, and keeps the
+*  size of its layout in character cells in width and height.
+*/
+struct DrawCommand
+{
+	int type = DRAW_SPRITE;
+	int layer = 0;
+	int texture = -1;
+	int sequence = 0;
+	float x = 0;
+	float y = 0;
+	float width = 0;
+	float height = 0;
+	float rotation = 0;
+	float opacity = 1;
+	float scale = 1;
+	float source[4]{ 0, 0, 0, 0 };
+	float colour[3]{ 1, 1, 1 };
+	int text_offset = 0;
+	int text_length = 0;
+	int glyph_offset = 0;
+	int glyph_count = 0;
+};
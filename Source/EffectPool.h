@@ -0,0 +1,182 @@
+#pragma once
+#include "ActiveList.h"
+#include "Constants.h"
+#include "MemoryTracker.h"
+#include "PoolStats.h"
+#include "Snapshot.h"
+
+/**
+*  Fixed size pool of short lived effects such as bombs.
+*  Every slot is allocated when the pool is initialised, so acquiring
+*  and releasing never touch the heap. An acquired effect is always a
+*  fresh copy of the pool's prototype, so nothing has to be reset by
+*  hand when an effect ends or a level restarts. Once the pool is
+*  full, new effects are either refused or take the place of the
+*  oldest live one, depending on the pool's policy.
+*  Live effects are walked by index. Releasing the effect being
+*  visited is safe when walking backwards.
+*/
+template <class T, int Tag = MEMORY_PHYSICS>
+class EffectPool
+{
+public:
+	/**
+	*  Default constructor. The pool holds nothing until initialised.
+	*/
+	EffectPool() = default;
+
+	/**
+	*  Allocates the pool's slots and empties it.
+	*  @param [in] capacity The most effects that can be live at once
+	*  @param [in] full_policy POOL_REJECT or POOL_RECYCLE_OLDEST
+	*  @param [in] prototype The state every acquired effect starts in
+	*/
+	void init(int capacity, int full_policy, const T& prototype = T())
+	{
+		items.assign(capacity, prototype);
+		sequence.assign(capacity, 0);
+		free_slots.clear();
+		free_slots.reserve(capacity);
+		for (int slot = capacity - 1; slot >= 0; slot--)
+		{
+			free_slots.push_back(slot);
+		}
+		live.reset(capacity);
+		defaults = prototype;
+		policy = full_policy;
+		next_sequence = 0;
+		stats = PoolStats();
+	}
+
+	/**
+	*  Takes an effect from the pool, reset to the prototype.
+	*  @return the effect, or nullptr if the pool is full and refuses
+	*/
+	T* acquire()
+	{
+		int slot = -1;
+		if (!free_slots.empty())
+		{
+			slot = free_slots.back();
+			free_slots.pop_back();
+			live.add(slot);
+		}
+		else if (policy == POOL_RECYCLE_OLDEST && live.size() > 0)
+		{
+			slot = oldest();
+			stats.recycled++;
+		}
+		else
+		{
+			stats.rejected++;
+			return nullptr;
+		}
+
+		items[slot] = defaults;
+		sequence[slot] = next_sequence++;
+		stats.acquired++;
+		stats.live = live.size();
+		stats.peak = stats.live > stats.peak ? stats.live : stats.peak;
+		return &items[slot];
+	}
+
+	/**
+	*  Gives a live effect back to the pool.
+	*  @param [in] idx The index of the effect among the live ones
+	*/
+	void release(int idx)
+	{
+		int slot = live[idx];
+		live.remove(slot);
+		free_slots.push_back(slot);
+		stats.live = live.size();
+	}
+
+	/**
+	*  Gives every live effect back to the pool.
+	*/
+	void clear()
+	{
+		for (int idx = live.size() - 1; idx >= 0; idx--)
+		{
+			release(idx);
+		}
+	}
+
+	/**
+	*  Appends the live effects and the pool's counters to a snapshot.
+	*  The capacity, policy and prototype are not saved.
+	*  @param [in] snapshot The snapshot to write to
+	*/
+	void save(Snapshot& snapshot) const
+	{
+		snapshot.writeVector(items);
+		snapshot.writeVector(sequence);
+		snapshot.writeVector(free_slots);
+		live.save(snapshot);
+		snapshot.write(next_sequence);
+		snapshot.write(stats);
+	}
+
+	/**
+	*  Replaces the effects with the next ones in a snapshot.
+	*  @param [in] reader The snapshot being read
+	*/
+	void restore(SnapshotReader& reader)
+	{
+		reader.readVector(items);
+		reader.readVector(sequence);
+		reader.readVector(free_slots);
+		live.restore(reader);
+		reader.read(next_sequence);
+		reader.read(stats);
+	}
+
+	T& operator[](int idx)
+	{
+		return items[live[idx]];
+	}
+
+	const T& operator[](int idx) const
+	{
+		return items[live[idx]];
+	}
+
+	int size() const
+	{
+		return live.size();
+	}
+
+	int capacity() const
+	{
+		return (int)items.size();
+	}
+
+	const PoolStats& getStats() const
+	{
+		return stats;
+	}
+
+private:
+	int oldest() const
+	{
+		int found = live[0];
+		for (int slot : live)
+		{
+			if (sequence[slot] < sequence[found])
+			{
+				found = slot;
+			}
+		}
+		return found;
+	}
+
+	TaggedVector<T, Tag> items;
+	TaggedVector<unsigned int, Tag> sequence;
+	TaggedVector<int, Tag> free_slots;
+	ActiveList live;
+	T defaults = T();
+	int policy = POOL_REJECT;
+	unsigned int next_sequence = 0;
+	PoolStats stats;
+};
@@ -0,0 +1,142 @@
+#include "Entity.h"
+#include "ActiveList.h"
+#include "Picture.h"
+#include "World.h"
+
+void Entity::create(World& new_world)
+{
+	world = &new_world;
+	id = world->create();
+}
+
+void Entity::destroy()
+{
+	if (world == nullptr)
+	{
+		return;
+	}
+	if (active_list != nullptr)
+	{
+		active_list->remove(active_slot);
+	}
+	world->destroy(id);
+	world = nullptr;
+	id = -1;
+	active_list = nullptr;
+	active_slot = -1;
+}
+
+bool Entity::addSprite(AsgeBackend& backend, const TextureAtlas& atlas,
+	const std::string& region_name, int layer)
+{
+	Picture picture;
+	if (!picture.load(backend, atlas, region_name))
+	{
+		return false;
+	}
+
+	picture.sprite.layer = layer;
+	world->sprites.add(id) = picture.sprite;
+	Transform& entity_transform = transform();
+	entity_transform.width = picture.transform.width;
+	entity_transform.height = picture.transform.height;
+	return true;
+}
+
+int Entity::getId() const
+{
+	return id;
+}
+
+Transform& Entity::transform()
+{
+	return world->transforms.get(id);
+}
+
+const Transform& Entity::transform() const
+{
+	return world->transforms.get(id);
+}
+
+Sprite& Entity::sprite()
+{
+	return world->sprites.get(id);
+}
+
+rect Entity::getBoundingBox() const
+{
+	const Transform& entity_transform = transform();
+	rect bounding_box;
+	bounding_box.x = entity_transform.x;
+	bounding_box.y = entity_transform.y;
+	bounding_box.length = entity_transform.width;
+	bounding_box.height = entity_transform.height;
+	return bounding_box;
+}
+
+vector2 Entity::getVelocity() const
+{
+	if (!world->velocities.has(id))
+	{
+		return vector2();
+	}
+	const Velocity& velocity = world->velocities.get(id);
+	return vector2(velocity.x, velocity.y);
+}
+
+void Entity::setVelocity(float x, float y)
+{
+	Velocity& velocity = world->velocities.add(id);
+	velocity.x = x;
+	velocity.y = y;
+}
+
+void Entity::setVisible(bool newBool)
+{
+	world->setVisible(id, newBool);
+	if (active_list == nullptr)
+	{
+		return;
+	}
+	if (newBool)
+	{
+		active_list->add(active_slot);
+	}
+	else
+	{
+		active_list->remove(active_slot);
+	}
+}
+
+bool Entity::getVisible() const
+{
+	return world->isVisible(id);
+}
+
+void Entity::setActiveList(ActiveList* list, int slot)
+{
+	active_list = list;
+	active_slot = slot;
+	setVisible(getVisible());
+}
+
+float Entity::getHealth() const
+{
+	if (!world->healths.has(id))
+	{
+		return Health().value;
+	}
+	return world->healths.get(id).value;
+}
+
+void Entity::setHealth(float new_health)
+{
+	world->healths.add(id).value = new_health;
+}
+
+bool Entity::damage(float amount)
+{
+	Health& health = world->healths.add(id);
+	health.value -= amount;
+	return health.value <= 0.f;
+}
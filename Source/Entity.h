@@ -0,0 +1,87 @@
+#pragma once
+#include <string>
+#include "Components.h"
+#include "Rect.h"
+#include "Vector2.h"
+
+class World;
+class ActiveList;
+class AsgeBackend;
+class TextureAtlas;
+
+/**
+*  A handle to an entity in the world.
+*  The handle holds no state of its own besides the id, everything
+*  about the entity lives in the world's component pools. Handles are
+*  kept by the game to name the objects its rules refer to.
+*  @see World
+*/
+class Entity
+{
+public:
+	/**
+	*  Default constructor. The handle is empty until created.
+	*/
+	Entity() = default;
+
+	/**
+	*  Creates the entity in a world.
+	*  @param [in] world The world that owns the entity
+	*/
+	void create(World& world);
+
+	/**
+	*  Destroys the entity, leaving the handle empty.
+	*  The entity leaves its active list and its id is reused.
+	*/
+	void destroy();
+
+	/**
+	*  Gives the entity a sprite drawing a region of an atlas.
+	*  The entity takes the size of the region.
+	*  @param [in] backend The backend the atlas texture is registered with
+	*  @param [in] atlas The atlas holding the region
+	*  @param [in] region_name The name of the region to draw
+	*  @param [in] layer The layer to draw it on, higher is in front
+	*  @return true if the region exists and its texture was loaded
+	*/
+	bool addSprite(AsgeBackend& backend, const TextureAtlas& atlas,
+		const std::string& region_name, int layer);
+
+	int getId() const;
+	Transform& transform();
+	const Transform& transform() const;
+	Sprite& sprite();
+	rect getBoundingBox() const;
+
+	vector2 getVelocity() const;
+	void setVelocity(float x, float y);
+
+	void setVisible(bool newBool);
+
+	bool getVisible() const;
+
+	/**
+	*  Keeps the entity's slot in an active list while it is visible.
+	*  Every later change of visibility adds or removes the slot.
+	*  @param [in] list The list of visible entities of this kind
+	*  @param [in] slot The entity's slot in its array
+	*/
+	void setActiveList(ActiveList* list, int slot);
+
+	float getHealth() const;
+	void setHealth(float new_health);
+
+	/**
+	*  Removes health from the entity.
+	*  @param [in] amount The damage to apply
+	*  @return true if the entity has no health left
+	*/
+	bool damage(float amount);
+
+private:
+	World* world = nullptr;
+	int id = -1;
+	ActiveList* active_list = nullptr;
+	int active_slot = -1;
+};
@@ -0,0 +1,70 @@
+#include "Explosion.h"
+#include "Snapshot.h"
+
+/**
+*   @brief   Push
+*   @details Writes the explosion after the last queued one,
+			 wrapping around the end of the array. A full queue drops
+			 the explosion and counts it.
+*   @return  bool
+*/
+bool ExplosionQueue::push(const Explosion& explosion)
+{
+	if (count == MAX_EXPLOSIONS)
+	{
+		dropped++;
+		return false;
+	}
+
+	explosions[(head + count) % MAX_EXPLOSIONS] = explosion;
+	count++;
+	return true;
+}
+
+/**
+*   @brief   Pop
+*   @details Reads the oldest explosion and advances the head.
+*   @return  bool
+*/
+bool ExplosionQueue::pop(Explosion& explosion)
+{
+	if (count == 0)
+	{
+		return false;
+	}
+
+	explosion = explosions[head];
+	head = (head + 1) % MAX_EXPLOSIONS;
+	count--;
+	return true;
+}
+
+void ExplosionQueue::save(Snapshot& snapshot) const
+{
+	snapshot.writeArray(explosions, MAX_EXPLOSIONS);
+	snapshot.write(head);
+	snapshot.write(count);
+}
+
+void ExplosionQueue::restore(SnapshotReader& reader)
+{
+	reader.readArray(explosions, MAX_EXPLOSIONS);
+	reader.read(head);
+	reader.read(count);
+}
+
+void ExplosionQueue::clear()
+{
+	head = 0;
+	count = 0;
+}
+
+int ExplosionQueue::size() const
+{
+	return count;
+}
+
+int ExplosionQueue::getDropped() const
+{
+	return dropped;
+}
@@ -0,0 +1,79 @@
+#pragma once
+#include "Constants.h"
+
+// every explosive block can be waiting to go off at once, behind the blast that set them off
+static_assert(MAX_EXPLOSIONS > NUM_BLOCKS - FIRST_EXPLOSIVE_BLOCK,
+	"MAX_EXPLOSIONS must hold a chain through every explosive block");
+
+class Snapshot;
+class SnapshotReader;
+
+/**
+*  A single pending blast.
+*  Damage and impulse fall off linearly from the full value at the
+*  centre to nothing at the radius.
+*/
+struct Explosion
+{
+	float x = 0;
+	float y = 0;
+	float radius = 0;
+	float impulse = 0;
+};
+
+/**
+*  Fixed size first in, first out queue of pending explosions.
+*  Explosions that trigger further explosions push them onto the
+*  queue instead of resolving them straight away, so a chain of
+*  explosive blocks is processed iteratively in the order it spreads.
+*  The queue is sized to hold the longest possible chain. Should a
+*  push still find it full, the blast is dropped and counted.
+*/
+class ExplosionQueue
+{
+public:
+	/**
+	*  Default constructor.
+	*/
+	ExplosionQueue() = default;
+
+	/**
+	*  Adds an explosion to the back of the queue.
+	*  @param [in] explosion The explosion to add
+	*  @return false if the queue is full and the explosion was dropped
+	*/
+	bool push(const Explosion& explosion);
+
+	/**
+	*  Removes the explosion at the front of the queue.
+	*  @param [out] explosion The explosion removed
+	*  @return false if the queue was empty
+	*/
+	bool pop(Explosion& explosion);
+
+	/**
+	*  Appends the queue to a snapshot.
+	*  @param [in] snapshot The snapshot to write to
+	*/
+	void save(Snapshot& snapshot) const;
+
+	/**
+	*  Replaces the queue with the next one in a snapshot.
+	*  @param [in] reader The snapshot being read
+	*/
+	void restore(SnapshotReader& reader);
+
+	void clear();
+	int  size() const;
+
+	/**
+	*  @return the number of explosions dropped because the queue was full
+	*/
+	int  getDropped() const;
+
+private:
+	Explosion explosions[MAX_EXPLOSIONS];
+	int head = 0;
+	int count = 0;
+	int dropped = 0;
+};
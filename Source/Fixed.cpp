@@ -0,0 +1,115 @@
+#include "Fixed.h"
+
+namespace
+{
+	// pi and its multiples in 16.16, rounded to the nearest step
+	const int32_t PI_RAW = 205887;
+	const int32_t HALF_PI_RAW = 102944;
+	const int32_t TWO_PI_RAW = 411775;
+
+	// the sine series is summed with 30 fraction bits
+	const int SERIES_BITS = 30;
+	const int64_t SERIES_ONE = (int64_t)1 << SERIES_BITS;
+}
+
+Fixed Fixed::operator/(Fixed a) const
+{
+	if (a.raw == 0)
+	{
+		return fromRaw(raw < 0 ? INT32_MIN : INT32_MAX);
+	}
+
+	int64_t quotient = ((int64_t)raw * ONE) / a.raw;
+	if (quotient > INT32_MAX)
+	{
+		return fromRaw(INT32_MAX);
+	}
+	if (quotient < INT32_MIN)
+	{
+		return fromRaw(INT32_MIN);
+	}
+	return fromRaw((int32_t)quotient);
+}
+
+/**
+*   @brief   Fixed Sqrt
+*   @details The root of a 16.16 value is the integer root of its raw
+			 value shifted up by 16 bits, found a bit at a time.
+*   @return  Fixed
+*/
+Fixed fixedSqrt(Fixed value)
+{
+	if (value.getRaw() <= 0)
+	{
+		return Fixed();
+	}
+
+	uint64_t remainder = (uint64_t)value.getRaw() << Fixed::FRACTION_BITS;
+	uint64_t root = 0;
+	uint64_t bit = (uint64_t)1 << 62;
+	while (bit > remainder)
+	{
+		bit >>= 2;
+	}
+	while (bit != 0)
+	{
+		if (remainder >= root + bit)
+		{
+			remainder -= root + bit;
+			root = (root >> 1) + bit;
+		}
+		else
+		{
+			root >>= 1;
+		}
+		bit >>= 2;
+	}
+	return Fixed::fromRaw((int32_t)root);
+}
+
+/**
+*   @brief   Fixed Sin
+*   @details Folds the angle into [-pi/2, pi/2], where the Taylor
+			 series up to x^11 is accurate to well under a step, and
+			 sums it in Horner form with 30 fraction bits.
+*   @return  Fixed
+*/
+Fixed fixedSin(Fixed radians)
+{
+	int32_t angle = radians.getRaw() % TWO_PI_RAW;
+	if (angle > PI_RAW)
+	{
+		angle -= TWO_PI_RAW;
+	}
+	else if (angle < -PI_RAW)
+	{
+		angle += TWO_PI_RAW;
+	}
+	if (angle > HALF_PI_RAW)
+	{
+		angle = PI_RAW - angle;
+	}
+	else if (angle < -HALF_PI_RAW)
+	{
+		angle = -PI_RAW - angle;
+	}
+
+	int64_t x = (int64_t)angle * (SERIES_ONE / Fixed::ONE);
+	int64_t x2 = (x * x) >> SERIES_BITS;
+	int64_t sum = SERIES_ONE;
+	const int divisors[5] = { 110, 72, 42, 20, 6 };
+	for (int divisor : divisors)
+	{
+		sum = SERIES_ONE - ((x2 * sum) >> SERIES_BITS) / divisor;
+	}
+	int64_t result = (x * sum) >> SERIES_BITS;
+
+	const int64_t shift = SERIES_BITS - Fixed::FRACTION_BITS;
+	return Fixed::fromRaw((int32_t)((result + ((int64_t)1 << (shift - 1))) >> shift));
+}
+
+Fixed fixedCos(Fixed radians)
+{
+	int64_t angle = (int64_t)radians.getRaw() % TWO_PI_RAW + HALF_PI_RAW;
+	return fixedSin(Fixed::fromRaw((int32_t)angle));
+}
@@ -0,0 +1,144 @@
+#pragma once
+#include <stdint.h>
+
+/*! \file Fixed.h
+@brief   16.16 fixed point numbers for the deterministic physics mode.
+@details Float results can change with the compiler, the optimisation
+		 flags and whether multiply-adds are contracted, so the same
+		 inputs can play out differently on another machine. Defining
+		 DETERMINISTIC_PHYSICS in the project's preprocessor definitions
+		 makes the simulation step positions and velocities with this
+		 type instead, which only uses integer arithmetic. State is
+		 still stored as float between steps; converting to and from
+		 float is exactly rounded, so that is just as reproducible.
+		 The float code around the physics, such as the level layout,
+		 must not have its multiply-adds fused either, so contraction is
+		 switched off in every file that includes this one, and the
+		 project builds with /fp:precise and SSE2 so nothing is kept at
+		 x87 precision.
+		 Only the integration of bodies, birds and debris and the blast
+		 impulse are fixed point. Collision detection and the collision
+		 response still work in float, so a replay with collisions is
+		 only reproducible between builds that round float the same
+		 way. Run the game with --check-physics to compare a build
+		 against the reference.
+		 @see PhysicsCheck.h
+*/
+
+#ifdef DETERMINISTIC_PHYSICS
+#if defined(_MSC_VER)
+#pragma fp_contract(off)
+#elif defined(__clang__)
+#pragma STDC FP_CONTRACT OFF
+#elif defined(__GNUC__)
+#pragma GCC optimize("fp-contract=off")
+#endif
+#endif
+
+/**
+*  A 16.16 fixed point number.
+*  The range is about +-32767 with a step of 1/65536, which covers
+*  world units and speeds. Products and quotients are rounded to the
+*  nearest step and sums wrap on overflow, the same on every target.
+*/
+class Fixed
+{
+public:
+	static constexpr int FRACTION_BITS = 16;
+	static constexpr int32_t ONE = 1 << FRACTION_BITS;
+
+	constexpr Fixed() = default;
+
+	static constexpr Fixed fromRaw(int32_t raw_value)
+	{
+		Fixed result;
+		result.raw = raw_value;
+		return result;
+	}
+
+	static constexpr Fixed fromInt(int value)
+	{
+		return fromRaw(value * ONE);
+	}
+
+	/**
+	*  Rounds a float to the nearest step, ties away from zero,
+	*  saturating out of range values. NaN becomes zero.
+	*/
+	static Fixed fromFloat(float value)
+	{
+		// a float times 2^16 is exact as a double, and so is adding a half
+		double scaled = (double)value * ONE;
+		if (!(scaled == scaled))
+		{
+			return Fixed();
+		}
+		if (scaled >= 2147483647.0)
+		{
+			return fromRaw(INT32_MAX);
+		}
+		if (scaled <= -2147483648.0)
+		{
+			return fromRaw(INT32_MIN);
+		}
+		return fromRaw((int32_t)(scaled >= 0 ? scaled + 0.5 : scaled - 0.5));
+	}
+
+	constexpr int32_t getRaw() const { return raw; }
+	constexpr float toFloat() const { return raw / (float)ONE; }
+
+	constexpr Fixed operator+(Fixed a) const
+	{
+		return fromRaw((int32_t)((uint32_t)raw + (uint32_t)a.raw));
+	}
+
+	constexpr Fixed operator-(Fixed a) const
+	{
+		return fromRaw((int32_t)((uint32_t)raw - (uint32_t)a.raw));
+	}
+
+	constexpr Fixed operator-() const
+	{
+		return fromRaw((int32_t)(0u - (uint32_t)raw));
+	}
+
+	constexpr Fixed operator*(Fixed a) const
+	{
+		return fromRaw((int32_t)(((int64_t)raw * a.raw + (ONE / 2)) >> FRACTION_BITS));
+	}
+
+	/**
+	*  Divides, rounding towards zero. Dividing by zero saturates.
+	*/
+	Fixed operator/(Fixed a) const;
+
+	constexpr Fixed& operator+=(Fixed a) { return *this = *this + a; }
+	constexpr Fixed& operator-=(Fixed a) { return *this = *this - a; }
+	constexpr Fixed& operator*=(Fixed a) { return *this = *this * a; }
+	Fixed& operator/=(Fixed a) { return *this = *this / a; }
+
+	constexpr bool operator==(Fixed a) const { return raw == a.raw; }
+	constexpr bool operator!=(Fixed a) const { return raw != a.raw; }
+	constexpr bool operator<(Fixed a) const { return raw < a.raw; }
+	constexpr bool operator<=(Fixed a) const { return raw <= a.raw; }
+	constexpr bool operator>(Fixed a) const { return raw > a.raw; }
+	constexpr bool operator>=(Fixed a) const { return raw >= a.raw; }
+
+private:
+	int32_t raw = 0;
+};
+
+/**
+*  Square root, exact to the step below. Negative values give zero.
+*/
+Fixed fixedSqrt(Fixed value);
+
+/**
+*  Sine of an angle in radians, to within two steps.
+*/
+Fixed fixedSin(Fixed radians);
+
+/**
+*  Cosine of an angle in radians, to within three steps.
+*/
+Fixed fixedCos(Fixed radians);
@@ -0,0 +1,140 @@
+#include "ForecastCheck.h"
+#include <chrono>
+#include <ostream>
+#include <string.h>
+#include <vector>
+#include "Constants.h"
+#include "JobSystem.h"
+#include "ShotForecast.h"
+#include "Snapshot.h"
+#include "World.h"
+
+namespace
+{
+	const int LEVEL_COLUMNS = 6;
+	const int LEVEL_ROWS = 5;
+	const float LEVEL_BLOCK_SIZE = 60.f;
+	const float FLOOR_HEIGHT = 80.f;
+	const int FAN_WIDTH = 16;
+	const int FAN_SHOTS = 256;
+
+	using Clock = std::chrono::high_resolution_clock;
+
+	int addBody(World& world, float x, float y, float width, float height)
+	{
+		int entity = world.create();
+		Transform& transform = world.transforms.get(entity);
+		transform.x = x;
+		transform.y = y;
+		transform.width = width;
+		transform.height = height;
+		world.colliders.add(entity);
+		return entity;
+	}
+
+	/**
+	*  Builds a floor, a ledge and a tower of blocks with a pig on
+	*  every other row, and a bird at rest at the left. Returns the
+	*  entity of the bird.
+	*/
+	int buildLevel(World& world)
+	{
+		addBody(world, 0.f, WORLD_HEIGHT - FLOOR_HEIGHT, WORLD_WIDTH, FLOOR_HEIGHT);
+		addBody(world, 1500.f, 500.f, 300.f, 40.f);
+
+		for (int row = 0; row < LEVEL_ROWS; row++)
+		{
+			float y = WORLD_HEIGHT - FLOOR_HEIGHT - (row + 1) * LEVEL_BLOCK_SIZE;
+			for (int column = 0; column < LEVEL_COLUMNS; column++)
+			{
+				float x = 1000.f + column * LEVEL_BLOCK_SIZE;
+				if (row % 2 == 1 && column % 2 == 1)
+				{
+					int enemy = addBody(world, x, y, LEVEL_BLOCK_SIZE, LEVEL_BLOCK_SIZE);
+					world.healths.add(enemy).value = HEALTH_ENEMY;
+					continue;
+				}
+				int block = addBody(world, x, y, LEVEL_BLOCK_SIZE, LEVEL_BLOCK_SIZE);
+				world.materials.add(block);
+			}
+		}
+
+		int bird = world.create();
+		Transform& transform = world.transforms.get(bird);
+		transform.x = 200.f;
+		transform.y = WORLD_HEIGHT - 400.f;
+		transform.width = 40.f;
+		transform.height = 40.f;
+		return bird;
+	}
+
+	bool sameWorld(const Snapshot& lhs, const Snapshot& rhs)
+	{
+		return lhs.size() == rhs.size() &&
+			memcmp(lhs.data(), rhs.data(), lhs.size()) == 0;
+	}
+
+	bool sameOutcome(const ShotOutcome& lhs, const ShotOutcome& rhs)
+	{
+		return lhs.enemies_hit == rhs.enemies_hit && lhs.blocks_hit == rhs.blocks_hit &&
+			lhs.ticks == rhs.ticks && lhs.landed == rhs.landed &&
+			lhs.end.getX() == rhs.end.getX() && lhs.end.getY() == rhs.end.getY();
+	}
+}
+
+/**
+*   @brief   Check Forecast
+*   @details Saves the scripted level, forecasts the fan of launches
+			 on every worker and saves it again. The shots that broke
+			 something wrote to their forks, so they show that the
+			 writes stayed there. The fan is then flown one shot at a
+			 time and compared with the parallel outcomes.
+*   @return  bool
+*/
+bool checkForecast(std::ostream& out)
+{
+	World world;
+	int bird = buildLevel(world);
+	rect bounds;
+	bounds.x = 0.f;
+	bounds.y = 0.f;
+	bounds.length = WORLD_WIDTH;
+	bounds.height = WORLD_HEIGHT;
+
+	std::vector<vector2> launches(FAN_SHOTS);
+	for (int i = 0; i < FAN_SHOTS; i++)
+	{
+		launches[i] = vector2(40.f + (i % FAN_WIDTH) * 5.f, -10.f - (i / FAN_WIDTH) * 5.f);
+	}
+
+	JobSystem jobs;
+	jobs.start();
+	ShotForecast forecast(jobs);
+	Snapshot before;
+	world.save(before);
+	std::vector<ShotOutcome> outcomes(FAN_SHOTS);
+	Clock::time_point start = Clock::now();
+	forecast.evaluate(world, bird, bounds, launches.data(), outcomes.data(), FAN_SHOTS);
+	std::chrono::duration<double, std::milli> elapsed = Clock::now() - start;
+	Snapshot after;
+	world.save(after);
+
+	int breaking = 0;
+	for (const ShotOutcome& outcome : outcomes)
+	{
+		breaking += outcome.blocks_hit + outcome.enemies_hit > 0 ? 1 : 0;
+	}
+	bool unchanged = sameWorld(before, after);
+	out << FAN_SHOTS << " shots in " << elapsed.count() << " ms, " << breaking <<
+		" broke something, world " << (unchanged ? "unchanged\n" : "CHANGED\n");
+
+	int mismatches = 0;
+	for (int i = 0; i < FAN_SHOTS; i++)
+	{
+		ShotOutcome alone;
+		forecast.evaluate(world, bird, bounds, &launches[i], &alone, 1);
+		mismatches += sameOutcome(alone, outcomes[i]) ? 0 : 1;
+	}
+	out << mismatches << " shots differ when flown alone\n";
+	return unchanged && breaking > 0 && mismatches == 0;
+}
@@ -0,0 +1,20 @@
+#pragma once
+#include <iosfwd>
+
+/*! \file ForecastCheck.h
+@brief   Check of the shot forecast and the world forks it flies in.
+@details Run by starting the game with --check-forecast, which writes
+		 the results to Forecast_check.txt instead of playing. A scripted
+		 level of blocks, pigs and platforms is forecast for a fan of
+		 launches on every worker. The level is saved before and after,
+		 and must come back byte for byte the same, so no shot wrote
+		 through its fork into the world it forked. The fan is flown
+		 again one shot at a time and must give the same outcomes.
+*/
+
+/**
+*  Forecasts the scripted shots, checks the world and times them.
+*  @param [in] out The stream to write the results to
+*  @return false if the world changed or the outcomes differed
+*/
+bool checkForecast(std::ostream& out);
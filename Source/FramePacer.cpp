@@ -0,0 +1,70 @@
+#include <thread>
+#include <Windows.h>
+#include "FramePacer.h"
+#include "Constants.h"
+
+FramePacer::~FramePacer()
+{
+	setFrameRate(0);
+}
+
+/**
+*   @brief   Set Frame Rate
+*   @details Raises the timer resolution when pacing starts and
+			 restores it when pacing stops, so uncapped frames leave
+			 the system timer alone.
+*   @return  void
+*/
+void FramePacer::setFrameRate(int frames_per_second)
+{
+	frames_per_second = frames_per_second > 0 ? frames_per_second : 0;
+	if (frames_per_second == frame_rate)
+	{
+		return;
+	}
+	if (frame_rate == 0)
+	{
+		timeBeginPeriod(1);
+	}
+	else if (frames_per_second == 0)
+	{
+		timeEndPeriod(1);
+	}
+	frame_rate = frames_per_second;
+	period = frame_rate > 0 ?
+		std::chrono::duration_cast<Clock::duration>(std::chrono::seconds(1)) / frame_rate :
+		Clock::duration::zero();
+	next_frame = Clock::now();
+}
+
+/**
+*   @brief   Wait
+*   @details Sleeps until just short of the next frame, then spins
+			 the remainder. Frames are due a fixed period apart, so
+			 an early or late wake up does not drift the rate.
+*   @return  void
+*/
+void FramePacer::wait()
+{
+	Clock::time_point now = Clock::now();
+	if (period == Clock::duration::zero())
+	{
+		next_frame = now;
+		return;
+	}
+	if (now >= next_frame + period)
+	{
+		next_frame = now;
+	}
+
+	const Clock::duration spin = std::chrono::microseconds(PACER_SPIN_US);
+	if (next_frame - now > spin)
+	{
+		std::this_thread::sleep_for(next_frame - now - spin);
+	}
+	while (Clock::now() < next_frame)
+	{
+		std::this_thread::yield();
+	}
+	next_frame += period;
+}
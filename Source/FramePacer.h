@@ -0,0 +1,46 @@
+#pragma once
+#include <chrono>
+
+/**
+*  Holds the game loop to a target frame rate.
+*  Most of the wait is slept, which frees the core, and the last
+*  moments are spun so the frame starts on time despite the coarse
+*  granularity of the system timer. A frame that runs late starts
+*  the next one straight away rather than trying to catch up.
+*/
+class FramePacer
+{
+public:
+	/**
+	*  Default constructor. Frames are not paced until a rate is set.
+	*/
+	FramePacer() = default;
+
+	/**
+	*  Destructor. Restores the system timer resolution.
+	*/
+	~FramePacer();
+
+	FramePacer(const FramePacer&) = delete;
+	FramePacer& operator=(const FramePacer&) = delete;
+
+	/**
+	*  Sets the rate frames are paced to. The system timer resolution
+	*  is raised for sleeping only while a rate is set, as it affects
+	*  every process on the machine.
+	*  @param [in] frames_per_second The target rate, 0 to not wait
+	*/
+	void setFrameRate(int frames_per_second);
+
+	/**
+	*  Blocks until the next frame is due.
+	*/
+	void wait();
+
+private:
+	using Clock = std::chrono::steady_clock;
+
+	Clock::time_point next_frame = Clock::now();
+	Clock::duration period = Clock::duration::zero();
+	int frame_rate = 0;
+};
@@ -1,3 +1,6 @@
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
 #include <string>
 #include <Windows.h>
 
@@ -10,12 +13,12 @@
 
 /**
 *   @brief   Default Constructor.
-*   @details Consider setting the game's width and height
-             and even seeding the random number generator.
+*   @details Seeds the game's random number generator, which is only
+			 drawn from inside the tick.
 */
-AngryBirdsGame::AngryBirdsGame()
+AngryBirdsGame::AngryBirdsGame() :
+	random((uint32_t)time(NULL))
 {
-	std::srand(time(NULL));
 }
 
 /**
@@ -24,6 +27,7 @@ AngryBirdsGame::AngryBirdsGame()
 */
 AngryBirdsGame::~AngryBirdsGame()
 {
+	jobs.wait(tick_job);
 	this->inputs->unregisterCallback(key_callback_id);
 	this->inputs->unregisterCallback(mouse_callback_id);
 }
@@ -47,6 +51,9 @@ bool AngryBirdsGame::init()
 	renderer->setWindowedMode(ASGE::Renderer::WindowMode::WINDOWED);
 	setupResolution();
 
+	// batch consecutive draws that share a texture
+	renderer->setSpriteMode(ASGE::SpriteSortMode::DEFERRED);
+
 	// input handling functions
 	inputs->use_threads = false;
 
@@ -56,20 +63,33 @@ bool AngryBirdsGame::init()
 	mouse_callback_id = inputs->addCallbackFnc(
 		ASGE::E_MOUSE_CLICK, &AngryBirdsGame::clickHandler, this);
 
+	// files are parsed on the workers meanwhile, as only the main
+	// thread may load textures
+	jobs.start();
 	clearArrays();
-	loadFiles();
-
-	
+	JobId scores_job = jobs.submit([this]() { loadFiles(); });
+	bool atlas_loaded = false;
+	JobId atlas_job = jobs.submit([this, &atlas_loaded]()
+	{
+		atlas_loaded = game_atlas.load("Resources\\Textures\\game_atlas.xml");
+	});
 
-	gameplay_area.height = game_height * GAMEPLAY_AREA_HEIGHT;
-	gameplay_area.length = game_height * GAMEPLAY_AREA_WIDTH;
-	gameplay_area.y = game_height * .09f;
-	gameplay_area.x = (game_width * 0.5) - (gameplay_area.length * 0.5f);
+	gameplay_area.height = WORLD_HEIGHT * GAMEPLAY_AREA_HEIGHT;
+	gameplay_area.length = WORLD_HEIGHT * GAMEPLAY_AREA_WIDTH;
+	gameplay_area.y = WORLD_HEIGHT * .09f;
+	gameplay_area.x = (WORLD_WIDTH * 0.5) - (gameplay_area.length * 0.5f);
+	level_grid.setup(gameplay_area, WORLD_HEIGHT * PLATFORM_LONG);
 
 	setupGrid();
 	//levelGen();
 	//saveLevelMap();
-	if (!loadBackgrounds())
+	asge_backend.init(renderer.get());
+	render_backend = &asge_backend;
+	level_arena.init(LEVEL_ARENA_SIZE);
+	bool backgrounds_loaded = loadBackgrounds();
+	jobs.wait(scores_job);
+	jobs.wait(atlas_job);
+	if (!backgrounds_loaded || !atlas_loaded)
 	{
 		return false;
 	}
@@ -77,6 +97,7 @@ bool AngryBirdsGame::init()
 	{
 		return false;
 	}
+	trackActiveObjects();
 	return true;
 }
 
@@ -88,59 +109,61 @@ background and ui gameobjects.
 */
 bool AngryBirdsGame::loadBackgrounds()
 {
-	if (!menu_layer.addSpriteComponent(renderer.get(), "Resources\\Textures\\menu.jpg"))
+	if (!menu_layer.load(asge_backend, "Resources\\Textures\\menu.jpg"))
 	{
 		return false;
 	}
 
-	if (!level_layer[0].addSpriteComponent(renderer.get(), "Resources\\Textures\\lvl1.png"))
+	if (!loadLevelBackground())
 	{
 		return false;
 	}
 
-	if (!level_layer[1].addSpriteComponent(renderer.get(), "Resources\\Textures\\lvl2.png"))
-	{
-		return false;
-	}
-	if (!level_layer[2].addSpriteComponent(renderer.get(), "Resources\\Textures\\lvl3.png"))
-	{
-		return false;
-	}
-	if (!enemy_counter.addSpriteComponent(renderer.get(), "Resources\\Textures\\kenney_animalpackredux\\PNG\\round\\pig.png"))
+	if (!splash_screen.load(asge_backend, ".\\Resources\\Textures\\splash_screen.png"))
 	{
 		return false;
 	}
+	Transform* splash_sprite = &splash_screen.transform;
+	splash_sprite->width = WORLD_WIDTH * 0.5f;
+	splash_sprite->height = WORLD_HEIGHT * 0.5f;
+	splash_sprite->x = (WORLD_WIDTH * 0.5f) - (splash_sprite->width * 0.5f);
+	splash_sprite->y = (WORLD_HEIGHT * 0.5f) - (splash_sprite->height * 0.5f);
 
-	splash_screen = renderer->createRawSprite();
-	splash_screen->loadTexture(".\\Resources\\Textures\\splash_screen.png");
-	splash_screen->width(game_width * 0.5f);
-	splash_screen->height(game_height * 0.5f);
-	splash_screen->xPos(((float)game_width * 0.5f) -
-		(splash_screen->width() * 0.5f));
-	splash_screen->yPos(((float)game_height * 0.5f) -
-		(splash_screen->height() * 0.5f));
+	Transform* menu_layer_sprite = &menu_layer.transform;
+	menu_layer_sprite->height = WORLD_HEIGHT;
+	menu_layer_sprite->width = WORLD_WIDTH * 0.7f;
+	menu_layer_sprite->y = 0.f;
+	menu_layer_sprite->x = 0.f;
 
-	ASGE::Sprite* menu_layer_sprite = menu_layer.spriteComponent()->getSprite();
-	menu_layer_sprite->height((float)game_height);
-	menu_layer_sprite->width((float)game_width * 0.7f);
-	menu_layer_sprite->yPos(0.f);
-	menu_layer_sprite->xPos(0.f);
+	return true;
+}
 
-	for (int i = 0; i < NUM_LEVELS; i++)
+/**
+*   @brief   Loads the level background
+*   @details Only the background of the current level is kept, the
+			 last one is released first. It takes the id the last one
+			 had, so a snapshot recorded before the change draws the
+			 new background. Textures are loaded on the main thread,
+			 while no tick is running.
+*   @return  bool
+*/
+bool AngryBirdsGame::loadLevelBackground()
+{
+	char file_name[LEVEL_LINE_LENGTH];
+	snprintf(file_name, LEVEL_LINE_LENGTH, "Resources\\Textures\\lvl%d.png", level + 1);
+	asge_backend.releaseTexture(level_layer.sprite.texture);
+	if (!level_layer.load(asge_backend, file_name))
 	{
-		ASGE::Sprite* level_layer_sprite = level_layer[i].spriteComponent()->getSprite();
-		level_layer_sprite->height(gameplay_area.height);
-		level_layer_sprite->width(gameplay_area.length);
-		level_layer_sprite->yPos(gameplay_area.y);
-		level_layer_sprite->xPos(gameplay_area.x);
+		return false;
 	}
+	background_level = level;
+	layout_version++;
 
-	ASGE::Sprite* enemy_counter_sprite = enemy_counter.spriteComponent()->getSprite();
-	enemy_counter_sprite->height(game_height * ENEMY_MEDIUM);
-	enemy_counter_sprite->width(game_height * ENEMY_MEDIUM);
-	enemy_counter_sprite->yPos(game_height * 0.05f);
-	enemy_counter_sprite->xPos(gameplay_area.x);
-	
+	Transform* level_layer_sprite = &level_layer.transform;
+	level_layer_sprite->height = gameplay_area.height;
+	level_layer_sprite->width = gameplay_area.length;
+	level_layer_sprite->y = gameplay_area.y;
+	level_layer_sprite->x = gameplay_area.x;
 	return true;
 }
 
@@ -152,299 +175,385 @@ various gameplay objects.
 */
 bool AngryBirdsGame::loadGameSprites()
 {
+	if (!enemy_counter.load(asge_backend, game_atlas, "pig.png"))
+	{
+		return false;
+	}
+	Transform* enemy_counter_sprite = &enemy_counter.transform;
+	enemy_counter_sprite->height = WORLD_HEIGHT * ENEMY_MEDIUM;
+	enemy_counter_sprite->width = WORLD_HEIGHT * ENEMY_MEDIUM;
+	enemy_counter_sprite->y = WORLD_HEIGHT * 0.05f;
+	enemy_counter_sprite->x = gameplay_area.x;
+
 	for (int i = 0; i < NUM_BLOCKS; i++)
 	{
-		
+		blocks[i].create(world);
 		if (i < 2)
 		{
-			if (!blocks[i].addSpriteComponent(renderer.get(),
-				"Resources\\Textures\\kenney_physicspack\\PNG\\Glass elements\\elementGlass012.png"))
+			if (!blocks[i].addSprite(asge_backend, game_atlas,
+				"elementGlass012.png", LAYER_LEVEL))
 			{
 				return false;
 			}
-			ASGE::Sprite* block_sprite = blocks[i].spriteComponent()->getSprite();
-			block_sprite->height(game_height * BLOCK_NORMAL);
-			block_sprite->width(game_height * BLOCK_NORMAL);
+			Transform* block_sprite = &blocks[i].transform();
+			block_sprite->height = WORLD_HEIGHT * BLOCK_NORMAL;
+			block_sprite->width = WORLD_HEIGHT * BLOCK_NORMAL;
 		}
 		else if (i < 4)
 		{
-			if (!blocks[i].addSpriteComponent(renderer.get(),
-				"Resources\\Textures\\kenney_physicspack\\PNG\\Glass elements\\elementGlass014.png"))
+			if (!blocks[i].addSprite(asge_backend, game_atlas,
+				"elementGlass014.png", LAYER_LEVEL))
 			{
 				return false;
 			}
-			ASGE::Sprite* block_sprite = blocks[i].spriteComponent()->getSprite();
-			block_sprite->height(game_height * BLOCK_THIN);
-			block_sprite->width(game_height * BLOCK_LONG);
+			Transform* block_sprite = &blocks[i].transform();
+			block_sprite->height = WORLD_HEIGHT * BLOCK_THIN;
+			block_sprite->width = WORLD_HEIGHT * BLOCK_LONG;
 		}
 		else if (i < 7)
 		{
-			if (!blocks[i].addSpriteComponent(renderer.get(),
-				"Resources\\Textures\\kenney_physicspack\\PNG\\Glass elements\\elementGlass021.png"))
+			if (!blocks[i].addSprite(asge_backend, game_atlas,
+				"elementGlass021.png", LAYER_LEVEL))
 			{
 				return false;
 			}
-			ASGE::Sprite* block_sprite = blocks[i].spriteComponent()->getSprite();
-			block_sprite->height(game_height * BLOCK_LONG);
-			block_sprite->width(game_height * BLOCK_THIN);
+			Transform* block_sprite = &blocks[i].transform();
+			block_sprite->height = WORLD_HEIGHT * BLOCK_LONG;
+			block_sprite->width = WORLD_HEIGHT * BLOCK_THIN;
 		}
 		else if (i < 9)
 		{
-			if (!blocks[i].addSpriteComponent(renderer.get(),
-				"Resources\\Textures\\kenney_physicspack\\PNG\\Glass elements\\elementGlass003.png"))
+			if (!blocks[i].addSprite(asge_backend, game_atlas,
+				"elementGlass003.png", LAYER_LEVEL))
 			{
 				return false;
 			}
-			ASGE::Sprite* block_sprite = blocks[i].spriteComponent()->getSprite();
-			block_sprite->height(game_height * BLOCK_NORMAL);
-			block_sprite->width(game_height * BLOCK_NORMAL);
+			Transform* block_sprite = &blocks[i].transform();
+			block_sprite->height = WORLD_HEIGHT * BLOCK_NORMAL;
+			block_sprite->width = WORLD_HEIGHT * BLOCK_NORMAL;
 		}
-		else if (i < 10)
+		else if (i < FIRST_WOOD_BLOCK)
 		{
-			if (!blocks[i].addSpriteComponent(renderer.get(),
-				"Resources\\Textures\\kenney_physicspack\\PNG\\Glass elements\\elementGlass005.png"))
+			if (!blocks[i].addSprite(asge_backend, game_atlas,
+				"elementGlass005.png", LAYER_LEVEL))
 			{
 				return false;
 			}
-			ASGE::Sprite* block_sprite = blocks[i].spriteComponent()->getSprite();
-			block_sprite->height(game_height * BLOCK_NORMAL);
-			block_sprite->width(game_height * BLOCK_NORMAL);
+			Transform* block_sprite = &blocks[i].transform();
+			block_sprite->height = WORLD_HEIGHT * BLOCK_NORMAL;
+			block_sprite->width = WORLD_HEIGHT * BLOCK_NORMAL;
 		}
 		else if (i < 14)
 		{
-			if (!blocks[i].addSpriteComponent(renderer.get(),
-				"Resources\\Textures\\kenney_physicspack\\PNG\\Wood elements\\elementWood010.png"))
+			if (!blocks[i].addSprite(asge_backend, game_atlas,
+				"elementWood010.png", LAYER_LEVEL))
 			{
 				return false;
 			}
-			ASGE::Sprite* block_sprite = blocks[i].spriteComponent()->getSprite();
-			block_sprite->height(game_height * BLOCK_NORMAL);
-			block_sprite->width(game_height * BLOCK_NORMAL);
+			Transform* block_sprite = &blocks[i].transform();
+			block_sprite->height = WORLD_HEIGHT * BLOCK_NORMAL;
+			block_sprite->width = WORLD_HEIGHT * BLOCK_NORMAL;
 		}
 		else if (i < 20)
 		{
-			if (!blocks[i].addSpriteComponent(renderer.get(),
-				"Resources\\Textures\\kenney_physicspack\\PNG\\Wood elements\\elementWood012.png"))
+			if (!blocks[i].addSprite(asge_backend, game_atlas,
+				"elementWood012.png", LAYER_LEVEL))
 			{
 				return false;
 			}
-			ASGE::Sprite* block_sprite = blocks[i].spriteComponent()->getSprite();
-			block_sprite->height(game_height * BLOCK_THIN);
-			block_sprite->width(game_height * BLOCK_LONG);
+			Transform* block_sprite = &blocks[i].transform();
+			block_sprite->height = WORLD_HEIGHT * BLOCK_THIN;
+			block_sprite->width = WORLD_HEIGHT * BLOCK_LONG;
 		}
 		else if (i < 24)
 		{
-			if (!blocks[i].addSpriteComponent(renderer.get(),
-				"Resources\\Textures\\kenney_physicspack\\PNG\\Wood elements\\elementWood019.png"))
+			if (!blocks[i].addSprite(asge_backend, game_atlas,
+				"elementWood019.png", LAYER_LEVEL))
 			{
 				return false;
 			}
-			ASGE::Sprite* block_sprite = blocks[i].spriteComponent()->getSprite();
-			block_sprite->height(game_height * BLOCK_LONG);
-			block_sprite->width(game_height * BLOCK_THIN);
+			Transform* block_sprite = &blocks[i].transform();
+			block_sprite->height = WORLD_HEIGHT * BLOCK_LONG;
+			block_sprite->width = WORLD_HEIGHT * BLOCK_THIN;
 		}
 		else if (i < 28)
 		{
-			if (!blocks[i].addSpriteComponent(renderer.get(),
-				"Resources\\Textures\\kenney_physicspack\\PNG\\Wood elements\\elementWood001.png"))
+			if (!blocks[i].addSprite(asge_backend, game_atlas,
+				"elementWood001.png", LAYER_LEVEL))
 			{
 				return false;
 			}
-			ASGE::Sprite* block_sprite = blocks[i].spriteComponent()->getSprite();
-			block_sprite->height(game_height * BLOCK_NORMAL);
-			block_sprite->width(game_height * BLOCK_NORMAL);
+			Transform* block_sprite = &blocks[i].transform();
+			block_sprite->height = WORLD_HEIGHT * BLOCK_NORMAL;
+			block_sprite->width = WORLD_HEIGHT * BLOCK_NORMAL;
 		}
-		else if (i < 30)
+		else if (i < FIRST_STONE_BLOCK)
 		{
-			if (!blocks[i].addSpriteComponent(renderer.get(),
-				"Resources\\Textures\\kenney_physicspack\\PNG\\Wood elements\\elementWood000.png"))
+			if (!blocks[i].addSprite(asge_backend, game_atlas,
+				"elementWood000.png", LAYER_LEVEL))
 			{
 				return false;
 			}
-			ASGE::Sprite* block_sprite = blocks[i].spriteComponent()->getSprite();
-			block_sprite->height(game_height * BLOCK_NORMAL);
-			block_sprite->width(game_height * BLOCK_NORMAL);
+			Transform* block_sprite = &blocks[i].transform();
+			block_sprite->height = WORLD_HEIGHT * BLOCK_NORMAL;
+			block_sprite->width = WORLD_HEIGHT * BLOCK_NORMAL;
 		}
 		else if (i < 32)
 		{
-			if (!blocks[i].addSpriteComponent(renderer.get(),
-				"Resources\\Textures\\kenney_physicspack\\PNG\\Stone elements\\elementStone012.png"))
+			if (!blocks[i].addSprite(asge_backend, game_atlas,
+				"elementStone012.png", LAYER_LEVEL))
 			{
 				return false;
 			}
-			ASGE::Sprite* block_sprite = blocks[i].spriteComponent()->getSprite();
-			block_sprite->height(game_height * BLOCK_NORMAL);
-			block_sprite->width(game_height * BLOCK_NORMAL);
+			Transform* block_sprite = &blocks[i].transform();
+			block_sprite->height = WORLD_HEIGHT * BLOCK_NORMAL;
+			block_sprite->width = WORLD_HEIGHT * BLOCK_NORMAL;
 		}
 		else if (i < 36)
 		{
-			if (!blocks[i].addSpriteComponent(renderer.get(),
-				"Resources\\Textures\\kenney_physicspack\\PNG\\Stone elements\\elementStone013.png"))
+			if (!blocks[i].addSprite(asge_backend, game_atlas,
+				"elementStone013.png", LAYER_LEVEL))
 			{
 				return false;
 			}
-			ASGE::Sprite* block_sprite = blocks[i].spriteComponent()->getSprite();
-			block_sprite->height(game_height * BLOCK_THIN);
-			block_sprite->width(game_height * BLOCK_LONG);
+			Transform* block_sprite = &blocks[i].transform();
+			block_sprite->height = WORLD_HEIGHT * BLOCK_THIN;
+			block_sprite->width = WORLD_HEIGHT * BLOCK_LONG;
 		}
 		else if (i < 39)
 		{
-			if (!blocks[i].addSpriteComponent(renderer.get(),
-				"Resources\\Textures\\kenney_physicspack\\PNG\\Stone elements\\elementStone020.png"))
+			if (!blocks[i].addSprite(asge_backend, game_atlas,
+				"elementStone020.png", LAYER_LEVEL))
 			{
 				return false;
 			}
-			ASGE::Sprite* block_sprite = blocks[i].spriteComponent()->getSprite();
-			block_sprite->height(game_height * BLOCK_LONG);
-			block_sprite->width(game_height * BLOCK_THIN);
+			Transform* block_sprite = &blocks[i].transform();
+			block_sprite->height = WORLD_HEIGHT * BLOCK_LONG;
+			block_sprite->width = WORLD_HEIGHT * BLOCK_THIN;
 		}
-		else if (i < 40)
+		else if (i < FIRST_EXPLOSIVE_BLOCK)
 		{
-			if (!blocks[i].addSpriteComponent(renderer.get(),
-				"Resources\\Textures\\kenney_physicspack\\PNG\\Stone elements\\elementStone004.png"))
+			if (!blocks[i].addSprite(asge_backend, game_atlas,
+				"elementStone004.png", LAYER_LEVEL))
 			{
 				return false;
 			}
-			ASGE::Sprite* block_sprite = blocks[i].spriteComponent()->getSprite();
-			block_sprite->height(game_height * BLOCK_NORMAL);
-			block_sprite->width(game_height * BLOCK_NORMAL);
+			Transform* block_sprite = &blocks[i].transform();
+			block_sprite->height = WORLD_HEIGHT * BLOCK_NORMAL;
+			block_sprite->width = WORLD_HEIGHT * BLOCK_NORMAL;
 		}
 		else if (i < NUM_BLOCKS)
 		{
-			if (!blocks[i].addSpriteComponent(renderer.get(),
-				"Resources\\Textures\\kenney_physicspack\\PNG\\Explosive elements\\elementExplosive011.png"))
+			if (!blocks[i].addSprite(asge_backend, game_atlas,
+				"elementExplosive011.png", LAYER_LEVEL))
 			{
 				return false;
 			}
-			ASGE::Sprite* block_sprite = blocks[i].spriteComponent()->getSprite();
-			block_sprite->height(game_height * BLOCK_NORMAL);
-			block_sprite->width(game_height * BLOCK_NORMAL);
+			Transform* block_sprite = &blocks[i].transform();
+			block_sprite->height = WORLD_HEIGHT * BLOCK_NORMAL;
+			block_sprite->width = WORLD_HEIGHT * BLOCK_NORMAL;
 		}
+
+		Material& material = world.materials.add(blocks[i].getId());
+		if (i >= FIRST_EXPLOSIVE_BLOCK)
+		{
+			material.type = MATERIAL_EXPLOSIVE;
+		}
+		else if (i >= FIRST_STONE_BLOCK)
+		{
+			material.type = MATERIAL_STONE;
+		}
+		else if (i >= FIRST_WOOD_BLOCK)
+		{
+			material.type = MATERIAL_WOOD;
+		}
+		blocks[i].setHealth(blockHealth(blocks[i]));
 		blocks[i].setVisible(false);
 	}
 
 	for (int i = 0; i < NUM_ENEMIES; i++)
 	{
-		if (!enemies[i].addSpriteComponent(renderer.get(), "Resources\\Textures\\kenney_animalpackredux\\PNG\\round\\pig.png"))
+		enemies[i].create(world);
+		if (!enemies[i].addSprite(asge_backend, game_atlas, "pig.png", LAYER_ENEMIES))
 		{
 			return false;
 		}
-		ASGE::Sprite* enemy_sprite = enemies[i].spriteComponent()->getSprite();
+		Transform* enemy_sprite = &enemies[i].transform();
 		if (i < 2)
 		{
-			enemy_sprite->height(game_height * ENEMY_MEDIUM);
-			enemy_sprite->width(game_height * ENEMY_MEDIUM);
+			enemy_sprite->height = WORLD_HEIGHT * ENEMY_MEDIUM;
+			enemy_sprite->width = WORLD_HEIGHT * ENEMY_MEDIUM;
 		}
 		else
 		{
-			enemy_sprite->height(game_height * ENEMY_SMALL);
-			enemy_sprite->width(game_height * ENEMY_SMALL);
+			enemy_sprite->height = WORLD_HEIGHT * ENEMY_SMALL;
+			enemy_sprite->width = WORLD_HEIGHT * ENEMY_SMALL;
 		}
+		Velocity& fall = world.velocities.add(enemies[i].getId());
+		fall.speed_scale = ENEMY_FALL_SCALE;
+		fall.gravity = ENEMY_GRAVITY;
+		enemies[i].setHealth(HEALTH_ENEMY);
 		enemies[i].setVisible(false);
 	}
 
-	for (int i = 0; i < NUM_PROJECTILES_SCATTER; i++)
+	// one sprite is shared by every sub projectile
+	if (!scatter_bird.load(asge_backend, game_atlas,
+		"chick.png"))
 	{
-		if (!projectiles_scatter[i].addSpriteComponent(renderer.get(),
-			"Resources\\Textures\\kenney_animalpackredux\\PNG\\Round\\chick.png"))
-		{
-			return false;
-		}
-		projectiles_scatter[i].setVisible(false);
-		ASGE::Sprite* projectile = projectiles_scatter[i].spriteComponent()->getSprite();
-		projectile->height(gameplay_area.height * (PROJECTILE_SIZE * 0.5f));
-		projectile->width(gameplay_area.length * (PROJECTILE_SIZE * 0.5f));
+		return false;
 	}
+	sub_projectiles.reserve(MAX_SUB_PROJECTILES);
 
 	for (int i = 0; i < NUM_PLATFORMS; i++)
 	{
-		if (!platforms[i].addSpriteComponent(renderer.get(),
-			"Resources\\Textures\\kenney_physicspack\\PNG\\Other\\dirt.png"))
+		platforms[i].create(world);
+		if (!platforms[i].addSprite(asge_backend, game_atlas,
+			"dirt.png", LAYER_LEVEL))
 		{
 			return false;
 		}
+		platforms[i].sprite().fixed = true;
 		platforms[i].setVisible(false);
-		ASGE::Sprite* projectile = projectiles_scatter[i].spriteComponent()->getSprite();
-		projectile->height(gameplay_area.height * BLOCK_NORMAL);
-		projectile->width(gameplay_area.length * PLATFORM_LONG);
+		Transform* platform = &platforms[i].transform();
+		platform->height = gameplay_area.height * BLOCK_NORMAL;
+		platform->width = gameplay_area.length * PLATFORM_LONG;
 	}
 
-	if (!bomb.addSpriteComponent(renderer.get(),
-		"Resources\\Textures\\kenney_physicspack\\PNG\\Other\\coinDiamond.png"))
+	// bombs are pooled effects sharing one sprite, and start falling
+	if (!bomb_picture.load(asge_backend, game_atlas,
+		"coinDiamond.png"))
 	{
 		return false;
 	}
-	bomb.setVisible(false);
-	ASGE::Sprite* bomb_sprite = bomb.spriteComponent()->getSprite();
-	bomb_sprite->height(gameplay_area.height * BOMB_SIZE);
-	bomb_sprite->width(gameplay_area.height * BOMB_SIZE);
+	EffectBody bomb;
+	bomb.transform.height = gameplay_area.height * BOMB_SIZE;
+	bomb.transform.width = gameplay_area.height * BOMB_SIZE;
+	bomb.velocity.y = 1.f;
+	bomb.velocity.speed_scale = BOMB_FALL_SCALE;
+	bombs.init(MAX_BOMBS, POOL_REJECT, bomb);
 
 
-	if (!projectiles[0].addSpriteComponent(renderer.get(),
-		"Resources\\Textures\\kenney_animalpackredux\\PNG\\Round\\duck.png"))
+	projectiles[0].create(world);
+	if (!projectiles[0].addSprite(asge_backend, game_atlas,
+		"duck.png", LAYER_PROJECTILES))
 	{
 		return false;
 	}
 	projectiles[0].setVisible(false);
-	ASGE::Sprite* projectile = projectiles[0].spriteComponent()->getSprite();
-	projectile->height(gameplay_area.height * PROJECTILE_SIZE);
-	projectile->width(gameplay_area.length * PROJECTILE_SIZE);
+	Transform* projectile = &projectiles[0].transform();
+	projectile->height = gameplay_area.height * PROJECTILE_SIZE;
+	projectile->width = gameplay_area.length * PROJECTILE_SIZE;
 
-	if (!projectiles[1].addSpriteComponent(renderer.get(),
-		"Resources\\Textures\\kenney_animalpackredux\\PNG\\Round\\owl.png"))
+	projectiles[1].create(world);
+	if (!projectiles[1].addSprite(asge_backend, game_atlas,
+		"owl.png", LAYER_PROJECTILES))
 	{
 		return false;
 	}
 	projectiles[1].setVisible(false);
-	projectile = projectiles[1].spriteComponent()->getSprite();
-	projectile->height(gameplay_area.height * PROJECTILE_SIZE);
-	projectile->width(gameplay_area.length * PROJECTILE_SIZE);
+	projectile = &projectiles[1].transform();
+	projectile->height = gameplay_area.height * PROJECTILE_SIZE;
+	projectile->width = gameplay_area.length * PROJECTILE_SIZE;
 
 
-	if (!projectiles[2].addSpriteComponent(renderer.get(),
-		"Resources\\Textures\\kenney_animalpackredux\\PNG\\Round\\penguin.png"))
+	projectiles[2].create(world);
+	if (!projectiles[2].addSprite(asge_backend, game_atlas,
+		"penguin.png", LAYER_PROJECTILES))
 	{
 		return false;
 	}
 	projectiles[2].setVisible(false);
-	projectile = projectiles[2].spriteComponent()->getSprite();
-	projectile->height(gameplay_area.height * PROJECTILE_SIZE);
-	projectile->width(gameplay_area.length * PROJECTILE_SIZE);
+	projectile = &projectiles[2].transform();
+	projectile->height = gameplay_area.height * PROJECTILE_SIZE;
+	projectile->width = gameplay_area.length * PROJECTILE_SIZE;
 
-	if (!projectiles[3].addSpriteComponent(renderer.get(),
-		"Resources\\Textures\\kenney_animalpackredux\\PNG\\Round\\chick.png"))
+	projectiles[3].create(world);
+	if (!projectiles[3].addSprite(asge_backend, game_atlas,
+		"chick.png", LAYER_PROJECTILES))
 	{
 		return false;
 	}
 	projectiles[3].setVisible(false);
-	projectile = projectiles[3].spriteComponent()->getSprite();
-	projectile->height(gameplay_area.height * (PROJECTILE_SIZE * 0.5f));
-	projectile->width(gameplay_area.length * (PROJECTILE_SIZE * 0.5f));
+	projectile = &projectiles[3].transform();
+	projectile->height = gameplay_area.height * (PROJECTILE_SIZE * 0.5f);
+	projectile->width = gameplay_area.length * (PROJECTILE_SIZE * 0.5f);
 
 
-	if (!projectiles[4].addSpriteComponent(renderer.get(),
-		"Resources\\Textures\\kenney_animalpackredux\\PNG\\Round\\parrot.png"))
+	projectiles[4].create(world);
+	if (!projectiles[4].addSprite(asge_backend, game_atlas,
+		"parrot.png", LAYER_PROJECTILES))
 	{
 		return false;
 	}
 	projectiles[4].setVisible(false);
-	projectile = projectiles[4].spriteComponent()->getSprite();
-	projectile->height(gameplay_area.height * PROJECTILE_SIZE);
-	projectile->width(gameplay_area.length * PROJECTILE_SIZE); 
+	projectile = &projectiles[4].transform();
+	projectile->height = gameplay_area.height * PROJECTILE_SIZE;
+	projectile->width = gameplay_area.length * PROJECTILE_SIZE; 
+
+	// launches set the velocity, so every bird gets one up front
+	for (int i = 0; i < NUM_PROJECTILES; i++)
+	{
+		world.velocities.add(projectiles[i].getId());
+	}
 	
-	if (!slingshot.addSpriteComponent(renderer.get(),
-		"Resources\\Textures\\Slingshot.png"))
+	slingshot.create(world);
+	if (!slingshot.addSprite(asge_backend, game_atlas,
+		"Slingshot.png", LAYER_SLINGSHOT))
 	{
 		return false;
 	}
 	slingshot.setVisible(false);
-	ASGE::Sprite* slingshot_sprite = slingshot.spriteComponent()->getSprite();
-	slingshot_sprite->height(game_height * SLINGSHOT_HEIGHT);
-	slingshot_sprite->width(game_height * SLINGSHOT_WIDTH);
+	Transform* slingshot_sprite = &slingshot.transform();
+	slingshot_sprite->height = WORLD_HEIGHT * SLINGSHOT_HEIGHT;
+	slingshot_sprite->width = WORLD_HEIGHT * SLINGSHOT_WIDTH;
 
 	return true;
 }
 
+/**
+*   @brief   Track active objects
+*   @details This function is used to give every level object and
+			 projectile a slot in the active list of its kind. The
+			 lists then follow the objects' visibility, so the update
+			 and render passes only walk the objects still in play.
+			 Level objects also get the collider the broadphase is
+			 built from, blocks first, then platforms, then pigs.
+			 What a hit on each does follows from its components
+*   @see     ActiveList, World::hitResponse
+*   @return  void
+*/
+void AngryBirdsGame::trackActiveObjects()
+{
+	active_blocks.reset(NUM_BLOCKS);
+	active_platforms.reset(NUM_PLATFORMS);
+	active_enemies.reset(NUM_ENEMIES);
+	active_projectiles.reset(NUM_PROJECTILES);
+	active_scratch.reserve(NUM_BLOCKS);
+	collision_objects.assign(world.size(), nullptr);
+	for (int i = 0; i < NUM_BLOCKS; i++)
+	{
+		blocks[i].setActiveList(&active_blocks, i);
+		world.colliders.add(blocks[i].getId());
+		collision_objects[blocks[i].getId()] = &blocks[i];
+	}
+	for (int i = 0; i < NUM_PLATFORMS; i++)
+	{
+		platforms[i].setActiveList(&active_platforms, i);
+		world.colliders.add(platforms[i].getId());
+		collision_objects[platforms[i].getId()] = &platforms[i];
+	}
+	for (int i = 0; i < NUM_ENEMIES; i++)
+	{
+		enemies[i].setActiveList(&active_enemies, i);
+		world.colliders.add(enemies[i].getId());
+		collision_objects[enemies[i].getId()] = &enemies[i];
+	}
+	for (int i = 0; i < NUM_PROJECTILES; i++)
+	{
+		projectiles[i].setActiveList(&active_projectiles, i);
+	}
+}
+
 /**
 *   @brief   Sets the grid positions for level setup
 *   @details This function is designed to create the grid positions for
@@ -459,8 +568,8 @@ void AngryBirdsGame::setupGrid()
 	{
 		grid_X[i] = newXpos;
 		grid_Y[i] = newYpos;
-		newXpos = newXpos + (game_height * BLOCK_THIN);
-		newYpos = newYpos - (game_height * BLOCK_THIN);
+		newXpos = newXpos + (WORLD_HEIGHT * BLOCK_THIN);
+		newYpos = newYpos - (WORLD_HEIGHT * BLOCK_THIN);
 	}
 }
 
@@ -649,28 +758,25 @@ void AngryBirdsGame::levelGen()
 
 /**
 *   @brief   Sets the game window resolution
-*   @details This function is designed to create the window size, any 
-             aspect ratio scaling factors and safe zones to ensure the 
-			 game frames when resolutions are changed in size.
+*   @details The window takes the size of the screen. The game is
+			 simulated in fixed world units whatever the resolution,
+			 and the view fits the world to the window when drawing.
 *   @return  void
 */
 void AngryBirdsGame::setupResolution()
 {
-	// how will you calculate the game's resolution?
-	// will it scale correctly in full screen? what AR will you use?
-	// how will the game be framed in native 16:9 resolutions?
-	// here are some abritrary values for you to adjust as you see fit
-	// https://www.gamasutra.com/blogs/KenanBolukbasi/20171002/306822/Scaling_and_MultiResolution_in_2D_Games.php
 	game_height = GetSystemMetrics(SM_CYSCREEN);
 	game_width = GetSystemMetrics(SM_CXSCREEN);
+	view.fit((float)game_width, (float)game_height, WORLD_WIDTH, WORLD_HEIGHT);
+	asge_backend.setView(view);
 }
 
 /**
 *   @brief   Processes any key inputs
 *   @details This function is added as a callback to handle the game's
-			 keyboard input. For this game, calls to this function
-			 are thread safe, so you may alter the game's state as you
-			 see fit.
+			 keyboard input. ASGE does not say which thread calls it
+			 or when, so the key is only queued here. Update takes the
+			 queue on the main thread and the next tick applies it.
 *   @param   data The event data relating to key input.
 *   @see     KeyEvent
 *   @return  void
@@ -678,29 +784,113 @@ void AngryBirdsGame::setupResolution()
 void AngryBirdsGame::keyHandler(const ASGE::SharedEventData data)
 {
 	auto key = static_cast<const ASGE::KeyEvent*>(data.get());
-	
-	if (key->key == ASGE::KEYS::KEY_ESCAPE)
+	InputEvent event;
+	event.key = key->key;
+	event.action = key->action;
+	event.mods = key->mods;
+
+	std::lock_guard<std::mutex> lock(input_mutex);
+	queued_inputs.push_back(event);
+}
+
+/**
+*   @brief   Processes any click inputs
+*   @details This function is added as a callback to handle the game's
+			 mouse button input. Like keys, the click is only queued
+			 with the cursor position it happened at, in screen pixels.
+*   @param   data The event data relating to click input.
+*   @see     ClickEvent
+*   @return  void
+*/
+void AngryBirdsGame::clickHandler(const ASGE::SharedEventData data)
+{
+	auto click = static_cast<const ASGE::ClickEvent*>(data.get());
+	double x_pos, y_pos;
+	inputs->getCursorPos(x_pos, y_pos);
+	InputEvent event;
+	event.click = true;
+	event.action = click->action;
+	event.x = (float)x_pos;
+	event.y = (float)y_pos;
+
+	std::lock_guard<std::mutex> lock(input_mutex);
+	queued_inputs.push_back(event);
+}
+
+/**
+*   @brief   Take Input
+*   @details Moves the queued events to the next tick. Work that
+			 belongs to the main thread, quitting and switching the
+			 window mode, is done here, and clicks are moved into
+			 world units by the view the screen is showing.
+*   @return  void
+*/
+void AngryBirdsGame::takeInput()
+{
+	tick_inputs.clear();
 	{
-		signalExit();
+		std::lock_guard<std::mutex> lock(input_mutex);
+		tick_inputs.swap(queued_inputs);
 	}
-	
-	if (key->key == ASGE::KEYS::KEY_ENTER &&
-		key->action == ASGE::KEYS::KEY_PRESSED &&
-		key->mods == 0x0004)
+
+	for (InputEvent& event : tick_inputs)
 	{
-		if (renderer->getWindowMode() == ASGE::Renderer::WindowMode::WINDOWED)
+		screen_changed = true;
+		if (event.click)
 		{
-			renderer->setWindowedMode(ASGE::Renderer::WindowMode::FULLSCREEN);
+			event.x = view.toWorldX(event.x);
+			event.y = view.toWorldY(event.y);
+			continue;
 		}
-		else
+
+		if (event.key == ASGE::KEYS::KEY_ESCAPE)
 		{
-			renderer->setWindowedMode(ASGE::Renderer::WindowMode::WINDOWED);
+			signalExit();
 		}
+
+		if (event.key == ASGE::KEYS::KEY_ENTER &&
+			event.action == ASGE::KEYS::KEY_PRESSED &&
+			event.mods == 0x0004)
+		{
+			if (renderer->getWindowMode() == ASGE::Renderer::WindowMode::WINDOWED)
+			{
+				renderer->setWindowedMode(ASGE::Renderer::WindowMode::FULLSCREEN);
+			}
+			else
+			{
+				renderer->setWindowedMode(ASGE::Renderer::WindowMode::WINDOWED);
+			}
+
+			// only the view follows the window, the world is untouched
+			setupResolution();
+		}
+	}
+}
+
+/**
+*   @brief   Apply Key
+*   @details Plays a queued key into the game. Runs in the tick, so
+			 the simulation is only ever changed by the tick job.
+*   @return  void
+*/
+void AngryBirdsGame::applyKey(const InputEvent& key)
+{
+	if (key.key == ASGE::KEYS::KEY_Z &&
+		key.action == ASGE::KEYS::KEY_RELEASED &&
+		game_state == IN_GAME && undo_ready && !aiming)
+	{
+		// takes back the last shot, and the level it finished if any
+		restoreSimulation(undo_shot);
+	}
+
+	if (key.key == ASGE::KEYS::KEY_GRAVE_ACCENT &&
+		key.action == ASGE::KEYS::KEY_RELEASED)
+	{
+		show_stats = !show_stats;
 	}
-		
 
-	if (key->key == ASGE::KEYS::KEY_SPACE &&
-		key->action == ASGE::KEYS::KEY_PRESSED
+	if (key.key == ASGE::KEYS::KEY_SPACE &&
+		key.action == ASGE::KEYS::KEY_PRESSED
 		&& game_state == IN_GAME && flying)
 	{
 		switch (projectile)
@@ -715,7 +905,7 @@ void AngryBirdsGame::keyHandler(const ASGE::SharedEventData data)
 		case 1:
 			if (!bomb_active)
 			{
-				rect pos = projectiles[projectile].spriteComponent()->getBoundingBox();
+				rect pos = projectiles[projectile].getBoundingBox();
 				bomb_active = true;
 				releaseBomb(pos);
 			}
@@ -730,7 +920,7 @@ void AngryBirdsGame::keyHandler(const ASGE::SharedEventData data)
 		case 3:
 			if (!scatter_active)
 			{
-				rect pos = projectiles[projectile].spriteComponent()->getBoundingBox();
+				rect pos = projectiles[projectile].getBoundingBox();
 				vector2 vel = projectiles[projectile].getVelocity();
 				scatter_active = true;
 				releaseProjectileScatter(pos, vel);
@@ -743,8 +933,8 @@ void AngryBirdsGame::keyHandler(const ASGE::SharedEventData data)
 
 	}
 
-	if (key->key == ASGE::KEYS::KEY_UP &&
-		key->action == ASGE::KEYS::KEY_RELEASED)
+	if (key.key == ASGE::KEYS::KEY_UP &&
+		key.action == ASGE::KEYS::KEY_RELEASED)
 	{
 		if (game_state == MAIN_SCREEN)
 		{
@@ -764,8 +954,8 @@ void AngryBirdsGame::keyHandler(const ASGE::SharedEventData data)
 			new_initials[initial] = new_initial;
 		}
 	}
-	if (key->key == ASGE::KEYS::KEY_DOWN &&
-		key->action == ASGE::KEYS::KEY_RELEASED)
+	if (key.key == ASGE::KEYS::KEY_DOWN &&
+		key.action == ASGE::KEYS::KEY_RELEASED)
 	{
 		if (game_state == MAIN_SCREEN)
 		{
@@ -786,8 +976,8 @@ void AngryBirdsGame::keyHandler(const ASGE::SharedEventData data)
 		}
 	}
 
-	if (key->key == ASGE::KEYS::KEY_ENTER &&
-		key->action == ASGE::KEYS::KEY_RELEASED)
+	if (key.key == ASGE::KEYS::KEY_ENTER &&
+		key.action == ASGE::KEYS::KEY_RELEASED)
 	{   //Main menu
 		if (game_state == MAIN_SCREEN)
 		{
@@ -796,6 +986,7 @@ void AngryBirdsGame::keyHandler(const ASGE::SharedEventData data)
 
 				game_state = IN_GAME;
 				new_game = true;
+				undo_ready = false;
 			}
 			if (menu_option == HIGH_SCORES)
 			{
@@ -836,8 +1027,8 @@ void AngryBirdsGame::keyHandler(const ASGE::SharedEventData data)
 
 	}
 
-	if (key->key == ASGE::KEYS::KEY_LEFT &&
-		key->action == ASGE::KEYS::KEY_PRESSED && 
+	if (key.key == ASGE::KEYS::KEY_LEFT &&
+		key.action == ASGE::KEYS::KEY_PRESSED && 
 		game_state == NEW_HIGH_SCORE)
 	{
 		initial -= 1;
@@ -847,8 +1038,8 @@ void AngryBirdsGame::keyHandler(const ASGE::SharedEventData data)
 		}
 		new_initial = new_initials[initial];
 	}
-	if (key->key == ASGE::KEYS::KEY_RIGHT &&
-		key->action == ASGE::KEYS::KEY_PRESSED && 
+	if (key.key == ASGE::KEYS::KEY_RIGHT &&
+		key.action == ASGE::KEYS::KEY_PRESSED && 
 		game_state == NEW_HIGH_SCORE)
 	{
 		initial += 1;
@@ -861,60 +1052,58 @@ void AngryBirdsGame::keyHandler(const ASGE::SharedEventData data)
 }
 
 /**
-*   @brief   Processes any click inputs
-*   @details This function is added as a callback to handle the game's
-		     mouse button input. For this game, calls to this function
-             are thread safe, so you may alter the game's state as you
-             see fit.
-*   @param   data The event data relating to key input.
-*   @see     ClickEvent
+*   @brief   Apply Click
+*   @details Plays a queued click into the game. Runs in the tick,
+			 with the click position already in world units.
 *   @return  void
 */
-void AngryBirdsGame::clickHandler(const ASGE::SharedEventData data)
+void AngryBirdsGame::applyClick(const InputEvent& click)
 {
-	auto click = static_cast<const ASGE::ClickEvent*>(data.get());
-	double x_pos, y_pos;
-	inputs->getCursorPos(x_pos, y_pos);
-
 	rect mousePointer;
-	mousePointer.x = x_pos;
-	mousePointer.y = y_pos;
+	mousePointer.x = click.x;
+	mousePointer.y = click.y;
 	for (int i = 0; i < NUM_PROJECTILES; i++)
 	{
-		rect projectile_rect = projectiles[i].spriteComponent()->getBoundingBox();
-		if (mousePointer.isInside(projectile_rect) && click->action == 0 &&
+		rect projectile_rect = projectiles[i].getBoundingBox();
+		if (mousePointer.isInside(projectile_rect) && click.action == 0 &&
 			i != projectile && aiming == false && !flying)
 		{
-			ASGE::Sprite* tempProjectile = projectiles[i].spriteComponent()->getSprite();
-			ASGE::Sprite* tempProjectileTwo = projectiles[projectile].spriteComponent()->getSprite();
+			Transform* tempProjectile = &projectiles[i].transform();
+			Transform* tempProjectileTwo = &projectiles[projectile].transform();
 
-			float xTemp = tempProjectile->xPos();
-			float yTemp = tempProjectile->yPos();
+			float xTemp = tempProjectile->x;
+			float yTemp = tempProjectile->y;
 			if (i == 3)
 			{
-				yTemp -= tempProjectile->height();
+				yTemp -= tempProjectile->height;
 			}
-			tempProjectile->xPos(tempProjectileTwo->xPos());
-			tempProjectile->yPos(tempProjectileTwo->yPos());
+			tempProjectile->x = tempProjectileTwo->x;
+			tempProjectile->y = tempProjectileTwo->y;
 			if (projectile == 3)
 			{
-				yTemp += tempProjectileTwo->height();
+				yTemp += tempProjectileTwo->height;
 			}
-			tempProjectileTwo->xPos(xTemp);
-			tempProjectileTwo->yPos(yTemp);
+			tempProjectileTwo->x = xTemp;
+			tempProjectileTwo->y = yTemp;
 			projectile = i;
 			i = NUM_PROJECTILES;
 		}
-		if (mousePointer.isInside(projectile_rect) && click->action == 1 &&
+		if (mousePointer.isInside(projectile_rect) && click.action == 1 &&
 			i == projectile) {
+			if (!flying)
+			{
+				// the game as it stood before the shot, for undo
+				saveSimulation(undo_shot);
+				undo_ready = true;
+			}
 			aiming = true;
 		}
 	}
 	if (aiming)
 	{
-		if (click->action == 0) {
+		if (click.action == 0) {
 			aiming = false;
-			rect temp_projectile_sprite = projectiles[projectile].spriteComponent()->getBoundingBox();
+			rect temp_projectile_sprite = projectiles[projectile].getBoundingBox();
 			projectiles[projectile].setVelocity(slingshot_center.getX() -
 				temp_projectile_sprite.x, slingshot_center.getY() - temp_projectile_sprite.y);
 			flying = true;
@@ -924,26 +1113,85 @@ void AngryBirdsGame::clickHandler(const ASGE::SharedEventData data)
 
 /**
 *   @brief   Updates the scene
-*   @details Prepares the renderer subsystem before drawing the
-		     current frame. Once the current frame is has finished
-		     the buffers are swapped accordingly and the image shown.
+*   @details Waits until the frame is due for the current screen, then
+			 submits the next simulation tick as a job and returns,
+			 so the tick runs while render draws the previous one. The
+			 cursor is read here, as the input system belongs to the
+			 main thread, and moved into world units. Work the last
+			 tick left for the main thread, such as loading the
+			 background of a new level, is run first.
+*   @see     JobSystem
 *   @return  void
 */
 void AngryBirdsGame::update(const ASGE::GameTime& us)
+{
+	pacer.setFrameRate(frameRate());
+	pacer.wait();
+
+	// no tick is running here, so the renderer is free to load
+	jobs.runMainJobs();
+	takeInput();
+
+	// static screens only need recording again after input or a
+	// change of screen, until then the last snapshot is redrawn.
+	// The overlay counts change every frame, so it keeps them ticking
+	ticking = game_state == SPLASH_SCREEN || game_state == IN_GAME ||
+		screen_changed || game_state != recorded_state || show_stats;
+	if (!ticking)
+	{
+		return;
+	}
+	screen_changed = false;
+
+	// the last draw finished in render, and the next starts after this
+	shown_draw_calls = asge_backend.drawCalls();
+	shown_batches = asge_backend.textureSwitches();
+
+	double x_pos, y_pos;
+	inputs->getCursorPos(x_pos, y_pos);
+	cursor_x = view.toWorldX((float)x_pos);
+	cursor_y = view.toWorldY((float)y_pos);
+	tick_time = us;
+	tick_job = jobs.submit([this]()
+	{
+		simulate(tick_time);
+		record();
+	});
+}
+
+/**
+*   @brief   Simulate
+*   @details Advances the game by one tick, after applying the input
+			 taken by update. Runs as the tick job, using the cursor
+			 position read by update
+*   @return  void
+*/
+void AngryBirdsGame::simulate(const ASGE::GameTime& us)
 {
 	auto dt_sec = us.delta_time.count() / 1000.0; 
+	for (const InputEvent& event : tick_inputs)
+	{
+		if (event.click)
+		{
+			applyClick(event);
+		}
+		else
+		{
+			applyKey(event);
+		}
+	}
+
 	if (game_state == SPLASH_SCREEN)
 	{
 
-		splash_screen->width((float)splash_screen->width() +
-			(((float)game_width * 0.5f) * 0.3f)	* (float)(us.delta_time.count() / 1000.f));
-		splash_screen->height((float)splash_screen->height() +
-			(((float)game_height * 0.5f) * 0.3f)	* (float)(us.delta_time.count() / 1000.f));
-		splash_screen->xPos(((float)game_width * 0.5f) -
-			(splash_screen->width() * 0.5f));
-		splash_screen->yPos(((float)game_height * 0.5f) -
-			(splash_screen->height() * 0.5f));
-		if (splash_screen->xPos() < 0.f)
+		Transform* splash_sprite = &splash_screen.transform;
+		splash_sprite->width = splash_sprite->width +
+			((WORLD_WIDTH * 0.5f) * 0.3f)	* (float)(us.delta_time.count() / 1000.f);
+		splash_sprite->height = splash_sprite->height +
+			((WORLD_HEIGHT * 0.5f) * 0.3f)	* (float)(us.delta_time.count() / 1000.f);
+		splash_sprite->x = (WORLD_WIDTH * 0.5f) - (splash_sprite->width * 0.5f);
+		splash_sprite->y = (WORLD_HEIGHT * 0.5f) - (splash_sprite->height * 0.5f);
+		if (splash_sprite->x < 0.f)
 		{
 			game_state = MAIN_SCREEN;
 		}
@@ -955,97 +1203,72 @@ void AngryBirdsGame::update(const ASGE::GameTime& us)
 			newGame();
 		}
 
-		double x_pos, y_pos;
-		inputs->getCursorPos(x_pos, y_pos);
 		if (aiming)
 		{
-			ASGE::Sprite* temp_projectile_sprite = projectiles[projectile].spriteComponent()->getSprite();
-			temp_projectile_sprite->xPos(x_pos);
-			temp_projectile_sprite->yPos(y_pos);
-			if (temp_projectile_sprite->xPos() < aiming_area.x)
+			Transform* temp_projectile_sprite = &projectiles[projectile].transform();
+			temp_projectile_sprite->x = cursor_x;
+			temp_projectile_sprite->y = cursor_y;
+			if (temp_projectile_sprite->x < aiming_area.x)
 			{
-				temp_projectile_sprite->xPos(aiming_area.x);
+				temp_projectile_sprite->x = aiming_area.x;
 			}
-			if (temp_projectile_sprite->xPos() > aiming_area.x + aiming_area.length)
+			if (temp_projectile_sprite->x > aiming_area.x + aiming_area.length)
 			{
-				temp_projectile_sprite->xPos(aiming_area.x + aiming_area.length);
+				temp_projectile_sprite->x = aiming_area.x + aiming_area.length;
 			}
-			if (temp_projectile_sprite->yPos() < aiming_area.y)
+			if (temp_projectile_sprite->y < aiming_area.y)
 			{
-				temp_projectile_sprite->yPos(aiming_area.y);
+				temp_projectile_sprite->y = aiming_area.y;
 			}
-			if (temp_projectile_sprite->yPos() > aiming_area.y + aiming_area.height)
+			if (temp_projectile_sprite->y > aiming_area.y + aiming_area.height)
 			{
-				temp_projectile_sprite->yPos(aiming_area.y + aiming_area.height);
+				temp_projectile_sprite->y = aiming_area.y + aiming_area.height;
 			}
 		}
 		enemyCollision();
-		for (int i = 0; i < NUM_ENEMIES; i++)
+		world.integrate(dt_sec);
+		for (int i = 0; i < bombs.size(); i++)
 		{
-			if (enemies[i].getVisible())
-			{
-				ASGE::Sprite* enemySprite = enemies[i].spriteComponent()->getSprite();
-				vector2 enemyVel = enemies[i].getVelocity();
-				enemySprite->yPos(enemySprite->yPos() + enemyVel.getY() * 50.f *
-					(us.delta_time.count() / 1000.f));
-
-				enemies[i].setVelocity(enemyVel.getX(), (enemyVel.getY() + 20.f * (us.delta_time.count() / 1000.f)));
-			}
+			integrateBody(bombs[i].transform, bombs[i].velocity, dt_sec);
 		}
+		refreshBroadphase();
 		if (flying)
 		{
 			projectileCollision();
 			levelCollision();
-			vector2 projectile_vel = projectiles[projectile].getVelocity();
-			ASGE::Sprite* temp_projectile_sprite = projectiles[projectile].spriteComponent()->getSprite();
-			temp_projectile_sprite->yPos((float)temp_projectile_sprite->yPos() +
-				((projectile_vel.getY() * 5.f) *
-				(us.delta_time.count() / 1000.f)));
-			temp_projectile_sprite->xPos((float)temp_projectile_sprite->xPos() +
-				((projectile_vel.getX() * 5.f) *
-				(us.delta_time.count() / 1000.f)));
-			projectiles[projectile].setVelocity(projectile_vel.getX() - 
-				(projectile_vel.getX() * (0.05f * (us.delta_time.count() / 1000.f))),
-				(projectile_vel.getY() + 8.f * (us.delta_time.count() / 1000.f)));
-			temp_projectile_sprite->rotationInRadians(
-				temp_projectile_sprite->rotationInRadians() +
-				(1 * (us.delta_time.count() / 1000.f)));
+			// the flight path is solved exactly, so the result does
+			// not depend on the frame rate
+			Transform* temp_projectile_sprite = &projectiles[projectile].transform();
+#ifdef DETERMINISTIC_PHYSICS
+			FixedFlightStep step((float)dt_sec);
+			Velocity& projectile_vel = world.velocities.get(projectiles[projectile].getId());
+			step.apply(temp_projectile_sprite->x, temp_projectile_sprite->y,
+				projectile_vel.x, projectile_vel.y);
+#else
+			Trajectory flight(temp_projectile_sprite->x, temp_projectile_sprite->y,
+				projectiles[projectile].getVelocity());
+			vector2 projectile_pos = flight.positionAt((float)dt_sec);
+			vector2 projectile_vel = flight.velocityAt((float)dt_sec);
+			temp_projectile_sprite->x = projectile_pos.getX();
+			temp_projectile_sprite->y = projectile_pos.getY();
+			projectiles[projectile].setVelocity(projectile_vel.getX(), projectile_vel.getY());
+#endif
+			temp_projectile_sprite->rotation = 
+				temp_projectile_sprite->rotation +
+				(1 * (us.delta_time.count() / 1000.f));
 			
-			for (int i = 0; i < NUM_PROJECTILES_SCATTER; i++)
+			if (sub_projectiles.size() > 0)
 			{
-				if (projectiles_scatter[i].getVisible())
-				{
-					vector2 projectile_scatter_vel = projectiles_scatter[i].getVelocity();
-					ASGE::Sprite* temp_projectile_scatter_sprite =
-						projectiles_scatter[i].spriteComponent()->getSprite();
-					temp_projectile_scatter_sprite->yPos(
-						(float)temp_projectile_scatter_sprite->yPos() +
-						((projectile_scatter_vel.getY() * 5.f) *
-						(us.delta_time.count() / 1000.f)));
-					temp_projectile_scatter_sprite->xPos(
-						(float)temp_projectile_scatter_sprite->xPos() +
-						((projectile_scatter_vel.getX() * 5.f) *
-						(us.delta_time.count() / 1000.f)));
-					projectiles[projectile].setVelocity(projectile_scatter_vel.getX() -
-						(projectile_scatter_vel.getX() *
-						(0.05f * (us.delta_time.count() / 1000.f))),
-							(projectile_scatter_vel.getY() + 8.f *
-						(us.delta_time.count() / 1000.f)));
-					temp_projectile_scatter_sprite->rotationInRadians(
-						temp_projectile_scatter_sprite->rotationInRadians() +
-						(1 * (us.delta_time.count() / 1000.f)));
-				}
+				subProjectileCollision();
+				sub_projectiles.integrate((float)dt_sec);
 			}
 		}
-		if (bomb.getVisible())
+		if (bombs.size() > 0)
 		{
 			bombCollision();
-
-			vector2 bomb_vel = bomb.getVelocity();
-			ASGE::Sprite* temp_bomb_sprite = bomb.spriteComponent()->getSprite();
-			temp_bomb_sprite->yPos((float)temp_bomb_sprite->yPos() +
-				((bomb_vel.getY() * 5.f) * (us.delta_time.count() / 1000.f)));
 		}
+		debris.update((float)dt_sec);
+		debrisCollision();
 
 	}
 
@@ -1072,6 +1295,11 @@ void AngryBirdsGame::update(const ASGE::GameTime& us)
 			}
 		}
 		no_enemies_hit = 0;
+		// textures can only be loaded on the main thread
+		if (level != background_level)
+		{
+			jobs.submitMain([this]() { loadLevelBackground(); });
+		}
 	}
 
 
@@ -1079,15 +1307,260 @@ void AngryBirdsGame::update(const ASGE::GameTime& us)
 
 /**
 *   @brief   Renders the scene
-*   @details Renders all the game objects to the current frame.
-Once the current frame is has finished the buffers are
-swapped accordingly and the image shown.
+*   @details Hands the snapshot published by the last tick to the
+			 render backend while the tick job runs the next one,
+			 then waits for that tick and publishes its snapshot.
+			 Frames are shown one tick after they were simulated. When
+			 update started no tick, the snapshot is kept and redrawn.
 *   @return  void
 */
 void AngryBirdsGame::render(const ASGE::GameTime &)
 {
-	renderer->setFont(0);
+	render_backend->draw(front_buffer);
+	if (ticking)
+	{
+		jobs.wait(tick_job);
+		publishSnapshot();
+	}
+}
+
+/**
+*   @brief   Publish Snapshot
+*   @details Swaps the buffers recorded by the last tick with the
+			 ones just drawn. Only called while no tick is running.
+			 The frame is pointed at the static layer that
+			 now sits beside it.
+*   @return  void
+*/
+void AngryBirdsGame::publishSnapshot()
+{
+	std::swap(draw_buffer, front_buffer);
+	std::swap(static_layer, front_static);
+	std::swap(static_version, front_static_version);
+	if (front_buffer.getStaticLayer() != nullptr)
+	{
+		front_buffer.setStaticLayer(&front_static);
+	}
+}
+
+/**
+*   @brief   Frame Rate
+*   @details Gameplay runs uncapped, the splash screen animates at a
+			 steady rate and the other screens are static, so they are
+			 paced lower to leave the machine idle while they show.
+*   @return  int
+*/
+int AngryBirdsGame::frameRate() const
+{
+	switch (game_state)
+	{
+	case IN_GAME:
+		return FRAME_RATE_IN_GAME;
+	case SPLASH_SCREEN:
+		return FRAME_RATE_SPLASH;
+	default:
+		return FRAME_RATE_MENU;
+	}
+}
+
+/**
+*   @brief   Save Simulation
+*   @details Copies everything a tick reads or writes into the
+			 snapshot. Derived state, such as the broadphase, is left
+			 out and rebuilt on restore. Must not run alongside a
+			 tick, so only between ticks or from inside one.
+*   @see     Snapshot
+*   @return  void
+*/
+void AngryBirdsGame::saveSimulation(Snapshot& snapshot) const
+{
+	snapshot.clear();
+	world.save(snapshot);
+	sub_projectiles.save(snapshot);
+	bombs.save(snapshot);
+	explosions.save(snapshot);
+	debris.save(snapshot);
+	active_blocks.save(snapshot);
+	active_platforms.save(snapshot);
+	active_enemies.save(snapshot);
+	active_projectiles.save(snapshot);
+	snapshot.writeArray(level_map, NUM_BLOCKS);
+	snapshot.write(aiming_area);
+	snapshot.write(slingshot_center);
+	snapshot.write(game_state);
+	snapshot.write(level);
+	snapshot.write(projectile);
+	snapshot.write(current_score);
+	snapshot.write(no_enemies_hit);
+	snapshot.write(projectiles_left);
+	snapshot.write(new_game);
+	snapshot.write(aiming);
+	snapshot.write(flying);
+	snapshot.write(exploding);
+	snapshot.write(bomb_active);
+	snapshot.write(scatter_active);
+	snapshot.write(boost_active);
+	snapshot.write(wind_active);
+	snapshot.write(random);
+}
+
+/**
+*   @brief   Restore Simulation
+*   @details Puts the game back to the state a snapshot was taken in,
+			 reading it in the order it was saved, and rebuilds the
+			 broadphase over the restored level. Entities are created
+			 once when the game starts, so the handles the game keeps
+			 still refer to the same objects. A background it brings
+			 back is loaded on the main thread. Must not run alongside
+			 a tick, so only between ticks or from inside one.
+*   @see     Snapshot
+*   @return  bool, false if the snapshot did not hold a whole game
+*/
+bool AngryBirdsGame::restoreSimulation(const Snapshot& snapshot)
+{
+	SnapshotReader reader(snapshot);
+	world.restore(reader);
+	sub_projectiles.restore(reader);
+	bombs.restore(reader);
+	explosions.restore(reader);
+	debris.restore(reader);
+	active_blocks.restore(reader);
+	active_platforms.restore(reader);
+	active_enemies.restore(reader);
+	active_projectiles.restore(reader);
+	reader.readArray(level_map, NUM_BLOCKS);
+	reader.read(aiming_area);
+	reader.read(slingshot_center);
+	reader.read(game_state);
+	reader.read(level);
+	reader.read(projectile);
+	reader.read(current_score);
+	reader.read(no_enemies_hit);
+	reader.read(projectiles_left);
+	reader.read(new_game);
+	reader.read(aiming);
+	reader.read(flying);
+	reader.read(exploding);
+	reader.read(bomb_active);
+	reader.read(scatter_active);
+	reader.read(boost_active);
+	reader.read(wind_active);
+	reader.read(random);
+
+	refreshBroadphase();
+	layout_version++;
+	if (level != background_level)
+	{
+		jobs.submitMain([this]() { loadLevelBackground(); });
+	}
+	screen_changed = true;
+	return reader.finished();
+}
 
+/**
+*   @brief   Check Snapshot
+*   @details Starts a level and sends the bird flying into a block,
+			 then saves the game mid-flight. The ticks after that are
+			 played, the snapshot is restored and they are played
+			 again. Each tick's state is saved and hashed, and the
+			 second run must hash the same as the first at every tick.
+			 The block has to shatter, so the debris and the random
+			 numbers it draws are part of what is compared.
+*   @see     Snapshot
+*   @return  bool
+*/
+bool AngryBirdsGame::checkSnapshot(std::ostream& out)
+{
+	using Clock = std::chrono::high_resolution_clock;
+	jobs.wait(tick_job);
+	game_state = IN_GAME;
+	newGame();
+
+	int target = active_blocks.size() > 0 ? active_blocks[0] : 0;
+	rect block = blocks[target].getBoundingBox();
+	Transform& bird = projectiles[projectile].transform();
+	bird.x = block.x - bird.width - SNAPSHOT_CHECK_LEAD;
+	bird.y = block.y + (block.height - bird.height) * 0.5f;
+	projectiles[projectile].setVelocity(SNAPSHOT_CHECK_SPEED, 0.f);
+	flying = true;
+
+	ASGE::GameTime step;
+	step.delta_time = std::chrono::duration<double, std::milli>(1000.0 / 60.0);
+	simulate(step);
+
+	// the first save grows the buffer, the one timed reuses it
+	Snapshot saved;
+	saveSimulation(saved);
+	Clock::time_point start = Clock::now();
+	saveSimulation(saved);
+	std::chrono::duration<double, std::micro> save_us = Clock::now() - start;
+
+	Snapshot state;
+	std::vector<uint64_t> hashes(SNAPSHOT_CHECK_TICKS);
+	int shattered = 0;
+	for (int run = 0; run < 2; run++)
+	{
+		if (run == 1)
+		{
+			start = Clock::now();
+			restoreSimulation(saved);
+		}
+		std::chrono::duration<double, std::micro> restore_us = Clock::now() - start;
+
+		int differs = -1;
+		for (int tick = 0; tick < SNAPSHOT_CHECK_TICKS; tick++)
+		{
+			simulate(step);
+			saveSimulation(state);
+			uint64_t hash = 14695981039346656037ull;
+			for (size_t i = 0; i < state.size(); i++)
+			{
+				hash ^= (unsigned char)state.data()[i];
+				hash *= 1099511628211ull;
+			}
+			if (run == 0)
+			{
+				hashes[tick] = hash;
+				shattered = debris.size() > shattered ? debris.size() : shattered;
+			}
+			else if (differs < 0 && hashes[tick] != hash)
+			{
+				differs = tick;
+			}
+		}
+
+		if (run == 0)
+		{
+			out << saved.size() << " byte snapshot saved in " << save_us.count() <<
+				" us, " << shattered << " debris fragments at most\n";
+			continue;
+		}
+		out << "restored in " << restore_us.count() << " us, replay of " <<
+			SNAPSHOT_CHECK_TICKS << " ticks ";
+		if (differs < 0)
+		{
+			out << "hashes the same\n";
+		}
+		else
+		{
+			out << "DIFFERS from tick " << differs << "\n";
+		}
+		return differs < 0 && shattered > 0;
+	}
+	return false;
+}
+
+/**
+*   @brief   Record
+*   @details Records the current screen into the draw buffer, sorted
+			 and ready for the render backend. Runs in the tick job at
+			 the end of each tick.
+*   @return  void
+*/
+void AngryBirdsGame::record()
+{
+	draw_buffer.begin();
+	recorded_state = game_state;
 	if (game_state == SPLASH_SCREEN)
 	{
 		renderSplash();
@@ -1121,6 +1594,45 @@ void AngryBirdsGame::render(const ASGE::GameTime &)
 		renderHighScores();
 	}
 
+	if (show_stats)
+	{
+		renderStats();
+	}
+	draw_buffer.sort();
+}
+
+/**
+*   @brief   Render Stats
+*   @details Draws the debug overlay in the bottom left corner, below
+			 the play area. Shows how many draws and batches the last
+			 frame took, a batch being a run of draws from one texture,
+			 then what the bomb and sub projectile pools and the
+			 explosion queue have had to turn away.
+*   @return  void
+*/
+void AngryBirdsGame::renderStats()
+{
+	char line[STATS_LINE_LENGTH];
+	snprintf(line, STATS_LINE_LENGTH, "draws %d batches %d",
+		shown_draw_calls, shown_batches);
+	draw_buffer.text(text_cache.text(TEXT_DRAW_STATS, line),
+		WORLD_WIDTH * 0.01f, WORLD_HEIGHT * 0.925f,
+		WORLD_HEIGHT * 0.0015f, ASGE::COLOURS::WHITE, LAYER_TEXT);
+
+	const PoolStats& bomb_stats = bombs.getStats();
+	snprintf(line, STATS_LINE_LENGTH, "bombs live %d peak %d refused %d",
+		bomb_stats.live, bomb_stats.peak, bomb_stats.rejected);
+	draw_buffer.text(text_cache.text(TEXT_BOMB_STATS, line),
+		WORLD_WIDTH * 0.01f, WORLD_HEIGHT * 0.955f,
+		WORLD_HEIGHT * 0.0015f, ASGE::COLOURS::WHITE, LAYER_TEXT);
+
+	const PoolStats& scatter_stats = sub_projectiles.getStats();
+	snprintf(line, STATS_LINE_LENGTH, "scatter live %d peak %d refused %d blasts dropped %d",
+		scatter_stats.live, scatter_stats.peak, scatter_stats.rejected,
+		explosions.getDropped());
+	draw_buffer.text(text_cache.text(TEXT_SCATTER_STATS, line),
+		WORLD_WIDTH * 0.01f, WORLD_HEIGHT * 0.985f,
+		WORLD_HEIGHT * 0.0015f, ASGE::COLOURS::WHITE, LAYER_TEXT);
 }
 
 
@@ -1132,8 +1644,8 @@ void AngryBirdsGame::render(const ASGE::GameTime &)
 */
 void AngryBirdsGame::renderSplash()
 {
-	renderer->setClearColour(ASGE::COLOURS::BLACK);
-	renderer->renderSprite(*splash_screen);
+	draw_buffer.clearColour(ASGE::COLOURS::BLACK);
+	draw_buffer.sprite(splash_screen.transform, splash_screen.sprite, LAYER_BACKGROUND);
 }
 
 /**
@@ -1146,21 +1658,22 @@ void AngryBirdsGame::renderMainMenu()
 {
 
 	// Set Background colour
-	renderer->setClearColour(ASGE::COLOURS::MIDNIGHTBLUE);
-	renderer->renderSprite(*menu_layer.spriteComponent()->getSprite());
+	draw_buffer.clearColour(ASGE::COLOURS::MIDNIGHTBLUE);
+	draw_buffer.sprite(menu_layer.transform, menu_layer.sprite, LAYER_BACKGROUND);
 	// renders the main menu text
-	renderer->renderText(
-		"WELCOME TO ANGRY BIRDS \n Press Esc to quit at any time.", game_width * 0.2f,
-		game_height * 0.15f, game_height * 0.002f, ASGE::COLOURS::DARKORANGE);
+	draw_buffer.text(text_cache.text(TEXT_TITLE,
+		"WELCOME TO ANGRY BIRDS \n Press Esc to quit at any time."), WORLD_WIDTH * 0.2f,
+		WORLD_HEIGHT * 0.15f, WORLD_HEIGHT * 0.002f, ASGE::COLOURS::DARKORANGE, LAYER_TEXT);
 
-	renderer->renderText(menu_option == 0 ? ">PLAY" : "PLAY", game_width * 0.2f,
-		game_height * 0.3f, game_height * 0.002f, ASGE::COLOURS::WHITESMOKE);
+	draw_buffer.text(text_cache.text(TEXT_PLAY, menu_option == 0 ? ">PLAY" : "PLAY"), WORLD_WIDTH * 0.2f,
+		WORLD_HEIGHT * 0.3f, WORLD_HEIGHT * 0.002f, ASGE::COLOURS::WHITESMOKE, LAYER_TEXT);
 
-	renderer->renderText(menu_option == 1 ? ">HIGH SCORES" : "HIGH SCORES", game_width * 0.2f,
-		game_height * 0.4f, game_height * 0.002f, ASGE::COLOURS::WHITESMOKE);
+	draw_buffer.text(text_cache.text(TEXT_HIGH_SCORES_OPTION,
+		menu_option == 1 ? ">HIGH SCORES" : "HIGH SCORES"), WORLD_WIDTH * 0.2f,
+		WORLD_HEIGHT * 0.4f, WORLD_HEIGHT * 0.002f, ASGE::COLOURS::WHITESMOKE, LAYER_TEXT);
 
-	renderer->renderText(menu_option == 2 ? ">QUIT" : "QUIT", game_width * 0.2f,
-		game_height * 0.5f, game_height * 0.002f, ASGE::COLOURS::WHITESMOKE);
+	draw_buffer.text(text_cache.text(TEXT_QUIT, menu_option == 2 ? ">QUIT" : "QUIT"), WORLD_WIDTH * 0.2f,
+		WORLD_HEIGHT * 0.5f, WORLD_HEIGHT * 0.002f, ASGE::COLOURS::WHITESMOKE, LAYER_TEXT);
 
 
 
@@ -1169,79 +1682,55 @@ void AngryBirdsGame::renderMainMenu()
 
 /**
 *   @brief   In Game Screen
-*   @details This function is used todisplay the main menu
-*   @see     KeyEvent
+*   @details Records every visible sprite on its layer. Sprites that
+			 do not move during a level go into the static layer, which
+			 is only recorded again when the layout changes. Backends
+			 able to render offscreen composite it once and reuse it
+			 until it changes. The buffer is sorted by layer and texture
+			 before it is drawn, so the level batches in a few draws.
+			 Text is drawn on top
+*   @see     DrawBuffer
 *   @return  void
 */
 void AngryBirdsGame::renderInGame()
 {
-	renderer->renderSprite(*level_layer[level].spriteComponent()->getSprite());
-	
-	renderer->renderText("Score: ",
-		(game_width * 0.60f), (game_height * 0.088f),
-		game_height * 0.002f, ASGE::COLOURS::DARKORANGE);
-	std::string score_string = std::to_string(current_score);
-	renderer->renderText(score_string.c_str(),
-		(game_width * 0.73f), (game_height * 0.088f),
-		game_height * 0.002f, ASGE::COLOURS::DARKORANGE);
-
-	std::string life_string = std::to_string(NUM_ENEMIES - no_enemies_hit);
-	rect enemy_counter_sprite = enemy_counter.spriteComponent()->getBoundingBox();
-	renderer->renderText(life_string.c_str(),
-		(enemy_counter_sprite.x + (enemy_counter_sprite.length * 1.02f)),
-		(enemy_counter_sprite.y + (enemy_counter_sprite.height * 0.95f)),
-		game_height * 0.0025f, ASGE::COLOURS::DARKORANGE);
-
-
-	if (bomb.getVisible() == true)
+	// the background and platforms only change between levels
+	if (static_version != layout_version && front_static_version == layout_version)
 	{
-		renderer->renderSprite(*bomb.spriteComponent()->getSprite());
+		// copied with its revision, so backends keep what they made of it
+		static_layer = front_static;
+		static_version = layout_version;
 	}
-	for (int i = 0; i < NUM_PROJECTILES_SCATTER; i++)
+	else if (static_version != layout_version)
 	{
-		if (projectiles_scatter[i].getVisible() == true)
-		{
-			renderer->renderSprite(*projectiles_scatter[i].spriteComponent()->getSprite());
-		}
-
+		static_layer.begin();
+		static_layer.sprite(level_layer.transform, level_layer.sprite, LAYER_BACKGROUND);
+		world.render(static_layer, true);
+		static_layer.sort();
+		static_version = layout_version;
 	}
-	for (int i = 0; i < NUM_PROJECTILES; i++)
-	{
-		if (projectiles[i].getVisible() == true)
-		{
-			renderer->renderSprite(*projectiles[i].spriteComponent()->getSprite());
-		}
+	draw_buffer.setStaticLayer(&static_layer);
 
-	}
-
-	for (int i = 0; i < NUM_BLOCKS; i++)
+	world.render(draw_buffer, false);
+	for (int i = 0; i < bombs.size(); i++)
 	{
-		if (blocks[i].getVisible() == true)
-		{
-			renderer->renderSprite(*blocks[i].spriteComponent()->getSprite());
-		}
-
+		draw_buffer.sprite(bombs[i].transform, bomb_picture.sprite, LAYER_PROJECTILES);
 	}
-	for (int i = 0; i < NUM_PLATFORMS; i++)
-	{
-		if (platforms[i].getVisible() == true)
-		{
-			renderer->renderSprite(*platforms[i].spriteComponent()->getSprite());
-		}
+	sub_projectiles.render(draw_buffer, scatter_bird.sprite, LAYER_PROJECTILES);
+	debris.render(draw_buffer, LAYER_DEBRIS);
 
-	}
-	for (int i = 0; i < NUM_ENEMIES; i++)
-	{
-		if (enemies[i].getVisible() == true)
-		{
-			renderer->renderSprite(*enemies[i].spriteComponent()->getSprite());
-		}
+	draw_buffer.text(text_cache.text(TEXT_SCORE_LABEL, "Score: "),
+		(WORLD_WIDTH * 0.60f), (WORLD_HEIGHT * 0.088f),
+		WORLD_HEIGHT * 0.002f, ASGE::COLOURS::DARKORANGE, LAYER_TEXT);
+	draw_buffer.text(text_cache.number(TEXT_SCORE, current_score),
+		(WORLD_WIDTH * 0.73f), (WORLD_HEIGHT * 0.088f),
+		WORLD_HEIGHT * 0.002f, ASGE::COLOURS::DARKORANGE, LAYER_TEXT);
 
-	}
-	if (slingshot.getVisible() == true)
-	{
-		renderer->renderSprite(*slingshot.spriteComponent()->getSprite());
-	}
+	rect enemy_counter_sprite = enemy_counter.getBoundingBox();
+	draw_buffer.text(text_cache.number(TEXT_ENEMIES_LEFT, NUM_ENEMIES - no_enemies_hit),
+		(enemy_counter_sprite.x + (enemy_counter_sprite.length * 1.02f)),
+		(enemy_counter_sprite.y + (enemy_counter_sprite.height * 0.95f)),
+		WORLD_HEIGHT * 0.0025f, ASGE::COLOURS::DARKORANGE, LAYER_TEXT);
 }
 
 /**
@@ -1253,17 +1742,17 @@ void AngryBirdsGame::renderInGame()
 void AngryBirdsGame::renderGameOverL()
 {
 	// Set Background colour
-	renderer->setClearColour(ASGE::COLOURS::BLACK);
+	draw_buffer.clearColour(ASGE::COLOURS::BLACK);
 	// renders the main menu text
-	renderer->renderText(
-		"GAME OVER out of lives \n Press Enter to return to main menu.",
-		game_width * 0.25f, game_height * 0.2f, game_height * 0.002f, ASGE::COLOURS::DARKORANGE);
-	renderer->renderText("Final Score: ", (game_width * 0.3f), (game_height * 0.5f),
-		game_height * 0.004f, ASGE::COLOURS::WHITESMOKE);
-	std::string score_string = std::to_string(current_score);
-	renderer->renderText(score_string.c_str(),
-		(game_width * 0.7f), (game_height * 0.50f),
-		game_height * 0.004f, ASGE::COLOURS::WHITESMOKE);
+	draw_buffer.text(text_cache.text(TEXT_GAME_OVER,
+		"GAME OVER out of lives \n Press Enter to return to main menu."),
+		WORLD_WIDTH * 0.25f, WORLD_HEIGHT * 0.2f, WORLD_HEIGHT * 0.002f, ASGE::COLOURS::DARKORANGE, LAYER_TEXT);
+	draw_buffer.text(text_cache.text(TEXT_FINAL_SCORE_LABEL, "Final Score: "),
+		(WORLD_WIDTH * 0.3f), (WORLD_HEIGHT * 0.5f),
+		WORLD_HEIGHT * 0.004f, ASGE::COLOURS::WHITESMOKE, LAYER_TEXT);
+	draw_buffer.text(text_cache.number(TEXT_SCORE, current_score),
+		(WORLD_WIDTH * 0.7f), (WORLD_HEIGHT * 0.50f),
+		WORLD_HEIGHT * 0.004f, ASGE::COLOURS::WHITESMOKE, LAYER_TEXT);
 
 }
 
@@ -1276,17 +1765,17 @@ void AngryBirdsGame::renderGameOverL()
 void AngryBirdsGame::renderGameOverW()
 {
 	// Set Background colour
-	renderer->setClearColour(ASGE::COLOURS::BLACK);
+	draw_buffer.clearColour(ASGE::COLOURS::BLACK);
 	// renders the main menu text
-	renderer->renderText(
-		"CONGRATULATIONS you cleared the game \n Press Enter to return to main menu.", game_width * 0.25f,
-		game_height * 0.2f, game_height * 0.002f, ASGE::COLOURS::DARKORANGE);
-	renderer->renderText("Final Score: ", (game_width * 0.3f), (game_height * 0.5f),
-		game_height * 0.004f, ASGE::COLOURS::WHITESMOKE);
-	std::string score_string = std::to_string(current_score);
-	renderer->renderText(score_string.c_str(),
-		(game_width * 0.7f), (game_height * 0.50f),
-		game_height * 0.004f, ASGE::COLOURS::WHITESMOKE);
+	draw_buffer.text(text_cache.text(TEXT_GAME_OVER,
+		"CONGRATULATIONS you cleared the game \n Press Enter to return to main menu."), WORLD_WIDTH * 0.25f,
+		WORLD_HEIGHT * 0.2f, WORLD_HEIGHT * 0.002f, ASGE::COLOURS::DARKORANGE, LAYER_TEXT);
+	draw_buffer.text(text_cache.text(TEXT_FINAL_SCORE_LABEL, "Final Score: "),
+		(WORLD_WIDTH * 0.3f), (WORLD_HEIGHT * 0.5f),
+		WORLD_HEIGHT * 0.004f, ASGE::COLOURS::WHITESMOKE, LAYER_TEXT);
+	draw_buffer.text(text_cache.number(TEXT_SCORE, current_score),
+		(WORLD_WIDTH * 0.7f), (WORLD_HEIGHT * 0.50f),
+		WORLD_HEIGHT * 0.004f, ASGE::COLOURS::WHITESMOKE, LAYER_TEXT);
 }
 
 /**
@@ -1335,22 +1824,22 @@ void AngryBirdsGame::renderHighScores()
 	renderMainMenu();
 
 
-	renderer->renderText("HIGH SCORES", game_width * 0.80f, game_height * 0.15f, game_height * 0.002f,
-		ASGE::COLOURS::DARKORANGE);
+	draw_buffer.text(text_cache.text(TEXT_HIGH_SCORES_TITLE, "HIGH SCORES"), WORLD_WIDTH * 0.80f, WORLD_HEIGHT * 0.15f, WORLD_HEIGHT * 0.002f,
+		ASGE::COLOURS::DARKORANGE, LAYER_TEXT);
 	// renders the high scores
 	int j = 0;
-	for (int i = game_height * 0.25f; i < game_height * 0.75f; i = i + game_height * 0.05f)
-	{
-		renderer->renderText(high_scores[j].initials.c_str(), game_width * 0.82f, i, game_height * 0.002f,
-			ASGE::COLOURS::GHOSTWHITE);
-		// creates a string with the score appended
-		std::string score_str_1 = std::to_string(high_scores[j].score);
-		renderer->renderText(score_str_1.c_str(), game_width * 0.87f, i, game_height * 0.002f,
-			ASGE::COLOURS::GHOSTWHITE);
+	for (int i = WORLD_HEIGHT * 0.25f; i < WORLD_HEIGHT * 0.75f; i = i + WORLD_HEIGHT * 0.05f)
+	{
+		draw_buffer.text(text_cache.text(TEXT_INITIALS + j, high_scores[j].initials.c_str()),
+			WORLD_WIDTH * 0.82f, i, WORLD_HEIGHT * 0.002f, ASGE::COLOURS::GHOSTWHITE, LAYER_TEXT);
+		draw_buffer.text(text_cache.number(TEXT_HIGH_SCORE_VALUES + j, high_scores[j].score),
+			WORLD_WIDTH * 0.87f, i, WORLD_HEIGHT * 0.002f,
+			ASGE::COLOURS::GHOSTWHITE, LAYER_TEXT);
 		j++;
 	}
-	renderer->renderText("Press Enter\n to return\n to Main Menu", game_width * 0.8f, game_height * 0.8f,
-		game_height * 0.002f, ASGE::COLOURS::GHOSTWHITE);
+	draw_buffer.text(text_cache.text(TEXT_HIGH_SCORES_RETURN, "Press Enter\n to return\n to Main Menu"),
+		WORLD_WIDTH * 0.8f, WORLD_HEIGHT * 0.8f,
+		WORLD_HEIGHT * 0.002f, ASGE::COLOURS::GHOSTWHITE, LAYER_TEXT);
 }
 
 /**
@@ -1363,27 +1852,27 @@ players initials
 void AngryBirdsGame::renderNewHighScore()
 {
 
-	renderer->renderText("CONGRATULATIONS YOU SCORED A NEW HIGH SCORE",
-		game_width * 0.1f, game_height * 0.15f, game_height * 0.003f, ASGE::COLOURS::DARKORANGE);
+	draw_buffer.text(text_cache.text(TEXT_NEW_HIGH_SCORE, "CONGRATULATIONS YOU SCORED A NEW HIGH SCORE"),
+		WORLD_WIDTH * 0.1f, WORLD_HEIGHT * 0.15f, WORLD_HEIGHT * 0.003f, ASGE::COLOURS::DARKORANGE, LAYER_TEXT);
 	int j = 0;
-	for (int i = game_height * 0.25f; i < game_height * 0.75f; i = i + game_height * 0.05f)
-	{
-		renderer->renderText(high_score_idx_to_update == j ?
-			new_initials.c_str() : high_scores[j].initials.c_str(),
-			game_width * 0.45f, i, game_height * 0.002f, high_score_idx_to_update == j ?
-			ASGE::COLOURS::GHOSTWHITE : ASGE::COLOURS::DARKORANGE);
-		std::string score_str_1 = std::to_string(high_scores[j].score);
-		renderer->renderText(score_str_1.c_str(), game_width * 0.5f, i, game_height * 0.002f,
+	for (int i = WORLD_HEIGHT * 0.25f; i < WORLD_HEIGHT * 0.75f; i = i + WORLD_HEIGHT * 0.05f)
+	{
+		draw_buffer.text(text_cache.text(TEXT_INITIALS + j, high_score_idx_to_update == j ?
+			new_initials.c_str() : high_scores[j].initials.c_str()),
+			WORLD_WIDTH * 0.45f, i, WORLD_HEIGHT * 0.002f, high_score_idx_to_update == j ?
+			ASGE::COLOURS::GHOSTWHITE : ASGE::COLOURS::DARKORANGE, LAYER_TEXT);
+		draw_buffer.text(text_cache.number(TEXT_HIGH_SCORE_VALUES + j, high_scores[j].score),
+			WORLD_WIDTH * 0.5f, i, WORLD_HEIGHT * 0.002f,
 			high_score_idx_to_update == j ?
-			ASGE::COLOURS::GHOSTWHITE : ASGE::COLOURS::DARKORANGE);
+			ASGE::COLOURS::GHOSTWHITE : ASGE::COLOURS::DARKORANGE, LAYER_TEXT);
 		j++;
 	}
 
 
 
-	renderer->renderText(
-		"Use arrow keys to change initials and press Enter when finished", game_width * 0.1f, game_height * 0.8f,
-		game_height * 0.002f, ASGE::COLOURS::GHOSTWHITE);
+	draw_buffer.text(text_cache.text(TEXT_NEW_HIGH_SCORE_HELP,
+		"Use arrow keys to change initials and press Enter when finished"), WORLD_WIDTH * 0.1f, WORLD_HEIGHT * 0.8f,
+		WORLD_HEIGHT * 0.002f, ASGE::COLOURS::GHOSTWHITE, LAYER_TEXT);
 }
 
 /**
@@ -1394,11 +1883,11 @@ void AngryBirdsGame::renderNewHighScore()
 */
 void AngryBirdsGame::newGame()
 {
-	setupLevel(level);
+	setupLevel();
 
-	// re-initialise bomb and scatter sprites
-	resetBomb();
-	resetProjectileScatter();
+	clearEffects();
+	explosions.clear();
+	debris.clear();
 	// re-initialise game variables
 	current_score = 0;
 	new_game = false;
@@ -1414,10 +1903,21 @@ void AngryBirdsGame::newGame()
 *   @see     KeyEvent
 *   @return  void
 */
-void AngryBirdsGame::setupLevel(int level)
+void AngryBirdsGame::setupLevel()
 {
-	int map = (rand() % 3);
+	int map = random.below(3);
 	rect projectile_platform;
+
+	// nothing from the last level is kept, so its scratch is dropped
+	// in one go and the containers are rebuilt on the fresh arena
+	level_arena.reset();
+	ArenaAllocator<char> arena(&level_arena);
+	collision_targets = LevelVector<rect>(arena);
+	collision_entities = LevelVector<int>(arena);
+	projectile_hits = LevelVector<ProjectileHit>(arena);
+	collision_targets.reserve(world.colliders.size());
+	collision_entities.reserve(world.colliders.size());
+	projectile_hits.reserve(MAX_SUB_PROJECTILES);
 	
 	loadLevelMap(map);
 	setupPigs(map);
@@ -1425,11 +1925,18 @@ void AngryBirdsGame::setupLevel(int level)
 	setupProjectiles(projectile_platform);
 	for (int i = 0; i < NUM_BLOCKS; i++)
 	{
-		ASGE::Sprite* block_sprite = blocks[level_map[i].block_index].spriteComponent()->getSprite();
-		block_sprite->xPos(grid_X[level_map[i].x_index]);
-		block_sprite->yPos(grid_Y[level_map[i].y_index]);
+		Transform* block_sprite = &blocks[level_map[i].block_index].transform();
+		block_sprite->x = grid_X[level_map[i].x_index];
+		block_sprite->y = grid_Y[level_map[i].y_index];
 		blocks[i].setVisible(true);
+		blocks[i].setHealth(blockHealth(blocks[i]));
 	}
+	for (int i = 0; i < NUM_ENEMIES; i++)
+	{
+		enemies[i].setHealth(HEALTH_ENEMY);
+	}
+	refreshBroadphase();
+	layout_version++;
 }
 
 /**
@@ -1441,34 +1948,34 @@ void AngryBirdsGame::setupLevel(int level)
 void AngryBirdsGame::setupProjectiles(rect projectile_platform)
 {
 
-	ASGE::Sprite* slingshot_sprite = slingshot.spriteComponent()->getSprite();
-	slingshot_sprite->yPos(projectile_platform.y - slingshot_sprite->height());
-	slingshot_sprite->xPos(projectile_platform.x + projectile_platform.length - 
-		(slingshot_sprite->width() * 0.6f));
+	Transform* slingshot_sprite = &slingshot.transform();
+	slingshot_sprite->y = projectile_platform.y - slingshot_sprite->height;
+	slingshot_sprite->x = projectile_platform.x + projectile_platform.length - 
+		(slingshot_sprite->width * 0.6f);
 	slingshot.setVisible(true);
 	for (int i = 0; i < NUM_PROJECTILES; i++)
 	{
 
-		ASGE::Sprite* projectile_sprite = projectiles[i].spriteComponent()->getSprite();
+		Transform* projectile_sprite = &projectiles[i].transform();
 		projectiles[i].setVisible(true);
 		if (i == 0)
 		{
-			projectile_sprite->yPos(slingshot_sprite->yPos() - (projectile_sprite->height() * 0.1f));
-			projectile_sprite->xPos(slingshot_sprite->xPos() + (slingshot_sprite->width() *0.4f) - 
-				(projectile_sprite->width()*0.5f));
-			slingshot_center.setX(projectile_sprite->xPos());
-			slingshot_center.setY(projectile_sprite->yPos());
-			aiming_area.x = projectile_sprite->xPos() - gameplay_area.length * 0.07f;
-			aiming_area.y = projectile_sprite->yPos() - gameplay_area.height * 0.03f;
+			projectile_sprite->y = slingshot_sprite->y - (projectile_sprite->height * 0.1f);
+			projectile_sprite->x = slingshot_sprite->x + (slingshot_sprite->width *0.4f) - 
+				(projectile_sprite->width*0.5f);
+			slingshot_center.setX(projectile_sprite->x);
+			slingshot_center.setY(projectile_sprite->y);
+			aiming_area.x = projectile_sprite->x - gameplay_area.length * 0.07f;
+			aiming_area.y = projectile_sprite->y - gameplay_area.height * 0.03f;
 			aiming_area.height = gameplay_area.height * 0.07f;
 			aiming_area.length = gameplay_area.length * 0.07f;
 
 		}
 		else
 		{
-			projectile_sprite->yPos(projectile_platform.y - projectile_sprite->height());
-			projectile_sprite->xPos(projectile_platform.x + projectile_platform.length - 
-				(((i + 1) * 1.5f) * (game_height * PROJECTILE_SIZE)));
+			projectile_sprite->y = projectile_platform.y - projectile_sprite->height;
+			projectile_sprite->x = projectile_platform.x + projectile_platform.length - 
+				(((i + 1) * 1.5f) * (WORLD_HEIGHT * PROJECTILE_SIZE));
 		}
 
 	}
@@ -1488,100 +1995,100 @@ void AngryBirdsGame::setupPigs(int map)
 		{
 		case 0:
 		{
-			ASGE::Sprite* enemy_sprite = enemies[0].spriteComponent()->getSprite();
-			enemy_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.66f));
-			enemy_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.6f));
+			Transform* enemy_sprite = &enemies[0].transform();
+			enemy_sprite->y = gameplay_area.y + (gameplay_area.height * 0.66f);
+			enemy_sprite->x = gameplay_area.x + (gameplay_area.length* 0.6f);
 			enemies[0].setVisible(true);
 
-			enemy_sprite = enemies[1].spriteComponent()->getSprite();
-			enemy_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.47f));
-			enemy_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.5f));
+			enemy_sprite = &enemies[1].transform();
+			enemy_sprite->y = gameplay_area.y + (gameplay_area.height * 0.47f);
+			enemy_sprite->x = gameplay_area.x + (gameplay_area.length* 0.5f);
 			enemies[1].setVisible(true);
 
-			enemy_sprite = enemies[2].spriteComponent()->getSprite();
-			enemy_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.69f));
-			enemy_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.73f));
+			enemy_sprite = &enemies[2].transform();
+			enemy_sprite->y = gameplay_area.y + (gameplay_area.height * 0.69f);
+			enemy_sprite->x = gameplay_area.x + (gameplay_area.length* 0.73f);
 			enemies[2].setVisible(true);
 
-			enemy_sprite = enemies[3].spriteComponent()->getSprite();
-			enemy_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.68f));
-			enemy_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.505f));
+			enemy_sprite = &enemies[3].transform();
+			enemy_sprite->y = gameplay_area.y + (gameplay_area.height * 0.68f);
+			enemy_sprite->x = gameplay_area.x + (gameplay_area.length* 0.505f);
 			enemies[3].setVisible(true);
 
-			enemy_sprite = enemies[4].spriteComponent()->getSprite();
-			enemy_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.79f));
-			enemy_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.48f));
+			enemy_sprite = &enemies[4].transform();
+			enemy_sprite->y = gameplay_area.y + (gameplay_area.height * 0.79f);
+			enemy_sprite->x = gameplay_area.x + (gameplay_area.length* 0.48f);
 			enemies[4].setVisible(true);
 
-			enemy_sprite = enemies[5].spriteComponent()->getSprite();
-			enemy_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.48f));
-			enemy_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.6f));
+			enemy_sprite = &enemies[5].transform();
+			enemy_sprite->y = gameplay_area.y + (gameplay_area.height * 0.48f);
+			enemy_sprite->x = gameplay_area.x + (gameplay_area.length* 0.6f);
 			enemies[5].setVisible(true);
 			break;
 		}
 		case 1:
 		{
-			ASGE::Sprite* enemy_sprite = enemies[0].spriteComponent()->getSprite();
-			enemy_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.345f));
-			enemy_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.55f));
+			Transform* enemy_sprite = &enemies[0].transform();
+			enemy_sprite->y = gameplay_area.y + (gameplay_area.height * 0.345f);
+			enemy_sprite->x = gameplay_area.x + (gameplay_area.length* 0.55f);
 			enemies[0].setVisible(true);
 
-			enemy_sprite = enemies[1].spriteComponent()->getSprite();
-			enemy_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.46f));
-			enemy_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.65f));
+			enemy_sprite = &enemies[1].transform();
+			enemy_sprite->y = gameplay_area.y + (gameplay_area.height * 0.46f);
+			enemy_sprite->x = gameplay_area.x + (gameplay_area.length* 0.65f);
 			enemies[1].setVisible(true);
 
-			enemy_sprite = enemies[2].spriteComponent()->getSprite();
-			enemy_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.68f));
-			enemy_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.72f));
+			enemy_sprite = &enemies[2].transform();
+			enemy_sprite->y = gameplay_area.y + (gameplay_area.height * 0.68f);
+			enemy_sprite->x = gameplay_area.x + (gameplay_area.length* 0.72f);
 			enemies[2].setVisible(true);
 
-			enemy_sprite = enemies[3].spriteComponent()->getSprite();
-			enemy_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.555f));
-			enemy_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.532f));
+			enemy_sprite = &enemies[3].transform();
+			enemy_sprite->y = gameplay_area.y + (gameplay_area.height * 0.555f);
+			enemy_sprite->x = gameplay_area.x + (gameplay_area.length* 0.532f);
 			enemies[3].setVisible(true);
 
-			enemy_sprite = enemies[4].spriteComponent()->getSprite();
-			enemy_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.76f));
-			enemy_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.47f));
+			enemy_sprite = &enemies[4].transform();
+			enemy_sprite->y = gameplay_area.y + (gameplay_area.height * 0.76f);
+			enemy_sprite->x = gameplay_area.x + (gameplay_area.length* 0.47f);
 			enemies[4].setVisible(true);
 
-			enemy_sprite = enemies[5].spriteComponent()->getSprite();
-			enemy_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.77f));
-			enemy_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.66f));
+			enemy_sprite = &enemies[5].transform();
+			enemy_sprite->y = gameplay_area.y + (gameplay_area.height * 0.77f);
+			enemy_sprite->x = gameplay_area.x + (gameplay_area.length* 0.66f);
 			enemies[5].setVisible(true);
 			break;
 		}
 		case 2:
 		{
-			ASGE::Sprite* enemy_sprite = enemies[0].spriteComponent()->getSprite();
-			enemy_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.725f));
-			enemy_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.655f));
+			Transform* enemy_sprite = &enemies[0].transform();
+			enemy_sprite->y = gameplay_area.y + (gameplay_area.height * 0.725f);
+			enemy_sprite->x = gameplay_area.x + (gameplay_area.length* 0.655f);
 			enemies[0].setVisible(true);
 
-			enemy_sprite = enemies[1].spriteComponent()->getSprite();
-			enemy_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.485f));
-			enemy_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.57f));
+			enemy_sprite = &enemies[1].transform();
+			enemy_sprite->y = gameplay_area.y + (gameplay_area.height * 0.485f);
+			enemy_sprite->x = gameplay_area.x + (gameplay_area.length* 0.57f);
 			enemies[1].setVisible(true);
 
-			enemy_sprite = enemies[2].spriteComponent()->getSprite();
-			enemy_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.3f));
-			enemy_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.715f));
+			enemy_sprite = &enemies[2].transform();
+			enemy_sprite->y = gameplay_area.y + (gameplay_area.height * 0.3f);
+			enemy_sprite->x = gameplay_area.x + (gameplay_area.length* 0.715f);
 			enemies[2].setVisible(true);
 
-			enemy_sprite = enemies[3].spriteComponent()->getSprite();
-			enemy_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.335f));
-			enemy_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.532f));
+			enemy_sprite = &enemies[3].transform();
+			enemy_sprite->y = gameplay_area.y + (gameplay_area.height * 0.335f);
+			enemy_sprite->x = gameplay_area.x + (gameplay_area.length* 0.532f);
 			enemies[3].setVisible(true);
 
-			enemy_sprite = enemies[4].spriteComponent()->getSprite();
-			enemy_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.705f));
-			enemy_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.475f));
+			enemy_sprite = &enemies[4].transform();
+			enemy_sprite->y = gameplay_area.y + (gameplay_area.height * 0.705f);
+			enemy_sprite->x = gameplay_area.x + (gameplay_area.length* 0.475f);
 			enemies[4].setVisible(true);
 
-			enemy_sprite = enemies[5].spriteComponent()->getSprite();
-			enemy_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.815f));
-			enemy_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.755f));
+			enemy_sprite = &enemies[5].transform();
+			enemy_sprite->y = gameplay_area.y + (gameplay_area.height * 0.815f);
+			enemy_sprite->x = gameplay_area.x + (gameplay_area.length* 0.755f);
 			enemies[5].setVisible(true);
 			break;
 		}
@@ -1595,101 +2102,101 @@ void AngryBirdsGame::setupPigs(int map)
 		case 0:
 		{
 
-			ASGE::Sprite* enemy_sprite = enemies[0].spriteComponent()->getSprite();
-			enemy_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.635f));
-			enemy_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.655f));
+			Transform* enemy_sprite = &enemies[0].transform();
+			enemy_sprite->y = gameplay_area.y + (gameplay_area.height * 0.635f);
+			enemy_sprite->x = gameplay_area.x + (gameplay_area.length* 0.655f);
 			enemies[0].setVisible(true);
 
-			enemy_sprite = enemies[1].spriteComponent()->getSprite();
-			enemy_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.445f));
-			enemy_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.525f));
+			enemy_sprite = &enemies[1].transform();
+			enemy_sprite->y = gameplay_area.y + (gameplay_area.height * 0.445f);
+			enemy_sprite->x = gameplay_area.x + (gameplay_area.length* 0.525f);
 			enemies[1].setVisible(true);
 
-			enemy_sprite = enemies[2].spriteComponent()->getSprite();
-			enemy_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.315f));
-			enemy_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.715f));
+			enemy_sprite = &enemies[2].transform();
+			enemy_sprite->y = gameplay_area.y + (gameplay_area.height * 0.315f);
+			enemy_sprite->x = gameplay_area.x + (gameplay_area.length* 0.715f);
 			enemies[2].setVisible(true);
 
-			enemy_sprite = enemies[3].spriteComponent()->getSprite();
-			enemy_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.605f));
-			enemy_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.532f));
+			enemy_sprite = &enemies[3].transform();
+			enemy_sprite->y = gameplay_area.y + (gameplay_area.height * 0.605f);
+			enemy_sprite->x = gameplay_area.x + (gameplay_area.length* 0.532f);
 			enemies[3].setVisible(true);
 
-			enemy_sprite = enemies[4].spriteComponent()->getSprite();
-			enemy_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.715f));
-			enemy_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.495f));
+			enemy_sprite = &enemies[4].transform();
+			enemy_sprite->y = gameplay_area.y + (gameplay_area.height * 0.715f);
+			enemy_sprite->x = gameplay_area.x + (gameplay_area.length* 0.495f);
 			enemies[4].setVisible(true);
 
-			enemy_sprite = enemies[5].spriteComponent()->getSprite();
-			enemy_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.725f));
-			enemy_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.755f));
+			enemy_sprite = &enemies[5].transform();
+			enemy_sprite->y = gameplay_area.y + (gameplay_area.height * 0.725f);
+			enemy_sprite->x = gameplay_area.x + (gameplay_area.length* 0.755f);
 			enemies[5].setVisible(true);
 			break;
 		}
 
 		case 1:
 		{
-			ASGE::Sprite* enemy_sprite = enemies[0].spriteComponent()->getSprite();
-			enemy_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.495f));
-			enemy_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.725f));
+			Transform* enemy_sprite = &enemies[0].transform();
+			enemy_sprite->y = gameplay_area.y + (gameplay_area.height * 0.495f);
+			enemy_sprite->x = gameplay_area.x + (gameplay_area.length* 0.725f);
 			enemies[0].setVisible(true);
 
-			enemy_sprite = enemies[1].spriteComponent()->getSprite();
-			enemy_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.665f));
-			enemy_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.495f));
+			enemy_sprite = &enemies[1].transform();
+			enemy_sprite->y = gameplay_area.y + (gameplay_area.height * 0.665f);
+			enemy_sprite->x = gameplay_area.x + (gameplay_area.length* 0.495f);
 			enemies[1].setVisible(true);
 
-			enemy_sprite = enemies[2].spriteComponent()->getSprite();
-			enemy_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.325f));
-			enemy_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.575f));
+			enemy_sprite = &enemies[2].transform();
+			enemy_sprite->y = gameplay_area.y + (gameplay_area.height * 0.325f);
+			enemy_sprite->x = gameplay_area.x + (gameplay_area.length* 0.575f);
 			enemies[2].setVisible(true);
 
-			enemy_sprite = enemies[3].spriteComponent()->getSprite();
-			enemy_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.325f));
-			enemy_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.675f));
+			enemy_sprite = &enemies[3].transform();
+			enemy_sprite->y = gameplay_area.y + (gameplay_area.height * 0.325f);
+			enemy_sprite->x = gameplay_area.x + (gameplay_area.length* 0.675f);
 			enemies[3].setVisible(true);
 
-			enemy_sprite = enemies[4].spriteComponent()->getSprite();
-			enemy_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.705f));
-			enemy_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.555f));
+			enemy_sprite = &enemies[4].transform();
+			enemy_sprite->y = gameplay_area.y + (gameplay_area.height * 0.705f);
+			enemy_sprite->x = gameplay_area.x + (gameplay_area.length* 0.555f);
 			enemies[4].setVisible(true);
 
-			enemy_sprite = enemies[5].spriteComponent()->getSprite();
-			enemy_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.755f));
-			enemy_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.795f));
+			enemy_sprite = &enemies[5].transform();
+			enemy_sprite->y = gameplay_area.y + (gameplay_area.height * 0.755f);
+			enemy_sprite->x = gameplay_area.x + (gameplay_area.length* 0.795f);
 			enemies[5].setVisible(true);
 			break;
 		}
 		case 2:
 		{
-			ASGE::Sprite* enemy_sprite = enemies[0].spriteComponent()->getSprite();
-			enemy_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.46f));
-			enemy_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.750f));
+			Transform* enemy_sprite = &enemies[0].transform();
+			enemy_sprite->y = gameplay_area.y + (gameplay_area.height * 0.46f);
+			enemy_sprite->x = gameplay_area.x + (gameplay_area.length* 0.750f);
 			enemies[0].setVisible(true);
 
-			enemy_sprite = enemies[1].spriteComponent()->getSprite();
-			enemy_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.6f));
-			enemy_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.435f));
+			enemy_sprite = &enemies[1].transform();
+			enemy_sprite->y = gameplay_area.y + (gameplay_area.height * 0.6f);
+			enemy_sprite->x = gameplay_area.x + (gameplay_area.length* 0.435f);
 			enemies[1].setVisible(true);
 
-			enemy_sprite = enemies[2].spriteComponent()->getSprite();
-			enemy_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.255f));
-			enemy_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.575f));
+			enemy_sprite = &enemies[2].transform();
+			enemy_sprite->y = gameplay_area.y + (gameplay_area.height * 0.255f);
+			enemy_sprite->x = gameplay_area.x + (gameplay_area.length* 0.575f);
 			enemies[2].setVisible(true);
 
-			enemy_sprite = enemies[3].spriteComponent()->getSprite();
-			enemy_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.65f));
-			enemy_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.545f));
+			enemy_sprite = &enemies[3].transform();
+			enemy_sprite->y = gameplay_area.y + (gameplay_area.height * 0.65f);
+			enemy_sprite->x = gameplay_area.x + (gameplay_area.length* 0.545f);
 			enemies[3].setVisible(true);
 
-			enemy_sprite = enemies[4].spriteComponent()->getSprite();
-			enemy_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.74f));
-			enemy_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.595f));
+			enemy_sprite = &enemies[4].transform();
+			enemy_sprite->y = gameplay_area.y + (gameplay_area.height * 0.74f);
+			enemy_sprite->x = gameplay_area.x + (gameplay_area.length* 0.595f);
 			enemies[4].setVisible(true);
 
-			enemy_sprite = enemies[5].spriteComponent()->getSprite();
-			enemy_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.705f));
-			enemy_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.795f));
+			enemy_sprite = &enemies[5].transform();
+			enemy_sprite->y = gameplay_area.y + (gameplay_area.height * 0.705f);
+			enemy_sprite->x = gameplay_area.x + (gameplay_area.length* 0.795f);
 			enemies[5].setVisible(true);
 
 
@@ -1703,101 +2210,101 @@ void AngryBirdsGame::setupPigs(int map)
 		{
 		case 0:
 		{
-			ASGE::Sprite* enemy_sprite = enemies[0].spriteComponent()->getSprite();
-			enemy_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.720f));
-			enemy_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.592f));
+			Transform* enemy_sprite = &enemies[0].transform();
+			enemy_sprite->y = gameplay_area.y + (gameplay_area.height * 0.720f);
+			enemy_sprite->x = gameplay_area.x + (gameplay_area.length* 0.592f);
 			enemies[0].setVisible(true);
 
-			enemy_sprite = enemies[1].spriteComponent()->getSprite();
-			enemy_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.555f));
-			enemy_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.725f));
+			enemy_sprite = &enemies[1].transform();
+			enemy_sprite->y = gameplay_area.y + (gameplay_area.height * 0.555f);
+			enemy_sprite->x = gameplay_area.x + (gameplay_area.length* 0.725f);
 			enemies[1].setVisible(true);
 
-			enemy_sprite = enemies[2].spriteComponent()->getSprite();
-			enemy_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.69f));
-			enemy_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.73f));
+			enemy_sprite = &enemies[2].transform();
+			enemy_sprite->y = gameplay_area.y + (gameplay_area.height * 0.69f);
+			enemy_sprite->x = gameplay_area.x + (gameplay_area.length* 0.73f);
 			enemies[2].setVisible(true);
 
-			enemy_sprite = enemies[3].spriteComponent()->getSprite();
-			enemy_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.68f));
-			enemy_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.505f));
+			enemy_sprite = &enemies[3].transform();
+			enemy_sprite->y = gameplay_area.y + (gameplay_area.height * 0.68f);
+			enemy_sprite->x = gameplay_area.x + (gameplay_area.length* 0.505f);
 			enemies[3].setVisible(true);
 
-			enemy_sprite = enemies[4].spriteComponent()->getSprite();
-			enemy_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.775f));
-			enemy_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.455f));
+			enemy_sprite = &enemies[4].transform();
+			enemy_sprite->y = gameplay_area.y + (gameplay_area.height * 0.775f);
+			enemy_sprite->x = gameplay_area.x + (gameplay_area.length* 0.455f);
 			enemies[4].setVisible(true);
 
-			enemy_sprite = enemies[5].spriteComponent()->getSprite();
-			enemy_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.455f));
-			enemy_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.6f));
+			enemy_sprite = &enemies[5].transform();
+			enemy_sprite->y = gameplay_area.y + (gameplay_area.height * 0.455f);
+			enemy_sprite->x = gameplay_area.x + (gameplay_area.length* 0.6f);
 			enemies[5].setVisible(true);
 			break;
 		}
 
 		case 1:
 		{
-			ASGE::Sprite* enemy_sprite = enemies[0].spriteComponent()->getSprite();
-			enemy_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.66f));
-			enemy_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.725f));
+			Transform* enemy_sprite = &enemies[0].transform();
+			enemy_sprite->y = gameplay_area.y + (gameplay_area.height * 0.66f);
+			enemy_sprite->x = gameplay_area.x + (gameplay_area.length* 0.725f);
 			enemies[0].setVisible(true);
 
-			enemy_sprite = enemies[1].spriteComponent()->getSprite();
-			enemy_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.37f));
-			enemy_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.525f));
+			enemy_sprite = &enemies[1].transform();
+			enemy_sprite->y = gameplay_area.y + (gameplay_area.height * 0.37f);
+			enemy_sprite->x = gameplay_area.x + (gameplay_area.length* 0.525f);
 			enemies[1].setVisible(true);
 
-			enemy_sprite = enemies[2].spriteComponent()->getSprite();
-			enemy_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.825f));
-			enemy_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.73f));
+			enemy_sprite = &enemies[2].transform();
+			enemy_sprite->y = gameplay_area.y + (gameplay_area.height * 0.825f);
+			enemy_sprite->x = gameplay_area.x + (gameplay_area.length* 0.73f);
 			enemies[2].setVisible(true);
 
-			enemy_sprite = enemies[3].spriteComponent()->getSprite();
-			enemy_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.615f));
-			enemy_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.505f));
+			enemy_sprite = &enemies[3].transform();
+			enemy_sprite->y = gameplay_area.y + (gameplay_area.height * 0.615f);
+			enemy_sprite->x = gameplay_area.x + (gameplay_area.length* 0.505f);
 			enemies[3].setVisible(true);
 
-			enemy_sprite = enemies[4].spriteComponent()->getSprite();
-			enemy_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.805f));
-			enemy_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.515f));
+			enemy_sprite = &enemies[4].transform();
+			enemy_sprite->y = gameplay_area.y + (gameplay_area.height * 0.805f);
+			enemy_sprite->x = gameplay_area.x + (gameplay_area.length* 0.515f);
 			enemies[4].setVisible(true);
 
-			enemy_sprite = enemies[5].spriteComponent()->getSprite();
-			enemy_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.415f));
-			enemy_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.675f));
+			enemy_sprite = &enemies[5].transform();
+			enemy_sprite->y = gameplay_area.y + (gameplay_area.height * 0.415f);
+			enemy_sprite->x = gameplay_area.x + (gameplay_area.length* 0.675f);
 			enemies[5].setVisible(true);
 			break;
 		}
 		case 2:
 		{
-			ASGE::Sprite* enemy_sprite = enemies[0].spriteComponent()->getSprite();
-			enemy_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.66f));
-			enemy_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.725f));
+			Transform* enemy_sprite = &enemies[0].transform();
+			enemy_sprite->y = gameplay_area.y + (gameplay_area.height * 0.66f);
+			enemy_sprite->x = gameplay_area.x + (gameplay_area.length* 0.725f);
 			enemies[0].setVisible(true);
 
-			enemy_sprite = enemies[1].spriteComponent()->getSprite();
-			enemy_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.305f));
-			enemy_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.525f));
+			enemy_sprite = &enemies[1].transform();
+			enemy_sprite->y = gameplay_area.y + (gameplay_area.height * 0.305f);
+			enemy_sprite->x = gameplay_area.x + (gameplay_area.length* 0.525f);
 			enemies[1].setVisible(true);
 
-			enemy_sprite = enemies[2].spriteComponent()->getSprite();
-			enemy_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.795f));
-			enemy_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.835f));
+			enemy_sprite = &enemies[2].transform();
+			enemy_sprite->y = gameplay_area.y + (gameplay_area.height * 0.795f);
+			enemy_sprite->x = gameplay_area.x + (gameplay_area.length* 0.835f);
 			enemies[2].setVisible(true);
 
-			enemy_sprite = enemies[3].spriteComponent()->getSprite();
-			enemy_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.585f));
-			enemy_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.535f));
+			enemy_sprite = &enemies[3].transform();
+			enemy_sprite->y = gameplay_area.y + (gameplay_area.height * 0.585f);
+			enemy_sprite->x = gameplay_area.x + (gameplay_area.length* 0.535f);
 			enemies[3].setVisible(true);
 
-			enemy_sprite = enemies[4].spriteComponent()->getSprite();
-			enemy_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.655f));
-			enemy_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.455f));
+			enemy_sprite = &enemies[4].transform();
+			enemy_sprite->y = gameplay_area.y + (gameplay_area.height * 0.655f);
+			enemy_sprite->x = gameplay_area.x + (gameplay_area.length* 0.455f);
 			enemies[4].setVisible(true);
 
-			enemy_sprite = enemies[5].spriteComponent()->getSprite();
-			enemy_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.435f));
-			enemy_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.635f));
+			enemy_sprite = &enemies[5].transform();
+			enemy_sprite->y = gameplay_area.y + (gameplay_area.height * 0.435f);
+			enemy_sprite->x = gameplay_area.x + (gameplay_area.length* 0.635f);
 			enemies[5].setVisible(true);
 
 			break;
@@ -1818,73 +2325,73 @@ rect AngryBirdsGame::setupPlatforms(int map)
 	if (level == 0)
 	{
 
-		ASGE::Sprite* platform_sprite = platforms[0].spriteComponent()->getSprite();
-		platform_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.8f));
-		platform_sprite->xPos(gameplay_area.x);
+		Transform* platform_sprite = &platforms[0].transform();
+		platform_sprite->y = gameplay_area.y + (gameplay_area.height * 0.8f);
+		platform_sprite->x = gameplay_area.x;
 		platforms[0].setVisible(true);
-		platform_sprite = platforms[1].spriteComponent()->getSprite();
-		platform_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.8f));
-		platform_sprite->xPos(gameplay_area.x + platform_sprite->width());
+		platform_sprite = &platforms[1].transform();
+		platform_sprite->y = gameplay_area.y + (gameplay_area.height * 0.8f);
+		platform_sprite->x = gameplay_area.x + platform_sprite->width;
 		platforms[1].setVisible(true);
-		projectile_platform = platforms[1].spriteComponent()->getBoundingBox();
+		projectile_platform = platforms[1].getBoundingBox();
 		switch (map)
 		{
 		case 0:
 		{
-			ASGE::Sprite* platform_sprite = platforms[0].spriteComponent()->getSprite();
-			platform_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.8f));
-			platform_sprite->xPos(gameplay_area.x);
+			Transform* platform_sprite = &platforms[0].transform();
+			platform_sprite->y = gameplay_area.y + (gameplay_area.height * 0.8f);
+			platform_sprite->x = gameplay_area.x;
 			platforms[0].setVisible(true);
-			platform_sprite = platforms[1].spriteComponent()->getSprite();
-			platform_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.8f));
-			platform_sprite->xPos(gameplay_area.x + platform_sprite->width());
+			platform_sprite = &platforms[1].transform();
+			platform_sprite->y = gameplay_area.y + (gameplay_area.height * 0.8f);
+			platform_sprite->x = gameplay_area.x + platform_sprite->width;
 			platforms[1].setVisible(true);
 
-			platform_sprite = platforms[2].spriteComponent()->getSprite();
-			platform_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.83f));
-			platform_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.43f));
+			platform_sprite = &platforms[2].transform();
+			platform_sprite->y = gameplay_area.y + (gameplay_area.height * 0.83f);
+			platform_sprite->x = gameplay_area.x + (gameplay_area.length* 0.43f);
 			platforms[2].setVisible(true);
 
-			platform_sprite = platforms[3].spriteComponent()->getSprite();
-			platform_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.79f));
-			platform_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.56f));
+			platform_sprite = &platforms[3].transform();
+			platform_sprite->y = gameplay_area.y + (gameplay_area.height * 0.79f);
+			platform_sprite->x = gameplay_area.x + (gameplay_area.length* 0.56f);
 			platforms[3].setVisible(true);
 
-			platform_sprite = platforms[4].spriteComponent()->getSprite();
-			platform_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.73f));
-			platform_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.68f));
+			platform_sprite = &platforms[4].transform();
+			platform_sprite->y = gameplay_area.y + (gameplay_area.height * 0.73f);
+			platform_sprite->x = gameplay_area.x + (gameplay_area.length* 0.68f);
 			platforms[4].setVisible(true);
 			break;
 		}
 		case 1:
 		{
 
-			platform_sprite = platforms[2].spriteComponent()->getSprite();
-			platform_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.78f));
-			platform_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.47f));
+			platform_sprite = &platforms[2].transform();
+			platform_sprite->y = gameplay_area.y + (gameplay_area.height * 0.78f);
+			platform_sprite->x = gameplay_area.x + (gameplay_area.length* 0.47f);
 			platforms[2].setVisible(true);
 
-			platform_sprite = platforms[3].spriteComponent()->getSprite();
-			platform_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.79f));
-			platform_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.58f));
+			platform_sprite = &platforms[3].transform();
+			platform_sprite->y = gameplay_area.y + (gameplay_area.height * 0.79f);
+			platform_sprite->x = gameplay_area.x + (gameplay_area.length* 0.58f);
 			platforms[3].setVisible(true);
 
-			platform_sprite = platforms[4].spriteComponent()->getSprite();
-			platform_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.715f));
-			platform_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.68f));
+			platform_sprite = &platforms[4].transform();
+			platform_sprite->y = gameplay_area.y + (gameplay_area.height * 0.715f);
+			platform_sprite->x = gameplay_area.x + (gameplay_area.length* 0.68f);
 			platforms[4].setVisible(true);
 
-			platform_sprite = platforms[5].spriteComponent()->getSprite();
-			platform_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.615f));
-			platform_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.62f));
-			platform_sprite->width(platform_sprite->width() * 0.58f);
+			platform_sprite = &platforms[5].transform();
+			platform_sprite->y = gameplay_area.y + (gameplay_area.height * 0.615f);
+			platform_sprite->x = gameplay_area.x + (gameplay_area.length* 0.62f);
+			platform_sprite->width = platform_sprite->width * 0.58f;
 			platforms[5].setVisible(true);
 
 
-			platform_sprite = platforms[6].spriteComponent()->getSprite();
-			platform_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.74f));
-			platform_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.556f));
-			platform_sprite->width(platform_sprite->width() * 0.4f);
+			platform_sprite = &platforms[6].transform();
+			platform_sprite->y = gameplay_area.y + (gameplay_area.height * 0.74f);
+			platform_sprite->x = gameplay_area.x + (gameplay_area.length* 0.556f);
+			platform_sprite->width = platform_sprite->width * 0.4f;
 			platforms[6].setVisible(true);
 			break;
 		}
@@ -1893,35 +2400,35 @@ rect AngryBirdsGame::setupPlatforms(int map)
 
 
 
-			platform_sprite = platforms[2].spriteComponent()->getSprite();
-			platform_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.825f));
-			platform_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.44f));
+			platform_sprite = &platforms[2].transform();
+			platform_sprite->y = gameplay_area.y + (gameplay_area.height * 0.825f);
+			platform_sprite->x = gameplay_area.x + (gameplay_area.length* 0.44f);
 			platforms[2].setVisible(true);
 
-			platform_sprite = platforms[3].spriteComponent()->getSprite();
-			platform_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.825f));
-			platform_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.54f));
+			platform_sprite = &platforms[3].transform();
+			platform_sprite->y = gameplay_area.y + (gameplay_area.height * 0.825f);
+			platform_sprite->x = gameplay_area.x + (gameplay_area.length* 0.54f);
 			platforms[3].setVisible(true);
 
-			platform_sprite = platforms[4].spriteComponent()->getSprite();
-			platform_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.765f));
-			platform_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.62f));
+			platform_sprite = &platforms[4].transform();
+			platform_sprite->y = gameplay_area.y + (gameplay_area.height * 0.765f);
+			platform_sprite->x = gameplay_area.x + (gameplay_area.length* 0.62f);
 			platforms[4].setVisible(true);
 
 
-			platform_sprite = platforms[5].spriteComponent()->getSprite();
-			platform_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.425f));
-			platform_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.48f));
+			platform_sprite = &platforms[5].transform();
+			platform_sprite->y = gameplay_area.y + (gameplay_area.height * 0.425f);
+			platform_sprite->x = gameplay_area.x + (gameplay_area.length* 0.48f);
 			platforms[5].setVisible(true);
 
-			platform_sprite = platforms[6].spriteComponent()->getSprite();
-			platform_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.525f));
-			platform_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.66f));
+			platform_sprite = &platforms[6].transform();
+			platform_sprite->y = gameplay_area.y + (gameplay_area.height * 0.525f);
+			platform_sprite->x = gameplay_area.x + (gameplay_area.length* 0.66f);
 			platforms[6].setVisible(true);
 
-			platform_sprite = platforms[7].spriteComponent()->getSprite();
-			platform_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.85f));
-			platform_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.72f));
+			platform_sprite = &platforms[7].transform();
+			platform_sprite->y = gameplay_area.y + (gameplay_area.height * 0.85f);
+			platform_sprite->x = gameplay_area.x + (gameplay_area.length* 0.72f);
 			platforms[7].setVisible(true);
 			break;
 		}
@@ -1929,39 +2436,39 @@ rect AngryBirdsGame::setupPlatforms(int map)
 	}
 	else if (level == 1)
 	{
-		ASGE::Sprite* platform_sprite = platforms[0].spriteComponent()->getSprite();
-		platform_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.72f));
-		platform_sprite->xPos(gameplay_area.x);
+		Transform* platform_sprite = &platforms[0].transform();
+		platform_sprite->y = gameplay_area.y + (gameplay_area.height * 0.72f);
+		platform_sprite->x = gameplay_area.x;
 		platforms[0].setVisible(true);
-		platform_sprite = platforms[1].spriteComponent()->getSprite();
-		platform_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.72f));
-		platform_sprite->xPos(gameplay_area.x + platform_sprite->width());
+		platform_sprite = &platforms[1].transform();
+		platform_sprite->y = gameplay_area.y + (gameplay_area.height * 0.72f);
+		platform_sprite->x = gameplay_area.x + platform_sprite->width;
 		platforms[1].setVisible(true);
-		projectile_platform = platforms[1].spriteComponent()->getBoundingBox();
+		projectile_platform = platforms[1].getBoundingBox();
 		switch (map)
 		{
 
 		case 0:
 		{
 
-			platform_sprite = platforms[2].spriteComponent()->getSprite();
-			platform_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.83f));
-			platform_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.46f));
+			platform_sprite = &platforms[2].transform();
+			platform_sprite->y = gameplay_area.y + (gameplay_area.height * 0.83f);
+			platform_sprite->x = gameplay_area.x + (gameplay_area.length* 0.46f);
 			platforms[2].setVisible(true);
 
-			platform_sprite = platforms[3].spriteComponent()->getSprite();
-			platform_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.676f));
-			platform_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.66f));
+			platform_sprite = &platforms[3].transform();
+			platform_sprite->y = gameplay_area.y + (gameplay_area.height * 0.676f);
+			platform_sprite->x = gameplay_area.x + (gameplay_area.length* 0.66f);
 			platforms[3].setVisible(true);
 
-			platform_sprite = platforms[4].spriteComponent()->getSprite();
-			platform_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.89f));
-			platform_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.72f));
+			platform_sprite = &platforms[4].transform();
+			platform_sprite->y = gameplay_area.y + (gameplay_area.height * 0.89f);
+			platform_sprite->x = gameplay_area.x + (gameplay_area.length* 0.72f);
 			platforms[4].setVisible(true);
 
-			platform_sprite = platforms[5].spriteComponent()->getSprite();
-			platform_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.505f));
-			platform_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.48f));
+			platform_sprite = &platforms[5].transform();
+			platform_sprite->y = gameplay_area.y + (gameplay_area.height * 0.505f);
+			platform_sprite->x = gameplay_area.x + (gameplay_area.length* 0.48f);
 			platforms[5].setVisible(true);
 			break;
 		}
@@ -1969,53 +2476,53 @@ rect AngryBirdsGame::setupPlatforms(int map)
 		case 1:
 		{
 
-			platform_sprite = platforms[2].spriteComponent()->getSprite();
-			platform_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.788f));
-			platform_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.44f));
+			platform_sprite = &platforms[2].transform();
+			platform_sprite->y = gameplay_area.y + (gameplay_area.height * 0.788f);
+			platform_sprite->x = gameplay_area.x + (gameplay_area.length* 0.44f);
 			platforms[2].setVisible(true);
 
-			platform_sprite = platforms[3].spriteComponent()->getSprite();
-			platform_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.788f));
-			platform_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.54f));
+			platform_sprite = &platforms[3].transform();
+			platform_sprite->y = gameplay_area.y + (gameplay_area.height * 0.788f);
+			platform_sprite->x = gameplay_area.x + (gameplay_area.length* 0.54f);
 			platforms[3].setVisible(true);
 
-			platform_sprite = platforms[4].spriteComponent()->getSprite();
-			platform_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.79f));
-			platform_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.7f));
+			platform_sprite = &platforms[4].transform();
+			platform_sprite->y = gameplay_area.y + (gameplay_area.height * 0.79f);
+			platform_sprite->x = gameplay_area.x + (gameplay_area.length* 0.7f);
 			platforms[4].setVisible(true);
 
-			platform_sprite = platforms[5].spriteComponent()->getSprite();
-			platform_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.40f));
-			platform_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.50f));
+			platform_sprite = &platforms[5].transform();
+			platform_sprite->y = gameplay_area.y + (gameplay_area.height * 0.40f);
+			platform_sprite->x = gameplay_area.x + (gameplay_area.length* 0.50f);
 			platforms[5].setVisible(true);
 
-			platform_sprite = platforms[6].spriteComponent()->getSprite();
-			platform_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.40f));
-			platform_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.60f));
+			platform_sprite = &platforms[6].transform();
+			platform_sprite->y = gameplay_area.y + (gameplay_area.height * 0.40f);
+			platform_sprite->x = gameplay_area.x + (gameplay_area.length* 0.60f);
 			platforms[6].setVisible(true);
 			break;
 		}
 		case 2:
 		{
-			platform_sprite = platforms[2].spriteComponent()->getSprite();
-			platform_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.64f));
-			platform_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.40f));
+			platform_sprite = &platforms[2].transform();
+			platform_sprite->y = gameplay_area.y + (gameplay_area.height * 0.64f);
+			platform_sprite->x = gameplay_area.x + (gameplay_area.length* 0.40f);
 			platforms[2].setVisible(true);
 
-			platform_sprite = platforms[3].spriteComponent()->getSprite();
-			platform_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.816f));
-			platform_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.54f));
+			platform_sprite = &platforms[3].transform();
+			platform_sprite->y = gameplay_area.y + (gameplay_area.height * 0.816f);
+			platform_sprite->x = gameplay_area.x + (gameplay_area.length* 0.54f);
 			platforms[3].setVisible(true);
 
-			platform_sprite = platforms[4].spriteComponent()->getSprite();
-			platform_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.765f));
-			platform_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.71f));
+			platform_sprite = &platforms[4].transform();
+			platform_sprite->y = gameplay_area.y + (gameplay_area.height * 0.765f);
+			platform_sprite->x = gameplay_area.x + (gameplay_area.length* 0.71f);
 			platforms[4].setVisible(true);
 
 
-			platform_sprite = platforms[5].spriteComponent()->getSprite();
-			platform_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.365f));
-			platform_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.54f));
+			platform_sprite = &platforms[5].transform();
+			platform_sprite->y = gameplay_area.y + (gameplay_area.height * 0.365f);
+			platform_sprite->x = gameplay_area.x + (gameplay_area.length* 0.54f);
 			platforms[5].setVisible(true);
 			break;
 		}
@@ -2023,91 +2530,91 @@ rect AngryBirdsGame::setupPlatforms(int map)
 	}
 	else if (level == 2)
 	{
-		ASGE::Sprite* platform_sprite = platforms[0].spriteComponent()->getSprite();
-		platform_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.775f));
-		platform_sprite->xPos(gameplay_area.x);
+		Transform* platform_sprite = &platforms[0].transform();
+		platform_sprite->y = gameplay_area.y + (gameplay_area.height * 0.775f);
+		platform_sprite->x = gameplay_area.x;
 		platforms[0].setVisible(true);
-		platform_sprite = platforms[1].spriteComponent()->getSprite();
-		platform_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.775f));
-		platform_sprite->xPos(gameplay_area.x + platform_sprite->width());
+		platform_sprite = &platforms[1].transform();
+		platform_sprite->y = gameplay_area.y + (gameplay_area.height * 0.775f);
+		platform_sprite->x = gameplay_area.x + platform_sprite->width;
 		platforms[1].setVisible(true);
-		projectile_platform = platforms[1].spriteComponent()->getBoundingBox();
+		projectile_platform = platforms[1].getBoundingBox();
 		switch (map)
 		{
 		case 0:
 		{
 
-			platform_sprite = platforms[2].spriteComponent()->getSprite();
-			platform_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.855f));
-			platform_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.43f));
+			platform_sprite = &platforms[2].transform();
+			platform_sprite->y = gameplay_area.y + (gameplay_area.height * 0.855f);
+			platform_sprite->x = gameplay_area.x + (gameplay_area.length* 0.43f);
 			platforms[2].setVisible(true);
 
-			platform_sprite = platforms[3].spriteComponent()->getSprite();
-			platform_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.865f));
-			platform_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.56f));
+			platform_sprite = &platforms[3].transform();
+			platform_sprite->y = gameplay_area.y + (gameplay_area.height * 0.865f);
+			platform_sprite->x = gameplay_area.x + (gameplay_area.length* 0.56f);
 			platforms[3].setVisible(true);
 
-			platform_sprite = platforms[4].spriteComponent()->getSprite();
-			platform_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.715f));
-			platform_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.68f));
+			platform_sprite = &platforms[4].transform();
+			platform_sprite->y = gameplay_area.y + (gameplay_area.height * 0.715f);
+			platform_sprite->x = gameplay_area.x + (gameplay_area.length* 0.68f);
 			platforms[4].setVisible(true);
 			break;
 		}
 
 		case 1:
 		{
-			platform_sprite = platforms[2].spriteComponent()->getSprite();
-			platform_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.826f));
-			platform_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.47f));
+			platform_sprite = &platforms[2].transform();
+			platform_sprite->y = gameplay_area.y + (gameplay_area.height * 0.826f);
+			platform_sprite->x = gameplay_area.x + (gameplay_area.length* 0.47f);
 			platforms[2].setVisible(true);
 
-			platform_sprite = platforms[3].spriteComponent()->getSprite();
-			platform_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.515f));
-			platform_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.48f));
+			platform_sprite = &platforms[3].transform();
+			platform_sprite->y = gameplay_area.y + (gameplay_area.height * 0.515f);
+			platform_sprite->x = gameplay_area.x + (gameplay_area.length* 0.48f);
 			platforms[3].setVisible(true);
 
-			platform_sprite = platforms[4].spriteComponent()->getSprite();
-			platform_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.852f));
-			platform_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.68f));
+			platform_sprite = &platforms[4].transform();
+			platform_sprite->y = gameplay_area.y + (gameplay_area.height * 0.852f);
+			platform_sprite->x = gameplay_area.x + (gameplay_area.length* 0.68f);
 			platforms[4].setVisible(true);
 
-			platform_sprite = platforms[5].spriteComponent()->getSprite();
-			platform_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.54f));
-			platform_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.62f));
+			platform_sprite = &platforms[5].transform();
+			platform_sprite->y = gameplay_area.y + (gameplay_area.height * 0.54f);
+			platform_sprite->x = gameplay_area.x + (gameplay_area.length* 0.62f);
 			platforms[5].setVisible(true);
 			break;
 		}
 		case 2:
 		{
-			platform_sprite = platforms[2].spriteComponent()->getSprite();
-			platform_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.715f));
-			platform_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.44f));
+			platform_sprite = &platforms[2].transform();
+			platform_sprite->y = gameplay_area.y + (gameplay_area.height * 0.715f);
+			platform_sprite->x = gameplay_area.x + (gameplay_area.length* 0.44f);
 			platforms[2].setVisible(true);
 
-			platform_sprite = platforms[3].spriteComponent()->getSprite();
-			platform_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.715f));
-			platform_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.54f));
+			platform_sprite = &platforms[3].transform();
+			platform_sprite->y = gameplay_area.y + (gameplay_area.height * 0.715f);
+			platform_sprite->x = gameplay_area.x + (gameplay_area.length* 0.54f);
 			platforms[3].setVisible(true);
 
-			platform_sprite = platforms[4].spriteComponent()->getSprite();
-			platform_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.815f));
-			platform_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.65f));
+			platform_sprite = &platforms[4].transform();
+			platform_sprite->y = gameplay_area.y + (gameplay_area.height * 0.815f);
+			platform_sprite->x = gameplay_area.x + (gameplay_area.length* 0.65f);
 			platforms[4].setVisible(true);
 
 
-			platform_sprite = platforms[5].spriteComponent()->getSprite();
-			platform_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.455f));
-			platform_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.48f));
+			platform_sprite = &platforms[5].transform();
+			platform_sprite->y = gameplay_area.y + (gameplay_area.height * 0.455f);
+			platform_sprite->x = gameplay_area.x + (gameplay_area.length* 0.48f);
 			platforms[5].setVisible(true);
 
-			platform_sprite = platforms[6].spriteComponent()->getSprite();
-			platform_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.455f));
-			platform_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.58f));
+			platform_sprite = &platforms[6].transform();
+			platform_sprite->y = gameplay_area.y + (gameplay_area.height * 0.455f);
+			platform_sprite->x = gameplay_area.x + (gameplay_area.length* 0.58f);
 			platforms[6].setVisible(true);
 
-			platform_sprite = platforms[7].spriteComponent()->getSprite();
-			platform_sprite->yPos(gameplay_area.y + (gameplay_area.height * 0.815f));
-			platform_sprite->xPos(gameplay_area.x + (gameplay_area.length* 0.75f));
+			platform_sprite = &platforms[7].transform();
+			platform_sprite->y = gameplay_area.y + (gameplay_area.height * 0.815f);
+			platform_sprite->x = gameplay_area.x + (gameplay_area.length* 0.75f);
 			platforms[7].setVisible(true);
 			break;
 		}
@@ -2116,123 +2623,90 @@ rect AngryBirdsGame::setupPlatforms(int map)
 	return(projectile_platform);
 }
 /**
-*   @brief   Projectile Collision
-*   @details This function is used to detect collisions projectile
-*   @see     KeyEvent
+*   @brief   Refresh Broadphase
+*   @details This function is used to gather every live object in
+			 the level and rebuild the spatial grid over them. Grid
+			 ids follow the gather order, so they index collision_entities
+*   @see     World, SpatialGrid
 *   @return  void
 */
-void AngryBirdsGame::projectileScatterCollision()
+void AngryBirdsGame::refreshBroadphase()
 {
-	for (int j = 0; j < NUM_PROJECTILES_SCATTER; j++)
-	{
-		rect projectile_rect = projectiles_scatter[j].spriteComponent()->getBoundingBox();
-		vector2 projectile_vel = projectiles_scatter[j].getVelocity();
-		for (int i = 0; i < NUM_PLATFORMS; i++) {
-			rect platformRect = platforms[i].spriteComponent()->getBoundingBox();
-			if ((projectile_rect.isInside(platformRect) ||
-				platformRect.isInside(projectile_rect)) && platforms[i].getVisible())
-			{
-
-				vector2 position_projectile(projectile_rect.x, projectile_rect.y);
-				vector2 position_platform(platformRect.x, platformRect.y);
-				vector2 distance = (position_projectile.subtract(position_platform));
-				float dist2 = position_projectile.getDistance(position_platform);
-
-				if (dist2 <= projectile_rect.length)
-				{
-					vector2 reflection_angle;
-					if (distance.getMagnitude() != 0.0f)
-					{
-						reflection_angle = distance.multiply((
-							projectile_rect.length - distance.getMagnitude()) /
-							distance.getMagnitude());
-
-					}
-					else
-					{
-						distance.setX(projectile_rect.length);
-						distance.setY(0.0f);
-
-						reflection_angle = distance.multiply((projectile_rect.length -
-							(projectile_rect.length - 1.0f)) / (projectile_rect.length - 1.0f));
-					}
+	world.collide(level_grid, collision_targets, collision_entities);
+}
 
-					vector2 v = projectile_vel;
-					float vn = v.getScalar(reflection_angle.normalise());
+/**
+*   @brief   Collision Object
+*   @details This function is used to find the handle of the level
+			 object a collider belongs to
+*   @return  Entity&
+*/
+Entity& AngryBirdsGame::collisionObject(int entity)
+{
+	return *collision_objects[entity];
+}
 
-					if (vn <= 0.0f)
-					{
-						float im1 = 1.f;
-						float im2 = 10.f;
-						float imp = (-(1.0f + RESTITUTION) * vn) / (im1 + im2);
-						vector2 impulse(reflection_angle.multiply(imp));
-
-						projectile_vel = projectile_vel.add(impulse.multiply(im1));
-						projectile_vel.setX(0.f - (projectile_vel.getX() * 0.8f));
-						projectile_vel.setY(0.f - (projectile_vel.getY() * 0.2f));
-
-						while (dist2 <= (projectile_rect.length + 0.01f))
-						{
-							position_projectile.setX(position_projectile.getX() + projectile_vel.getX());
-							position_projectile.setY(position_projectile.getY() + projectile_vel.getY());
-							dist2 = position_projectile.getDistance(position_platform);
-						}
-					}
-					ASGE::Sprite* projectileSprite = projectiles[projectile].spriteComponent()->getSprite();
-					projectileSprite->xPos(position_projectile.getX());
-					projectileSprite->yPos(position_projectile.getY());
-					projectiles[projectile].setVelocity(projectile_vel.getX(), projectile_vel.getY());
-				}
-			}
+/**
+*   @brief   Sub Projectile Collision
+*   @details This function is used to detect collisions for every sub
+			 projectile in a single batched pass against the level
+*   @see     ProjectileSystem
+*   @return  void
+*/
+void AngryBirdsGame::subProjectileCollision()
+{
+	// the targets were gathered by refreshBroadphase this frame
+	projectile_hits.clear();
+	sub_projectiles.collide(collision_targets.data(),
+		(int)collision_targets.size(), projectile_hits);
 
-		}
-		if (projectile_rect.x < gameplay_area.x || projectile_rect.y < gameplay_area.y ||
-			projectile_rect.x + projectile_rect.length > gameplay_area.x + gameplay_area.length ||
-			projectile_rect.y + projectile_rect.height > gameplay_area.y + gameplay_area.height)
+	for (const ProjectileHit& hit : projectile_hits)
+	{
+		// a body can be hit by several projectiles in the same pass
+		int entity = collision_entities[hit.target];
+		if (!world.isVisible(entity))
 		{
-			projectiles_scatter[j].setVisible(false);
+			continue;
 		}
 
-		for (int k = 0; k < NUM_BLOCKS; k++)
+		int response = world.hitResponse(entity);
+		if (response == HIT_SOLID)
+		{
+			sub_projectiles.bounce(hit.projectile, collision_targets[hit.target], RESTITUTION);
+		}
+		else if (response == HIT_BREAK)
 		{
-			rect block = blocks[k].spriteComponent()->getBoundingBox();
-			if (blocks[k].getVisible())
+			Entity& block = collisionObject(entity);
+			int material = world.materials.get(entity).type;
+			breakBlock(block, sub_projectiles.getVelocity(hit.projectile));
+			current_score += 5;
+			float slow_down = .10f;
+			if (material == MATERIAL_EXPLOSIVE)
 			{
-				if (projectile_rect.isInside(block))
-				{
-					current_score += 5;
-					blocks[k].setVisible(false);
-					if (k < 10)
-					{
-
-						vector2 vel = projectiles_scatter[projectile].getVelocity();
-						projectiles_scatter[j].setVelocity(vel.getX() - (vel.getX() * .10f),
-							vel.getY());
-					}
-					else if (k < 30)
-					{
-						current_score += 5;
-						vector2 vel = projectiles_scatter[j].getVelocity();
-						projectiles_scatter[j].setVelocity(vel.getX() - (vel.getX() * .10f),
-							vel.getY());
-					}
-					else if (k < 40)
-					{
-						current_score += 10;
-						vector2 vel = projectiles[projectile].getVelocity();
-						projectiles[projectile].setVelocity(vel.getX() - (vel.getX() * .25f),
-							vel.getY());
-
-					}
-					else if (k < NUM_BLOCKS)
-					{
-						current_score += 50;
-					}
-				}
+				current_score += 50;
+				slow_down = 0.f;
+				detonateBlock(block);
+			}
+			else if (material == MATERIAL_STONE)
+			{
+				current_score += 10;
+				slow_down = .25f;
 			}
+			else if (material == MATERIAL_WOOD)
+			{
+				current_score += 5;
+			}
+			vector2 vel = sub_projectiles.getVelocity(hit.projectile);
+			sub_projectiles.setVelocity(hit.projectile,
+				vel.getX() - (vel.getX() * slow_down), vel.getY());
+		}
+		else
+		{
+			knockOut(collisionObject(entity));
 		}
 	}
 
+	sub_projectiles.cull(gameplay_area);
 }
 
 /**
@@ -2243,12 +2717,12 @@ void AngryBirdsGame::projectileScatterCollision()
 */
 void AngryBirdsGame::projectileCollision()
 {
-	rect projectile_rect = projectiles[projectile].spriteComponent()->getBoundingBox();
+	rect projectile_rect = projectiles[projectile].getBoundingBox();
 	vector2 projectile_vel = projectiles[projectile].getVelocity();
-	for (int i = 0; i < NUM_PLATFORMS; i++) {
-		rect platformRect = platforms[i].spriteComponent()->getBoundingBox();
-		if ((projectile_rect.isInside(platformRect) || 
-			platformRect.isInside(projectile_rect)) && platforms[i].getVisible())
+	for (int i : active_platforms) {
+		rect platformRect = platforms[i].getBoundingBox();
+		if (projectile_rect.isInside(platformRect) || 
+			platformRect.isInside(projectile_rect))
 		{
 
 			vector2 position_projectile(projectile_rect.x, projectile_rect.y);
@@ -2296,9 +2770,9 @@ void AngryBirdsGame::projectileCollision()
 						dist2 = position_projectile.getDistance(position_platform);
 					}
 				}
-				ASGE::Sprite* projectileSprite = projectiles[projectile].spriteComponent()->getSprite();
-				projectileSprite->xPos(position_projectile.getX());
-				projectileSprite->yPos(position_projectile.getY());
+				Transform* projectileSprite = &projectiles[projectile].transform();
+				projectileSprite->x = position_projectile.getX();
+				projectileSprite->y = position_projectile.getY();
 				projectiles[projectile].setVelocity(projectile_vel.getX(), projectile_vel.getY());
 			}
 		}
@@ -2335,17 +2809,21 @@ void AngryBirdsGame::projectileCollision()
 */
 void AngryBirdsGame::levelCollision()
 {
-	rect projectile_rect = projectiles[projectile].spriteComponent()->getBoundingBox();
-	for (int i = 0; i < NUM_BLOCKS; i++)
+	rect projectile_rect = projectiles[projectile].getBoundingBox();
+
+	// blasts can remove any block, so walk a copy of the active list
+	active_scratch.assign(active_blocks.begin(), active_blocks.end());
+	for (int i : active_scratch)
 	{
-		rect block = blocks[i].spriteComponent()->getBoundingBox();
+		rect block = blocks[i].getBoundingBox();
 		if (blocks[i].getVisible())
 		{
 			if (projectile_rect.isInside(block))
 			{
 				current_score += 5;
-				blocks[i].setVisible(false);
-				if (i < 10)
+				int material = world.materials.get(blocks[i].getId()).type;
+				breakBlock(blocks[i], projectiles[projectile].getVelocity());
+				if (material == MATERIAL_GLASS)
 				{
 					if (projectile == 3)
 					{
@@ -2360,7 +2838,7 @@ void AngryBirdsGame::levelCollision()
 							vel.getY());
 					}
 				}
-				else if (i < 30)
+				else if (material == MATERIAL_WOOD)
 				{
 					current_score += 5;
 					if (projectile == 4)
@@ -2383,7 +2861,7 @@ void AngryBirdsGame::levelCollision()
 							vel.getY());
 					}
 				}
-				else if (i < 40)
+				else if (material == MATERIAL_STONE)
 				{
 					current_score += 10;
 					if (projectile < 4)
@@ -2400,9 +2878,10 @@ void AngryBirdsGame::levelCollision()
 							vel.getY());
 					}
 				}
-				else if (i < NUM_BLOCKS)
+				else if (material == MATERIAL_EXPLOSIVE)
 				{
 					current_score += 50;
+					detonateBlock(blocks[i]);
 				}
 			}
 		}
@@ -2418,71 +2897,65 @@ void AngryBirdsGame::levelCollision()
 */
 void AngryBirdsGame::enemyCollision()
 {
-	
-	for (int i = 0; i < NUM_ENEMIES; i++)
-	{
-		if (enemies[i].getVisible())
-		{
-			float newVelY = 1.f;
-			rect enemy_rect = enemies[i].spriteComponent()->getBoundingBox();
-			for (int j = 0; j < NUM_BLOCKS; j++)
-			{
-				if (blocks[j].getVisible())
-				{
-					rect block = blocks[j].spriteComponent()->getBoundingBox();
-					if (enemy_rect.y + enemy_rect.height > block.y && 
-						enemy_rect.isBetween(enemy_rect.x + (enemy_rect.length * 0.5f),
-							block.x - (enemy_rect.length * 0.5f),
-							block.x + block.length + (enemy_rect.length * 0.5f)))
-					{
-						newVelY = 0.f;
-						ASGE::Sprite* enemySprite = enemies[i].spriteComponent()->getSprite();
-						enemySprite->yPos(block.y - enemy_rect.height);
-					}
-				}
-			}
-			for (int k = 0; k < NUM_PLATFORMS; k++)
+	// walked backwards, so an enemy that is hit can leave the list
+	for (int n = active_enemies.size() - 1; n >= 0; n--)
+	{
+		int i = active_enemies[n];
+		float newVelY = 1.f;
+		rect enemy_rect = enemies[i].getBoundingBox();
+
+		// an enemy rests on the highest numbered block or platform under it
+		int resting_block = -1;
+		for (int j : active_blocks)
+		{
+			rect block = blocks[j].getBoundingBox();
+			if (j > resting_block && enemy_rect.y + enemy_rect.height > block.y &&
+				enemy_rect.isBetween(enemy_rect.x + (enemy_rect.length * 0.5f),
+					block.x - (enemy_rect.length * 0.5f),
+					block.x + block.length + (enemy_rect.length * 0.5f)))
 			{
-				if (platforms[k].getVisible())
-				{
-					rect platform = platforms[k].spriteComponent()->getBoundingBox();
-					if (enemy_rect.isBetween(enemy_rect.y + (enemy_rect.height * 0.5f),
-						platform.y - (enemy_rect.height * 0.5f),
-						platform.y + platform.height) &&
-						enemy_rect.isBetween(enemy_rect.x + (enemy_rect.length * 0.5f),
-							platform.x - (enemy_rect.length * 0.5f),
-							platform.x + platform.length + (enemy_rect.length * 0.5f)))
-					{
-						newVelY = 0.f;
-						ASGE::Sprite* enemySprite = enemies[i].spriteComponent()->getSprite();
-						enemySprite->yPos(platform.y - enemy_rect.height);
-					}
-				}
+				resting_block = j;
 			}
-			vector2 vel = enemies[i].getVelocity();
-			enemies[i].setVelocity(vel.getX(), newVelY);
-
-			rect projectile_rect = projectiles[projectile].spriteComponent()->getBoundingBox();
-			if ((projectile_rect.isInside(enemy_rect) || 
-				enemy_rect.isInside(projectile_rect)) && enemies[i].getVisible())
+		}
+		int resting_platform = -1;
+		for (int k : active_platforms)
+		{
+			rect platform = platforms[k].getBoundingBox();
+			if (k > resting_platform &&
+				enemy_rect.isBetween(enemy_rect.y + (enemy_rect.height * 0.5f),
+				platform.y - (enemy_rect.height * 0.5f),
+				platform.y + platform.height) &&
+				enemy_rect.isBetween(enemy_rect.x + (enemy_rect.length * 0.5f),
+					platform.x - (enemy_rect.length * 0.5f),
+					platform.x + platform.length + (enemy_rect.length * 0.5f)))
 			{
-				current_score += 150;
-				enemies[i].setVisible(false);
-				no_enemies_hit++;
-			}
-			for (int j = 0; j < NUM_PROJECTILES_SCATTER; j++)
-			{
-				rect projectile_scatter_rect = projectiles_scatter[j].spriteComponent()->getBoundingBox();
-				if ((projectile_scatter_rect.isInside(enemy_rect) ||
-					enemy_rect.isInside(projectile_scatter_rect)) && enemies[i].getVisible() && projectiles_scatter[j].getVisible())
-				{
-					current_score += 150;
-					enemies[i].setVisible(false);
-					no_enemies_hit++;
-				}
+				resting_platform = k;
 			}
 		}
+		Transform* enemySprite = &enemies[i].transform();
+		if (resting_block >= 0)
+		{
+			newVelY = 0.f;
+			enemySprite->y = blocks[resting_block].getBoundingBox().y -
+				enemy_rect.height;
+		}
+		if (resting_platform >= 0)
+		{
+			newVelY = 0.f;
+			enemySprite->y = platforms[resting_platform].getBoundingBox().y -
+				enemy_rect.height;
+		}
+		vector2 vel = enemies[i].getVelocity();
+		enemies[i].setVelocity(vel.getX(), newVelY);
 
+		rect projectile_rect = projectiles[projectile].getBoundingBox();
+		if (projectile_rect.isInside(enemy_rect) || 
+			enemy_rect.isInside(projectile_rect))
+		{
+			current_score += 150;
+			enemies[i].setVisible(false);
+			no_enemies_hit++;
+		}
 	}
 }
 
@@ -2495,203 +2968,352 @@ provided projectiles co-ordinates
 */
 void AngryBirdsGame::releaseBomb(rect projectile)
 {
-	ASGE::Sprite* bomb_sprite = bomb.spriteComponent()->getSprite();
-	bomb_sprite->yPos(projectile.y);
-	bomb_sprite->xPos(projectile.x + ((projectile.length * 0.5f) - (bomb_sprite->width() * 0.5f)));
-	bomb_sprite->height(gameplay_area.height * BOMB_SIZE);
-	bomb_sprite->width(gameplay_area.height * BOMB_SIZE);
-	bomb.setVelocity(0.f, 1.f);
-	bomb.setVisible(true);	
+	EffectBody* bomb = bombs.acquire();
+	if (bomb == nullptr)
+	{
+		return;
+	}
+	Transform* bomb_sprite = &bomb->transform;
+	bomb_sprite->y = projectile.y;
+	bomb_sprite->x = projectile.x + ((projectile.length * 0.5f) - (bomb_sprite->width * 0.5f));
 }
 
 /**
-*   @brief   Reset Bomb
-*   @details This function is used to reset a bomb
-position and velocity
+*   @brief   Release Projectile Scatter
+*   @details This function is used to split the projectile into
+			 scatter shots at its current position and velocity
 *   @see     KeyEvent
 *   @return  void
 */
-void AngryBirdsGame::resetBomb()
+void AngryBirdsGame::releaseProjectileScatter(rect projectile, vector2 velocity)
+{
+	// fan the sub projectiles out evenly around the parent's velocity
+	for (int i = 0; i < NUM_PROJECTILES_SCATTER; i++)
+	{
+		float spread = NUM_PROJECTILES_SCATTER > 1 ?
+			4.f - (8.f * i / (NUM_PROJECTILES_SCATTER - 1)) : 0.f;
+		sub_projectiles.spawn(projectile.x, projectile.y,
+			projectile.length, projectile.height,
+			vector2(velocity.getX(), velocity.getY() + spread));
+	}
+}
+
+/**
+*   @brief   Clear Effects
+*   @details This function is used to remove every bomb and scatter
+			 shot still in flight. Pooled effects start from their
+			 defaults when spawned, so there is nothing else to reset
+*   @see     EffectPool
+*   @return  void
+*/
+void AngryBirdsGame::clearEffects()
 {
 	bomb_active = false;
-	// reset sprite position, velocity and visibility
-	ASGE::Sprite* bomb_sprite = bomb.spriteComponent()->getSprite();
-	bomb_sprite->yPos(0.f);
-	bomb_sprite->xPos(0.f);
-	bomb_sprite->height(gameplay_area.height * BOMB_SIZE);
-	bomb_sprite->width(gameplay_area.height * BOMB_SIZE);
-	bomb.setVisible(false);
-	bomb.setVelocity(0.f, 0.f);
+	scatter_active = false;
+	bombs.clear();
+	sub_projectiles.clear();
 }
 
 /**
-*   @brief   Release Projectile Scatter
-*   @details This function is used to reset a scatter shot's
-position and velocity
-*   @see     KeyEvent
+*   @brief   Bomb Collision
+*   @details This function is used to detonate the bomb when it
+			 touches any object in the level
+*   @see     explode
 *   @return  void
 */
-void AngryBirdsGame::releaseProjectileScatter(rect projectile, vector2 velocity)
+void AngryBirdsGame::bombCollision()
 {
-	for (int i = 0; i < NUM_PROJECTILES_SCATTER; i++)
+	for (int i = bombs.size() - 1; i >= 0; i--)
 	{
-		// reset sprite position, velocity and visibility
-		ASGE::Sprite* projectiles_scatter_sprite = projectiles_scatter[i].spriteComponent()->getSprite();
-		projectiles_scatter_sprite->yPos(projectile.y);
-		projectiles_scatter_sprite->xPos(projectile.x);
-		projectiles_scatter_sprite->height(projectile.height);
-		projectiles_scatter_sprite->width(projectile.length);
-		projectiles_scatter[i].setVisible(true);
-		if (i == 1)
+		const Transform& bomb = bombs[i].transform;
+		rect bomb_rect;
+		bomb_rect.x = bomb.x;
+		bomb_rect.y = bomb.y;
+		bomb_rect.length = bomb.width;
+		bomb_rect.height = bomb.height;
+
+		bool detonate = false;
+		query_results.clear();
+		level_grid.query(bomb_rect, query_results);
+		for (int entry : query_results)
 		{
-			projectiles_scatter[i].setVelocity(velocity.getX(), velocity.getY() - 4.f);
+			if (world.isVisible(collision_entities[entry]))
+			{
+				detonate = true;
+			}
 		}
-		else
+
+		if (detonate)
 		{
-			projectiles_scatter[i].setVelocity(velocity.getX(), velocity.getY() + 4.f);
+			bombs.release(i);
+			explode(bomb_rect.x + bomb_rect.length * 0.5f,
+				bomb_rect.y + bomb_rect.height * 0.5f,
+				bomb_rect.length * BOMB_BLAST_RADIUS, EXPLOSION_IMPULSE);
+		}
+		else if (bomb_rect.y + bomb_rect.height > gameplay_area.y + gameplay_area.height)
+		{
+			// the bomb is lost once it falls out of the level
+			bombs.release(i);
 		}
 	}
 }
 
 /**
-*   @brief   Reset Projectile Scatter
-*   @details This function is used to reset a scatter shot's
-position and velocity
-*   @see     KeyEvent
+*   @brief   Explode
+*   @details This function is used to queue a blast and resolve it.
+			 Each blast is one circle query against the broadphase,
+			 with damage and impulse falling off linearly with the
+			 distance to the closest point of each object. Explosive
+			 blocks that break queue their own blast, so chains are
+			 resolved in order without recursing
+*   @see     ExplosionQueue
 *   @return  void
 */
-void AngryBirdsGame::resetProjectileScatter()
+void AngryBirdsGame::explode(float x, float y, float radius, float impulse)
 {
-	for (int i = 0; i < NUM_PROJECTILES_SCATTER; i++)
-	{
-		// reset sprite position, velocity and visibility
-		scatter_active = false;
-		ASGE::Sprite* projectiles_scatter_sprite = projectiles_scatter[i].spriteComponent()->getSprite();
-		projectiles_scatter_sprite->rotationInRadians(0.f);
-		projectiles_scatter_sprite->yPos(0.f);
-		projectiles_scatter_sprite->xPos(0.f);
-		projectiles_scatter[i].setVisible(false);
-		projectiles_scatter[i].setVelocity(0.f, 0.f);
+	Explosion blast;
+	blast.x = x;
+	blast.y = y;
+	blast.radius = radius;
+	blast.impulse = impulse;
+	// the queue is sized for the longest chain the level allows, and
+	// a blast it still drops is counted and shown on the overlay
+	explosions.push(blast);
+	if (exploding)
+	{
+		// already resolving a chain, this blast is handled in turn
+		return;
+	}
+
+	exploding = true;
+	while (explosions.pop(blast))
+	{
+		query_results.clear();
+		level_grid.queryCircle(blast.x, blast.y, blast.radius, query_results);
+		for (int entry : query_results)
+		{
+			int entity = collision_entities[entry];
+			int response = world.hitResponse(entity);
+			if (response == HIT_SOLID || !world.isVisible(entity))
+			{
+				continue;
+			}
+
+			Entity& object = collisionObject(entity);
+			float falloff = 1.f - (level_grid.distanceTo(entry, blast.x, blast.y) / blast.radius);
+			if (!object.damage(blast.impulse * falloff))
+			{
+				continue;
+			}
+
+			if (response == HIT_KNOCK_OUT)
+			{
+				knockOut(object);
+				continue;
+			}
+
+			breakBlock(object, blastImpulse(blast, level_grid.getBounds(entry)));
+			current_score += breakScore(object);
+			if (world.materials.get(entity).type == MATERIAL_EXPLOSIVE)
+			{
+				detonateBlock(object);
+			}
+		}
+
+		// push anything still in flight away from the centre
+		for (int i = 0; i < sub_projectiles.size(); i++)
+		{
+			vector2 push = blastImpulse(blast, sub_projectiles.getBoundingBox(i));
+			vector2 vel = sub_projectiles.getVelocity(i);
+			sub_projectiles.setVelocity(i, vel.getX() + push.getX(), vel.getY() + push.getY());
+		}
+		if (flying)
+		{
+			vector2 push = blastImpulse(blast,
+				projectiles[projectile].getBoundingBox());
+			vector2 vel = projectiles[projectile].getVelocity();
+			projectiles[projectile].setVelocity(vel.getX() + push.getX(), vel.getY() + push.getY());
+		}
 	}
+	exploding = false;
 }
 
 /**
-*   @brief   Bomb Collision
-*   @details This function is used to boost the projectiles velocity
-*   @see     KeyEvent
+*   @brief   Detonate Block
+*   @details This function is used to set off an explosive block,
+			 the blast scales with the size of the block
+*   @see     explode
 *   @return  void
 */
-void AngryBirdsGame::bombCollision()
+void AngryBirdsGame::detonateBlock(const Entity& block)
 {
-	rect explosion;
-	explosion.x = 0;
-	explosion.y = 0;
-	explosion.height = 0;
-	explosion.length = 0;
-	rect bomb_rect = bomb.spriteComponent()->getBoundingBox();
-	for (int i = 0; i < NUM_ENEMIES; i++)
+	rect block_rect = block.getBoundingBox();
+	float size = block_rect.length > block_rect.height ? block_rect.length : block_rect.height;
+	explode(block_rect.x + block_rect.length * 0.5f,
+		block_rect.y + block_rect.height * 0.5f,
+		size * EXPLOSIVE_BLAST_RADIUS, EXPLOSION_IMPULSE);
+}
+
+/**
+*   @brief   Blast Impulse
+*   @details This function is used to find the change in velocity a
+			 blast gives a body, directed from the centre of the blast
+			 through the centre of the body
+*   @return  vector2
+*/
+vector2 AngryBirdsGame::blastImpulse(const Explosion& blast, const rect& body) const
+{
+#ifdef DETERMINISTIC_PHYSICS
+	// measured in blast radii, so squaring stays inside the 16.16 range
+	const Fixed half = Fixed::fromRaw(Fixed::ONE / 2);
+	const Fixed one = Fixed::fromInt(1);
+	Fixed radius = Fixed::fromFloat(blast.radius);
+	Fixed dx = Fixed::fromFloat(body.x) + Fixed::fromFloat(body.length) * half -
+		Fixed::fromFloat(blast.x);
+	Fixed dy = Fixed::fromFloat(body.y) + Fixed::fromFloat(body.height) * half -
+		Fixed::fromFloat(blast.y);
+	if (dx >= radius || -dx >= radius || dy >= radius || -dy >= radius)
 	{
-		if (enemies[i].getVisible())
-		{
-			rect enemy_rect = enemies[i].spriteComponent()->getBoundingBox();
-			if (bomb_rect.isInside(enemy_rect) || enemy_rect.isInside(bomb_rect) && bomb.getVisible())
-			{
-				bomb.setVisible(false);
-				current_score += 150;
-				enemies[i].setVisible(false);
-				no_enemies_hit++;
-				explosion.x = bomb_rect.x - bomb_rect.length * 4.f;
-				explosion.y = bomb_rect.y - bomb_rect.length * 4.f;
-				explosion.length = bomb_rect.length * 9.f;
-				explosion.height = bomb_rect.height * 9.f;
-			}
-		}
+		return vector2(0.f, 0.f);
 	}
-	for (int i = 0; i < NUM_BLOCKS; i++)
+
+	dx = dx / radius;
+	dy = dy / radius;
+	Fixed distance = fixedSqrt(dx * dx + dy * dy);
+	if (distance >= one || distance <= Fixed())
 	{
-		if (blocks[i].getVisible())
-		{
-			rect block_rect = blocks[i].spriteComponent()->getBoundingBox();
-			if (bomb_rect.isInside(block_rect) || block_rect.isInside(bomb_rect) && bomb.getVisible())
-			{
-				bomb.setVisible(false);
-				if (i < 10)
-				{
-					current_score += 5;
-				}
-				else if (i < 30)
-				{
-					current_score += 10;
-				}
-				else if (i < 40)
-				{
-					current_score += 15;
-				}			
-				blocks[i].setVisible(false);
-				explosion.x = bomb_rect.x - bomb_rect.length * 4.f;
-				explosion.y = bomb_rect.y - bomb_rect.length * 4.f;
-				explosion.length = bomb_rect.length * 9.f;
-				explosion.height = bomb_rect.height * 9.f;
-			}
-		}
+		return vector2(0.f, 0.f);
 	}
-	for (int i = 0; i < NUM_PLATFORMS; i++)
+
+	Fixed strength = Fixed::fromFloat(blast.impulse) * Fixed::fromFloat(EXPLOSION_PUSH) *
+		(one - distance);
+	return vector2((dx / distance * strength).toFloat(),
+		(dy / distance * strength).toFloat());
+#else
+	float dx = (body.x + body.length * 0.5f) - blast.x;
+	float dy = (body.y + body.height * 0.5f) - blast.y;
+	float distance = sqrtf(dx * dx + dy * dy);
+	if (distance >= blast.radius || distance <= 0.f)
 	{
-		if (platforms[i].getVisible())
-		{
-			rect platform_rect = platforms[i].spriteComponent()->getBoundingBox();
-			if (bomb_rect.isInside(platform_rect) || platform_rect.isInside(bomb_rect) && bomb.getVisible())
-			{
-				bomb.setVisible(false);
-				explosion.x = bomb_rect.x - bomb_rect.length * 4.f;
-				explosion.y = bomb_rect.y - bomb_rect.length * 4.f;
-				explosion.length = bomb_rect.length * 9.f;
-				explosion.height = bomb_rect.height * 9.f;
-			}
-		}
+		return vector2(0.f, 0.f);
 	}
-	if (bomb_rect.y + bomb_rect.height > gameplay_area.y)
+
+	float strength = blast.impulse * EXPLOSION_PUSH * (1.f - (distance / blast.radius));
+	return vector2(dx / distance * strength, dy / distance * strength);
+#endif
+}
+
+/**
+*   @brief   Block Health
+*   @details This function is used to find how much blast damage a
+			 block can take, based on its material
+*   @return  float
+*/
+float AngryBirdsGame::blockHealth(const Entity& block) const
+{
+	switch (world.materials.get(block.getId()).type)
 	{
-		bomb.setVisible(false);
+	case MATERIAL_EXPLOSIVE:
+		return HEALTH_EXPLOSIVE;
+	case MATERIAL_STONE:
+		return HEALTH_STONE;
+	case MATERIAL_WOOD:
+		return HEALTH_WOOD;
+	default:
+		return HEALTH_GLASS;
 	}
-	for (int i = 0; i < NUM_ENEMIES; i++)
+}
+
+/**
+*   @brief   Break Block
+*   @details This function is used to remove a block from the level
+			 and break it into debris. Softer materials shatter into
+			 more pieces
+*   @see     DebrisPool
+*   @return  void
+*/
+void AngryBirdsGame::breakBlock(Entity& block, vector2 velocity)
+{
+	block.setVisible(false);
+
+	int pieces = 2 + random.below(3);
+	int material = world.materials.get(block.getId()).type;
+	if (material == MATERIAL_GLASS || material == MATERIAL_EXPLOSIVE)
 	{
-		if (enemies[i].getVisible())
-		{
-			rect enemy_rect = enemies[i].spriteComponent()->getBoundingBox();
-			if (explosion.isInside(enemy_rect) || enemy_rect.isInside(explosion) && bomb.getVisible())
-			{
-				bomb.setVisible(false);
-				current_score += 150;
-				enemies[i].setVisible(false);
-				no_enemies_hit++;
-			}
-		}
+		pieces = 6 + random.below(3);
 	}
-	for (int i = 0; i < NUM_BLOCKS; i++)
+	else if (material == MATERIAL_STONE)
 	{
-		if (blocks[i].getVisible())
+		pieces = 3 + random.below(3);
+	}
+	const Sprite& block_sprite = block.sprite();
+	debris.shatter(block_sprite.texture, block_sprite.source,
+		block.getBoundingBox(), velocity, pieces, random);
+}
+
+/**
+*   @brief   Break Score
+*   @details This function is used to find the score for a block
+			 broken by a blast or a gust, based on its material
+*   @return  int
+*/
+int AngryBirdsGame::breakScore(const Entity& block) const
+{
+	switch (world.materials.get(block.getId()).type)
+	{
+	case MATERIAL_EXPLOSIVE:
+		return 50;
+	case MATERIAL_STONE:
+		return 15;
+	case MATERIAL_WOOD:
+		return 10;
+	default:
+		return 5;
+	}
+}
+
+/**
+*   @brief   Knock Out
+*   @details This function is used to take a pig out of play and
+			 score it
+*   @return  void
+*/
+void AngryBirdsGame::knockOut(Entity& enemy)
+{
+	enemy.setVisible(false);
+	current_score += 150;
+	no_enemies_hit++;
+}
+
+/**
+*   @brief   Debris Collision
+*   @details This function is used to collide debris with the level.
+			 Debris only rests on blocks and platforms, never on pigs
+			 or other debris, so each fragment is one grid query
+*   @see     DebrisPool
+*   @return  void
+*/
+void AngryBirdsGame::debrisCollision()
+{
+	for (int i = 0; i < debris.capacity(); i++)
+	{
+		if (!debris.isLive(i))
+		{
+			continue;
+		}
+
+		query_results.clear();
+		level_grid.query(debris.getBoundingBox(i), query_results);
+		for (int entry : query_results)
 		{
-			rect block_rect = blocks[i].spriteComponent()->getBoundingBox();
-			if (explosion.isInside(block_rect) || block_rect.isInside(explosion) && bomb.getVisible())
+			int entity = collision_entities[entry];
+			if (world.hitResponse(entity) != HIT_KNOCK_OUT && world.isVisible(entity))
 			{
-				bomb.setVisible(false);
-				if (i < 10)
-				{
-					current_score += 5;
-				}
-				else if (i < 30)
-				{
-					current_score += 10;
-				}
-				else if (i < 40)
-				{
-					current_score += 15;
-				}
-				blocks[i].setVisible(false);
+				debris.bounce(i, level_grid.getBounds(entry), DEBRIS_RESTITUTION);
 			}
 		}
 	}
+	debris.cull(gameplay_area);
 }
 
 /**
@@ -2803,21 +3425,23 @@ void AngryBirdsGame::loadLevelMap(int map)
 {
 	// load high scores
 	int map_to_load = map + (level * 3);
+	char* line = level_arena.allocate<char>(LEVEL_LINE_LENGTH);
+	char* file_buffer = level_arena.allocate<char>(LEVEL_FILE_BUFFER);
+	snprintf(line, LEVEL_LINE_LENGTH, "Resources\\Levels\\level_map_%d.txt", map_to_load);
 	std::ifstream inFile_one;
-	std::string level_map_filename;
-	level_map_filename = "Resources\\Levels\\level_map_" + std::to_string(map_to_load) + ".txt";
-	inFile_one.open(level_map_filename);
+	inFile_one.open(line);
 	if (!inFile_one.fail())
 	{
+		// read through the arena rather than a heap buffer
+		inFile_one.rdbuf()->pubsetbuf(file_buffer, LEVEL_FILE_BUFFER);
 		for (int i = 0; i < NUM_BLOCKS; i++)
 		{
-			std::string a, b, c;
-			getline(inFile_one, a);
-			getline(inFile_one, b);
-			getline(inFile_one, c);
-			level_map[i].block_index = atoi(a.c_str());
-			level_map[i].x_index = atoi(b.c_str());
-			level_map[i].y_index = atoi(c.c_str());
+			inFile_one.getline(line, LEVEL_LINE_LENGTH);
+			level_map[i].block_index = atoi(line);
+			inFile_one.getline(line, LEVEL_LINE_LENGTH);
+			level_map[i].x_index = atoi(line);
+			inFile_one.getline(line, LEVEL_LINE_LENGTH);
+			level_map[i].y_index = atoi(line);
 		}
 		inFile_one.close();
 	}
@@ -2832,14 +3456,7 @@ void AngryBirdsGame::loadLevelMap(int map)
 */
 void AngryBirdsGame::resetProjectiles()
 {
-	if (bomb_active)
-	{
-		resetBomb();
-	}
-	if (scatter_active)
-	{
-		resetProjectileScatter();
-	}
+	clearEffects();
 	if (boost_active)
 	{
 		boost_active = false;
@@ -2850,27 +3467,27 @@ void AngryBirdsGame::resetProjectiles()
 	}
 	bool firstVisible = false;
 	int numProjectiles = 0;
-	rect platform = platforms[0].spriteComponent()->getBoundingBox();
+	rect platform = platforms[0].getBoundingBox();
 	for (int i = 0; i < NUM_PROJECTILES; i++)
 	{
 		if (projectiles[i].getVisible() == true)
 		{
-			ASGE::Sprite* projectile_sprite = projectiles[i].spriteComponent()->getSprite();
-			projectile_sprite->rotationInRadians(0.f);
+			Transform* projectile_sprite = &projectiles[i].transform();
+			projectile_sprite->rotation = 0.f;
 			if (!firstVisible)
 			{
 				firstVisible = true;
-				projectile_sprite->yPos(slingshot_center.getY());
-				projectile_sprite->xPos(slingshot_center.getX());
+				projectile_sprite->y = slingshot_center.getY();
+				projectile_sprite->x = slingshot_center.getX();
 				numProjectiles++;
 				projectile = i;
 			}
 
 			else
 			{
-				projectile_sprite->yPos(platform.y - projectile_sprite->height());
-				projectile_sprite->xPos(platform.x + platform.length -
-					(((numProjectiles - 1) * 1.5f) * (game_height * PROJECTILE_SIZE)));
+				projectile_sprite->y = platform.y - projectile_sprite->height;
+				projectile_sprite->x = platform.x + platform.length -
+					(((numProjectiles - 1) * 1.5f) * (WORLD_HEIGHT * PROJECTILE_SIZE));
 				numProjectiles++;
 			}
 		}
@@ -2879,56 +3496,70 @@ void AngryBirdsGame::resetProjectiles()
 
 /**
 *   @brief   Wind Breath
-*   @details This function is used to detect collisions with the wind breath
-*   @see     KeyEvent
+*   @details This function is used to blow away everything in front
+			 of the projectile. A box three times the bird's height is
+			 swept ahead of it through the grid, so even the thinnest
+			 block it passes over is caught. A platform shelters what
+			 lies behind it at the same height, as the wind cannot blow
+			 through the level
+*   @see     SpatialGrid
 *   @return  void
 */
 void AngryBirdsGame::windBreath()
 {
-	rect wind = projectiles[projectile].spriteComponent()->getBoundingBox();
-	wind.x = wind.x + wind.length;
-	wind.length = wind.length * 4.f;
-	wind.y = wind.y - wind.height;
-	wind.height = wind.height * 3.f;
-	for (int i = 0; i < NUM_ENEMIES; i++)
-	{
-		if (enemies[i].getVisible())
-		{
-			rect enemy_rect = enemies[i].spriteComponent()->getBoundingBox();
-
-			if (wind.isInside(enemy_rect) ||
-				enemy_rect.isInside(wind) && enemies[i].getVisible())
+	rect bird = projectiles[projectile].getBoundingBox();
+	vector2 velocity = projectiles[projectile].getVelocity();
+	rect wind;
+	wind.x = bird.x + bird.length;
+	wind.y = bird.y - bird.height;
+	wind.length = 0.f;
+	wind.height = bird.height * 3.f;
+	auto visible = [this](int entry)
+	{
+		return world.isVisible(collision_entities[entry]);
+	};
+	auto sheltered = [this](size_t hit)
+	{
+		const rect& target = level_grid.getBounds(ray_hits[hit].id);
+		for (size_t i = 0; i < hit; i++)
+		{
+			const rect& cover = level_grid.getBounds(ray_hits[i].id);
+			if (world.hitResponse(collision_entities[ray_hits[i].id]) == HIT_SOLID &&
+				ray_hits[i].distance < ray_hits[hit].distance &&
+				cover.y < target.y + target.height &&
+				target.y < cover.y + cover.height)
 			{
-				current_score += 150;
-				enemies[i].setVisible(false);
-				no_enemies_hit++;
+				return true;
 			}
 		}
+		return false;
+	};
 
-	}
+	ray_hits.clear();
+	level_grid.sweepAll(wind, bird.length * WIND_REACH, 0.f, ray_hits, visible);
+	for (size_t i = 0; i < ray_hits.size(); i++)
+	{
+		int entity = collision_entities[ray_hits[i].id];
+		int response = world.hitResponse(entity);
+		if (response == HIT_SOLID || sheltered(i) || !world.isVisible(entity))
+		{
+			// solid ground stays put, and a blast earlier in the gust
+			// may already have cleared this one
+			continue;
+		}
 
+		Entity& object = collisionObject(entity);
+		if (response == HIT_KNOCK_OUT)
+		{
+			knockOut(object);
+			continue;
+		}
 
-	for (int i = 0; i < NUM_BLOCKS; i++)
-	{
-		if (blocks[i].getVisible())
+		breakBlock(object, velocity);
+		current_score += breakScore(object);
+		if (world.materials.get(entity).type == MATERIAL_EXPLOSIVE)
 		{
-			rect block_rect = blocks[i].spriteComponent()->getBoundingBox();
-			if (wind.isInside(block_rect) || block_rect.isInside(wind) && bomb.getVisible())
-			{
-				if (i < 10)
-				{
-					current_score += 5;
-				}
-				else if (i < 30)
-				{
-					current_score += 10;
-				}
-				else if (i < 40)
-				{
-					current_score += 15;
-				}
-				blocks[i].setVisible(false);
-			}
+			detonateBlock(object);
 		}
 	}
 }
\ No newline at end of file
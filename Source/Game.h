@@ -3,11 +3,32 @@
 #include <Engine/OGLGame.h>
 #include <fstream>
 #include <iostream>
+#include <mutex>
+#include <vector>
 
 
-#include "GameObject.h"
+#include "Entity.h"
+#include "Picture.h"
+#include "World.h"
 #include "Constants.h"
 #include "Rect.h"
+#include "Trajectory.h"
+#include "ProjectileSystem.h"
+#include "SpatialGrid.h"
+#include "Explosion.h"
+#include "DebrisPool.h"
+#include "EffectPool.h"
+#include "ActiveList.h"
+#include "DrawBuffer.h"
+#include "AsgeBackend.h"
+#include "ViewTransform.h"
+#include "TextureAtlas.h"
+#include "TextCache.h"
+#include "JobSystem.h"
+#include "FramePacer.h"
+#include "LevelArena.h"
+#include "Random.h"
+#include "Snapshot.h"
 
 
 
@@ -24,6 +45,20 @@ struct LevelPosIndex
 	int y_index = 0;
 };
 
+/**
+*  A key or click queued by an input callback for the next tick.
+*  Clicks carry the cursor position, in world units once taken.
+*/
+struct InputEvent
+{
+	bool click = false;
+	int key = 0;
+	int action = 0;
+	int mods = 0;
+	float x = 0.f;
+	float y = 0.f;
+};
+
 
 
 /**
@@ -36,14 +71,28 @@ public:
 	AngryBirdsGame();
 	~AngryBirdsGame();
 	virtual bool init() override;
+
+	/**
+	*  Saves a level mid-flight, replays the ticks after it from the
+	*  snapshot and compares the two runs. Run by starting the game
+	*  with --check-snapshot, after init.
+	*  @param [in] out The stream to write the results to
+	*  @return false if the replay differed or nothing shattered
+	*/
+	bool checkSnapshot(std::ostream& out);
 	
 
 private:
 	void keyHandler(const ASGE::SharedEventData data);
 	void clickHandler(const ASGE::SharedEventData data);
+	void takeInput();
+	void applyKey(const InputEvent& key);
+	void applyClick(const InputEvent& click);
 	void setupResolution();
 	bool loadBackgrounds();
+	bool loadLevelBackground();
 	bool loadGameSprites();
+	void trackActiveObjects();
 	void setupGrid();
 	void levelGen();
 	void saveLevelMap();
@@ -57,21 +106,31 @@ private:
 	bool updateHighScores();
 	void renderHighScores();
 	void renderNewHighScore();
+	void renderStats();
 
 	void newGame();
-	void setupLevel(int level);
+	void setupLevel();
 	void setupProjectiles(rect projectile_platform);
 	void setupPigs(int map);
 	rect setupPlatforms(int map);
 	void projectileCollision();
-	void projectileScatterCollision();
+	void subProjectileCollision();
+	void refreshBroadphase();
+	Entity& collisionObject(int entity);
 	void levelCollision();
 	void enemyCollision();
 	void releaseBomb(rect projectile);
-	void resetBomb();
 	void releaseProjectileScatter(rect projectile, vector2 velocity);
-	void resetProjectileScatter();
+	void clearEffects();
 	void bombCollision();
+	void explode(float x, float y, float radius, float impulse);
+	void detonateBlock(const Entity& block);
+	vector2 blastImpulse(const Explosion& blast, const rect& body) const;
+	float blockHealth(const Entity& block) const;
+	void breakBlock(Entity& block, vector2 velocity);
+	int  breakScore(const Entity& block) const;
+	void knockOut(Entity& enemy);
+	void debrisCollision();
 	void boostProjectile(); 
 	void resetProjectiles();
 	void windBreath();
@@ -82,27 +141,116 @@ private:
 
 	virtual void update(const ASGE::GameTime &) override;
 	virtual void render(const ASGE::GameTime &) override;
+	void simulate(const ASGE::GameTime& us);
+	void record();
+	void publishSnapshot();
+	int  frameRate() const;
+	void saveSimulation(Snapshot& snapshot) const;
+	bool restoreSimulation(const Snapshot& snapshot);
 
 	int  key_callback_id = -1;	        /**< Key Input Callback ID. */
 	int  mouse_callback_id = -1;        /**< Mouse Input Callback ID. */
 
-	//Add your GameObjects
-	GameObject level_layer[NUM_LEVELS];
-	GameObject menu_layer;
-	GameObject blocks[NUM_BLOCKS];
-	GameObject enemies[NUM_ENEMIES];
-	GameObject enemy_counter;
-	GameObject projectiles[NUM_PROJECTILES];
-	GameObject projectiles_scatter[NUM_PROJECTILES_SCATTER];
-	GameObject platforms[NUM_PLATFORMS];
-	GameObject bomb;
-	GameObject slingshot;
-	ASGE::Sprite* splash_screen = nullptr;
+	// level objects live in the world, the game keeps handles to them
+	World world;
+	Entity blocks[NUM_BLOCKS];
+	Entity enemies[NUM_ENEMIES];
+	Entity projectiles[NUM_PROJECTILES];
+	Entity platforms[NUM_PLATFORMS];
+	Entity slingshot;
+	Picture level_layer;
+	int background_level = -1;
+	Picture menu_layer;
+	Picture enemy_counter;
+	Picture scatter_bird;
+	Picture bomb_picture;
+	Picture splash_screen;
+	// the game is simulated in world units, this places them on screen
+	ViewTransform view;
 	rect gameplay_area;
 	rect aiming_area;
 	int game_state = SPLASH_SCREEN;
 	LevelPosIndex level_map[NUM_BLOCKS];
 
+	// per level scratch, emptied all at once when a level is set up
+	LevelArena level_arena;
+
+	// sub projectiles and the targets they are tested against
+	ProjectileSystem sub_projectiles;
+	EffectPool<EffectBody> bombs;
+	LevelVector<rect> collision_targets;
+	LevelVector<int> collision_entities;
+	LevelVector<ProjectileHit> projectile_hits;
+
+	// broadphase over the targets above, rebuilt every frame
+	SpatialGrid level_grid;
+	std::vector<int> query_results;
+	std::vector<RayHit> ray_hits;
+	ExplosionQueue explosions;
+	bool exploding = false;
+	DebrisPool debris;
+
+	// drawn from only inside the tick, so the levels and debris do not
+	// depend on which thread runs it
+	Random random;
+
+	// slots of the visible objects, kept up to date by setVisible
+	ActiveList active_blocks;
+	ActiveList active_platforms;
+	ActiveList active_enemies;
+	ActiveList active_projectiles;
+	std::vector<int> active_scratch;
+
+	// the handle of each collider by entity id, so a hit can take it
+	// out of play through its active list
+	std::vector<Entity*> collision_objects;
+
+	// each tick is recorded into the back buffers by the tick job,
+	// while the front buffers from the tick before are drawn
+	DrawBuffer draw_buffer;
+	DrawBuffer static_layer;
+	DrawBuffer front_buffer;
+	DrawBuffer front_static;
+
+	// the static layers are recorded again only when the layout they
+	// were recorded from has changed
+	int layout_version = 0;
+	int static_version = -1;
+	int front_static_version = -1;
+	ASGE::GameTime tick_time;
+	float cursor_x = 0;
+	float cursor_y = 0;
+	AsgeBackend asge_backend;
+	RenderBackend* render_backend = nullptr;
+
+	// the game as it stood before the last shot, restored by undo
+	Snapshot undo_shot;
+	bool undo_ready = false;
+
+	// input callbacks queue events, update takes them for the tick
+	std::mutex input_mutex;
+	std::vector<InputEvent> queued_inputs;
+	std::vector<InputEvent> tick_inputs;
+
+	// the draws and batches of the last frame, read by update while
+	// nothing draws, and shown with the pool counters when the
+	// overlay is toggled on
+	int shown_draw_calls = 0;
+	int shown_batches = 0;
+	bool show_stats = false;
+
+	// menus are paced and only recorded again when something changes
+	FramePacer pacer;
+	bool ticking = false;
+	bool screen_changed = true;
+	int recorded_state = -1;
+
+	// every string on screen, shaped once and reused until it changes
+	TextCache text_cache;
+
+	// regions of the packed in game textures
+	TextureAtlas game_atlas;
+
 
 	// grid coordinate arrays
 	float grid_X[GRID_SIZE];
@@ -133,4 +281,9 @@ private:
 	char new_initial = 'A';
 	std::string new_initials = "AAA";
 	int high_score_idx_to_update = 0;
+
+	// runs each tick alongside the render of the one before, declared
+	// last so it stops before any state it touches is destroyed
+	JobSystem jobs;
+	JobId tick_job;
 };
\ No newline at end of file
@@ -0,0 +1,117 @@
+#include "JobBenchmark.h"
+#include <chrono>
+#include <cmath>
+#include <ostream>
+#include <thread>
+#include <vector>
+#include "Constants.h"
+#include "JobSystem.h"
+
+namespace
+{
+	const int ROUND_TRIPS = 20000;
+	const int BATCH_SIZE = 1000;
+	const int BATCHES = 20;
+	const int CHAIN_LENGTH = 1000;
+	const int LOOP_ITEMS = 1 << 20;
+	const int LOOP_GRAIN = 4096;
+	const int LOOP_PASSES = 10;
+
+	using Clock = std::chrono::high_resolution_clock;
+
+	double nanosecondsSince(Clock::time_point start, int count)
+	{
+		std::chrono::duration<double, std::nano> elapsed = Clock::now() - start;
+		return elapsed.count() / count;
+	}
+
+	void loopBody(std::vector<float>& data, int first, int last)
+	{
+		for (int i = first; i < last; i++)
+		{
+			data[i] = std::sqrt(data[i] + 1.f) * std::sin((float)i);
+		}
+	}
+
+	/**
+	*  Times the parallel loop, in milliseconds a pass. A system that
+	*  has not been started runs the loop on the calling thread.
+	*/
+	double timeLoop(JobSystem& jobs, std::vector<float>& data)
+	{
+		Clock::time_point start = Clock::now();
+		for (int pass = 0; pass < LOOP_PASSES; pass++)
+		{
+			jobs.parallelFor(LOOP_ITEMS, LOOP_GRAIN, [&data](int first, int last)
+			{
+				loopBody(data, first, last);
+			});
+		}
+		return nanosecondsSince(start, LOOP_PASSES) / 1000000.0;
+	}
+}
+
+/**
+*   @brief   Benchmark Jobs
+*   @details Doubles the number of workers from one up to one fewer
+			 than the hardware threads. Every job is empty apart from
+			 the loop, so the times are the cost of the system itself.
+*   @return  void
+*/
+void benchmarkJobs(std::ostream& out)
+{
+	std::vector<float> data(LOOP_ITEMS, 1.f);
+	JobSystem inline_jobs;
+	double single_ms = timeLoop(inline_jobs, data);
+	out << "parallel loop on one thread: " << single_ms << " ms\n";
+
+	int max_workers = (int)std::thread::hardware_concurrency() - 1;
+	max_workers = max_workers < 1 ? 1 : max_workers;
+	for (int workers = 1; ; workers *= 2)
+	{
+		workers = workers > max_workers ? max_workers : workers;
+		JobSystem jobs;
+		jobs.start(workers);
+
+		Clock::time_point start = Clock::now();
+		for (int i = 0; i < ROUND_TRIPS; i++)
+		{
+			jobs.wait(jobs.submit([]() {}));
+		}
+		double round_trip_ns = nanosecondsSince(start, ROUND_TRIPS);
+
+		std::vector<JobId> batch(BATCH_SIZE);
+		start = Clock::now();
+		for (int n = 0; n < BATCHES; n++)
+		{
+			for (JobId& job : batch)
+			{
+				job = jobs.submit([]() {});
+			}
+			for (JobId job : batch)
+			{
+				jobs.wait(job);
+			}
+		}
+		double batch_ns = nanosecondsSince(start, BATCHES * BATCH_SIZE);
+
+		start = Clock::now();
+		JobId previous;
+		for (int i = 0; i < CHAIN_LENGTH; i++)
+		{
+			previous = jobs.submit([]() {}, { previous });
+		}
+		jobs.wait(previous);
+		double chain_ns = nanosecondsSince(start, CHAIN_LENGTH);
+
+		double loop_ms = timeLoop(jobs, data);
+		out << workers << " workers: round trip " << round_trip_ns << " ns, batched " <<
+			batch_ns << " ns, chained " << chain_ns << " ns a job, parallel loop " <<
+			loop_ms << " ms, " << single_ms / loop_ms << "x\n";
+
+		if (workers == max_workers)
+		{
+			break;
+		}
+	}
+}
@@ -0,0 +1,18 @@
+#pragma once
+#include <iosfwd>
+
+/*! \file JobBenchmark.h
+@brief   Microbenchmark of the job system.
+@details Run by starting the game with --benchmark-jobs, which writes
+		 the results to Job_benchmark.txt instead of playing. For each
+		 number of workers it times the round trip of an empty job, a
+		 batch of empty jobs, a chain of dependent jobs, and a parallel
+		 loop over a fixed amount of work against the same loop run on
+		 one thread.
+*/
+
+/**
+*  Measures the job system and writes one line per number of workers.
+*  @param [in] out The stream to write to
+*/
+void benchmarkJobs(std::ostream& out);
@@ -0,0 +1,345 @@
+#include "JobSystem.h"
+#include "Constants.h"
+
+namespace
+{
+	// the system a worker thread belongs to and the deque it owns
+	thread_local const JobSystem* worker_system = nullptr;
+	thread_local int worker_queue = -1;
+}
+
+JobSystem::~JobSystem()
+{
+	{
+		std::lock_guard<std::mutex> lock(sleep_mutex);
+		stopping = true;
+	}
+	wake.notify_all();
+	for (std::thread& worker : workers)
+	{
+		worker.join();
+	}
+}
+
+void JobSystem::start(int num_workers)
+{
+	if (!workers.empty())
+	{
+		return;
+	}
+	if (num_workers <= 0)
+	{
+		num_workers = (int)std::thread::hardware_concurrency() - 1;
+		num_workers = num_workers < 1 ? 1 : num_workers;
+	}
+
+	slots.reset(new Slot[JOB_CAPACITY]);
+	free_slots.reserve(JOB_CAPACITY);
+	for (int slot = JOB_CAPACITY - 1; slot >= 0; slot--)
+	{
+		slots[slot].continuations.reserve(JOB_CONTINUATIONS);
+		free_slots.push_back(slot);
+	}
+
+	// one deque for each worker and one for the threads outside the pool
+	worker_count = num_workers;
+	queues.reset(new Queue[worker_count + 1]);
+	workers.reserve(worker_count);
+	for (int worker = 0; worker < worker_count; worker++)
+	{
+		workers.emplace_back(&JobSystem::workerLoop, this, worker);
+	}
+}
+
+int JobSystem::workerCount() const
+{
+	return worker_count;
+}
+
+JobId JobSystem::submit(std::function<void()> work)
+{
+	return submit(std::move(work), nullptr, 0);
+}
+
+JobId JobSystem::submit(std::function<void()> work, std::initializer_list<JobId> after)
+{
+	return submit(std::move(work), after.begin(), (int)after.size());
+}
+
+/**
+*   @brief   Submit
+*   @details The job holds one count of its own while its dependencies
+			 are recorded, so it cannot be queued by a dependency that
+			 finishes part way through. A dependency that has already
+			 finished is skipped.
+*   @return  JobId
+*/
+JobId JobSystem::submit(std::function<void()> work, const JobId* after, int count)
+{
+	int slot = allocate();
+	Slot& job = slots[slot];
+	job.work = std::move(work);
+	job.pending = 1;
+	JobId id;
+	id.slot = slot;
+	id.generation = job.generation;
+
+	for (int i = 0; i < count; i++)
+	{
+		if (after[i].slot < 0)
+		{
+			continue;
+		}
+		Slot& before = slots[after[i].slot];
+		std::lock_guard<std::mutex> lock(before.mutex);
+		if (before.generation == after[i].generation)
+		{
+			before.continuations.push_back(slot);
+			job.pending++;
+		}
+	}
+
+	if (--job.pending == 0)
+	{
+		enqueue(slot);
+	}
+	return id;
+}
+
+bool JobSystem::finished(JobId job) const
+{
+	return job.slot < 0 || slots[job.slot].generation != job.generation;
+}
+
+/**
+*   @brief   Wait
+*   @details Runs whatever jobs it can find until the job is done.
+			 When there are none, a worker keeps looking, as sleeping
+			 could leave the jobs in its own deque unrun, while any
+			 other thread sleeps until a job finishes.
+*   @return  void
+*/
+void JobSystem::wait(JobId job)
+{
+	while (!finished(job))
+	{
+		if (runOne(queueOf()))
+		{
+			continue;
+		}
+		if (worker_system == this)
+		{
+			std::this_thread::yield();
+			continue;
+		}
+		std::unique_lock<std::mutex> lock(sleep_mutex);
+		waiters++;
+		done.wait(lock, [this, job]() { return finished(job); });
+		waiters--;
+	}
+}
+
+/**
+*   @brief   Parallel For
+*   @details Cuts the range into even pieces, queues all but the first
+			 and runs the first on the calling thread. A range that is
+			 one piece, or a system with no workers, runs in place.
+*   @return  void
+*/
+void JobSystem::parallelFor(int count, int grain, const std::function<void(int, int)>& body)
+{
+	if (count <= 0)
+	{
+		return;
+	}
+	grain = grain < 1 ? 1 : grain;
+	int pieces = (count + grain - 1) / grain;
+	pieces = pieces > JOB_MAX_SPLIT ? JOB_MAX_SPLIT : pieces;
+	if (pieces == 1 || worker_count == 0)
+	{
+		body(0, count);
+		return;
+	}
+
+	JobId ids[JOB_MAX_SPLIT];
+	for (int piece = 1; piece < pieces; piece++)
+	{
+		int first = (int)((long long)count * piece / pieces);
+		int last = (int)((long long)count * (piece + 1) / pieces);
+		ids[piece] = submit([&body, first, last]() { body(first, last); });
+	}
+	body(0, (int)((long long)count / pieces));
+	for (int piece = 1; piece < pieces; piece++)
+	{
+		wait(ids[piece]);
+	}
+}
+
+void JobSystem::submitMain(std::function<void()> work)
+{
+	std::lock_guard<std::mutex> lock(main_mutex);
+	main_jobs.push_back(std::move(work));
+}
+
+void JobSystem::runMainJobs()
+{
+	{
+		std::lock_guard<std::mutex> lock(main_mutex);
+		main_running.swap(main_jobs);
+	}
+	for (std::function<void()>& work : main_running)
+	{
+		work();
+	}
+	main_running.clear();
+}
+
+/**
+*   @brief   Worker Loop
+*   @details Runs jobs until the system stops, sleeping while every
+			 deque is empty.
+*   @return  void
+*/
+void JobSystem::workerLoop(int worker)
+{
+	worker_system = this;
+	worker_queue = worker;
+	while (!stopping)
+	{
+		if (runOne(worker))
+		{
+			continue;
+		}
+		std::unique_lock<std::mutex> lock(sleep_mutex);
+		sleepers++;
+		wake.wait(lock, [this]() { return queued > 0 || stopping; });
+		sleepers--;
+	}
+}
+
+int JobSystem::queueOf() const
+{
+	return worker_system == this ? worker_queue : worker_count;
+}
+
+int JobSystem::allocate()
+{
+	for (;;)
+	{
+		{
+			std::lock_guard<std::mutex> lock(free_mutex);
+			if (!free_slots.empty())
+			{
+				int slot = free_slots.back();
+				free_slots.pop_back();
+				return slot;
+			}
+		}
+		// every slot is in use, so help until one frees up
+		if (!runOne(queueOf()))
+		{
+			std::this_thread::yield();
+		}
+	}
+}
+
+/**
+*   @brief   Enqueue
+*   @details Pushes a ready job onto the calling thread's deque. The
+			 count of queued jobs is raised before sleeping workers are
+			 checked, and they raise theirs before checking the queued
+			 count, so one of the two always sees the other.
+*   @return  void
+*/
+void JobSystem::enqueue(int slot)
+{
+	Queue& queue = queues[queueOf()];
+	{
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		queue.jobs.push_back(slot);
+	}
+	queued++;
+	if (sleepers > 0)
+	{
+		{
+			std::lock_guard<std::mutex> lock(sleep_mutex);
+		}
+		wake.notify_one();
+	}
+}
+
+/**
+*   @brief   Run One
+*   @details Takes the newest job from the thread's own deque, or the
+			 oldest from the first other deque that has one, and runs
+			 it.
+*   @return  bool, false if every deque was empty
+*/
+bool JobSystem::runOne(int queue)
+{
+	int slot = -1;
+	int num_queues = worker_count + 1;
+	for (int i = 0; i < num_queues && slot < 0; i++)
+	{
+		Queue& victim = queues[(queue + i) % num_queues];
+		std::lock_guard<std::mutex> lock(victim.mutex);
+		if (victim.jobs.empty())
+		{
+			continue;
+		}
+		if (i == 0)
+		{
+			slot = victim.jobs.back();
+			victim.jobs.pop_back();
+		}
+		else
+		{
+			slot = victim.jobs.front();
+			victim.jobs.pop_front();
+		}
+	}
+	if (slot < 0)
+	{
+		return false;
+	}
+
+	queued--;
+	slots[slot].work();
+	finish(slot);
+	return true;
+}
+
+/**
+*   @brief   Finish
+*   @details Marks a job finished by moving its slot on a generation,
+			 queues the dependants it was the last wait for and frees
+			 the slot.
+*   @return  void
+*/
+void JobSystem::finish(int slot)
+{
+	Slot& job = slots[slot];
+	job.work = nullptr;
+	{
+		std::lock_guard<std::mutex> lock(job.mutex);
+		job.generation++;
+		for (int next : job.continuations)
+		{
+			if (--slots[next].pending == 0)
+			{
+				enqueue(next);
+			}
+		}
+		job.continuations.clear();
+	}
+	if (waiters > 0)
+	{
+		{
+			std::lock_guard<std::mutex> lock(sleep_mutex);
+		}
+		done.notify_all();
+	}
+
+	std::lock_guard<std::mutex> lock(free_mutex);
+	free_slots.push_back(slot);
+}
@@ -0,0 +1,164 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+*  Refers to a submitted job. A default constructed id refers to no
+*  job and counts as finished. Ids stay safe to wait on after their
+*  job has finished and its slot has been reused.
+*/
+struct JobId
+{
+	int slot = -1;
+	unsigned int generation = 0;
+};
+
+/**
+*  A pool of worker threads that run jobs.
+*  Each worker keeps its own deque of jobs. A worker takes the newest
+*  job from its own deque and, when that is empty, steals the oldest
+*  job from another's, so work spreads out without a shared queue.
+*  Jobs submitted from outside the workers go to a deque of their
+*  own that every worker steals from.
+*  A job can wait for other jobs. It is only queued once all of them
+*  have finished, so dependent jobs form a graph that never blocks a
+*  worker. A thread waiting for a job runs other jobs meanwhile.
+*  Work that must stay on the main thread, such as loading textures,
+*  is queued separately and run when the main thread asks for it.
+*  Jobs are kept in a fixed number of slots. A thread submitting
+*  when every slot is in use runs jobs until one frees up.
+*/
+class JobSystem
+{
+public:
+	/**
+	*  Default constructor. Nothing runs until the system is started.
+	*/
+	JobSystem() = default;
+
+	/**
+	*  Destructor. Stops the workers once their current jobs finish.
+	*  Jobs still queued are not run.
+	*/
+	~JobSystem();
+
+	JobSystem(const JobSystem&) = delete;
+	JobSystem& operator=(const JobSystem&) = delete;
+
+	/**
+	*  Starts the workers. Jobs can only be submitted once the system
+	*  has started.
+	*  @param [in] num_workers The number of worker threads, or 0 for
+	*  one fewer than the hardware threads, leaving one for the caller
+	*/
+	void start(int num_workers = 0);
+
+	/**
+	*  @return the number of worker threads
+	*/
+	int workerCount() const;
+
+	/**
+	*  Queues a job that can run straight away.
+	*  @param [in] work The work to run
+	*  @return the id of the job
+	*/
+	JobId submit(std::function<void()> work);
+
+	/**
+	*  Queues a job that runs once other jobs have finished.
+	*  @param [in] work The work to run
+	*  @param [in] after The jobs that must finish first
+	*  @param [in] count The number of jobs in after
+	*  @return the id of the job
+	*/
+	JobId submit(std::function<void()> work, const JobId* after, int count);
+	JobId submit(std::function<void()> work, std::initializer_list<JobId> after);
+
+	/**
+	*  @return true if the job has finished
+	*/
+	bool finished(JobId job) const;
+
+	/**
+	*  Blocks until a job has finished, running other jobs meanwhile.
+	*  A thread outside the pool sleeps once it finds none to run.
+	*  @param [in] job The job to wait for
+	*/
+	void wait(JobId job);
+
+	/**
+	*  Runs a function over a range split into jobs and waits for them.
+	*  The range is cut into pieces of at least grain items, and into no
+	*  more than JOB_MAX_SPLIT pieces.
+	*  @param [in] count The number of items
+	*  @param [in] grain The fewest items worth a job of their own
+	*  @param [in] body Called with the first and one past the last
+	*  item of each piece, on any thread
+	*/
+	void parallelFor(int count, int grain, const std::function<void(int, int)>& body);
+
+	/**
+	*  Queues work to run on the main thread.
+	*  @param [in] work The work to run
+	*/
+	void submitMain(std::function<void()> work);
+
+	/**
+	*  Runs the work queued for the main thread. Only called from the
+	*  main thread.
+	*/
+	void runMainJobs();
+
+private:
+	struct Slot
+	{
+		std::mutex mutex;
+		std::function<void()> work;
+		std::vector<int> continuations;
+		std::atomic<int> pending{ 0 };
+		std::atomic<unsigned int> generation{ 0 };
+	};
+
+	struct Queue
+	{
+		std::mutex mutex;
+		std::deque<int> jobs;
+	};
+
+	void workerLoop(int worker);
+	int  queueOf() const;
+	int  allocate();
+	void enqueue(int slot);
+	bool runOne(int queue);
+	void finish(int slot);
+
+	int worker_count = 0;
+	std::unique_ptr<Slot[]> slots;
+	std::unique_ptr<Queue[]> queues;
+	std::vector<std::thread> workers;
+	std::mutex free_mutex;
+	std::vector<int> free_slots;
+
+	// sleeping workers are only woken when there is work for them
+	std::mutex sleep_mutex;
+	std::condition_variable wake;
+	std::atomic<int> queued{ 0 };
+	std::atomic<int> sleepers{ 0 };
+	std::atomic<bool> stopping{ false };
+
+	// threads outside the pool sleep while the job they wait for runs
+	std::condition_variable done;
+	std::atomic<int> waiters{ 0 };
+
+	std::mutex main_mutex;
+	std::vector<std::function<void()>> main_jobs;
+	std::vector<std::function<void()>> main_running;
+};
@@ -0,0 +1,98 @@
+#include "LevelArena.h"
+#include "MemoryTracker.h"
+
+LevelArena::~LevelArena()
+{
+	trackRelease(MEMORY_LEVELS, block_size + overflow_bytes);
+}
+
+void LevelArena::init(size_t capacity)
+{
+	trackRelease(MEMORY_LEVELS, block_size + overflow_bytes);
+	trackAllocation(MEMORY_LEVELS, capacity);
+	block.reset(new char[capacity]);
+	block_size = capacity;
+	offset = 0;
+	overflow_bytes = 0;
+	peak_bytes = 0;
+	overflow.clear();
+	heap_allocations = 0;
+}
+
+/**
+*   @brief   Reset
+*   @details Rewinds the offset to the start of the block. If the last
+			 level overflowed, the overflow is released and the block
+			 is replaced by one big enough for the whole level, so the
+			 next level stays inside it.
+*   @return  void
+*/
+void LevelArena::reset()
+{
+	if (!overflow.empty())
+	{
+		trackRelease(MEMORY_LEVELS, block_size + overflow_bytes);
+		trackAllocation(MEMORY_LEVELS, peak_bytes);
+		overflow.clear();
+		block.reset(new char[peak_bytes]);
+		block_size = peak_bytes;
+		heap_allocations++;
+	}
+	offset = 0;
+	overflow_bytes = 0;
+}
+
+/**
+*   @brief   Allocate
+*   @details Rounds the offset up to the alignment and bumps it past
+			 the allocation. Allocations that do not fit in the block
+			 get their own piece of the heap.
+*   @return  void*
+*/
+void* LevelArena::allocate(size_t bytes, size_t alignment)
+{
+	size_t start = (offset + alignment - 1) & ~(alignment - 1);
+	if (block && start + bytes <= block_size)
+	{
+		offset = start + bytes;
+		if (offset + overflow_bytes > peak_bytes)
+		{
+			peak_bytes = offset + overflow_bytes;
+		}
+		return block.get() + start;
+	}
+
+	// new[] only promises alignment for fundamental types, pad for more
+	size_t padded = bytes + alignment;
+	overflow.emplace_back(new char[padded]);
+	trackAllocation(MEMORY_LEVELS, padded);
+	heap_allocations++;
+	overflow_bytes += padded;
+	if (block_size + overflow_bytes > peak_bytes)
+	{
+		peak_bytes = block_size + overflow_bytes;
+	}
+	size_t address = reinterpret_cast<size_t>(overflow.back().get());
+	size_t aligned = (address + alignment - 1) & ~(alignment - 1);
+	return overflow.back().get() + (aligned - address);
+}
+
+size_t LevelArena::used() const
+{
+	return offset + overflow_bytes;
+}
+
+size_t LevelArena::peak() const
+{
+	return peak_bytes;
+}
+
+size_t LevelArena::capacity() const
+{
+	return block_size;
+}
+
+int LevelArena::heapAllocations() const
+{
+	return heap_allocations;
+}
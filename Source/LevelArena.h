@@ -0,0 +1,149 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+/**
+*  Monotonic memory for the data that only lives as long as a level.
+*  The arena takes one block from the heap up front and hands out
+*  pieces of it by bumping an offset. Nothing is freed on its own,
+*  the whole arena is emptied at once when the next level starts, so
+*  a reset costs the same however much the level allocated.
+*  Should a level need more than the block, the extra comes from the
+*  heap, is counted, and the block grows to fit on the next reset.
+*  Everything the arena takes from the heap is accounted as level
+*  memory.
+*/
+class LevelArena
+{
+public:
+	/**
+	*  Default constructor. The arena is empty until initialised.
+	*/
+	LevelArena() = default;
+
+	/**
+	*  Destructor. Gives the arena's memory back to the heap.
+	*/
+	~LevelArena();
+
+	LevelArena(const LevelArena&) = delete;
+	LevelArena& operator=(const LevelArena&) = delete;
+
+	/**
+	*  Takes the arena's block from the heap.
+	*  @param [in] capacity The size of the block in bytes
+	*/
+	void init(size_t capacity);
+
+	/**
+	*  Empties the arena. Everything allocated from it is gone.
+	*/
+	void reset();
+
+	/**
+	*  Allocates memory that lives until the next reset.
+	*  @param [in] bytes The size of the allocation
+	*  @param [in] alignment The alignment, a power of two
+	*  @return the memory, never null
+	*/
+	void* allocate(size_t bytes, size_t alignment);
+
+	/**
+	*  Allocates an array that lives until the next reset.
+	*  The elements are not constructed and are never destroyed.
+	*  @param [in] count The number of elements
+	*  @return the array
+	*/
+	template <class T>
+	T* allocate(size_t count)
+	{
+		static_assert(std::is_trivially_destructible<T>::value,
+			"arena memory is released without running destructors");
+		return static_cast<T*>(allocate(sizeof(T) * count, alignof(T)));
+	}
+
+	size_t used() const;
+	size_t peak() const;
+	size_t capacity() const;
+
+	/**
+	*  The number of times the arena went to the heap since it was
+	*  initialised, besides taking its first block.
+	*/
+	int heapAllocations() const;
+
+private:
+	std::unique_ptr<char[]> block;
+	size_t block_size = 0;
+	size_t offset = 0;
+	size_t overflow_bytes = 0;
+	size_t peak_bytes = 0;
+	std::vector<std::unique_ptr<char[]>> overflow;
+	int heap_allocations = 0;
+};
+
+/**
+*  Standard allocator that takes its memory from a level arena.
+*  Freeing is left to the arena's reset, so containers using it must
+*  be rebuilt when the level starts. A default constructed allocator
+*  has no arena and uses the general heap instead.
+*/
+template <class T>
+class ArenaAllocator
+{
+public:
+	using value_type = T;
+	using propagate_on_container_copy_assignment = std::true_type;
+	using propagate_on_container_move_assignment = std::true_type;
+	using propagate_on_container_swap = std::true_type;
+
+	ArenaAllocator() = default;
+
+	explicit ArenaAllocator(LevelArena* level_arena) : arena(level_arena) {}
+
+	template <class U>
+	ArenaAllocator(const ArenaAllocator<U>& other) : arena(other.getArena()) {}
+
+	T* allocate(size_t count)
+	{
+		if (arena == nullptr)
+		{
+			return static_cast<T*>(::operator new(sizeof(T) * count));
+		}
+		return static_cast<T*>(arena->allocate(sizeof(T) * count, alignof(T)));
+	}
+
+	void deallocate(T* memory, size_t)
+	{
+		if (arena == nullptr)
+		{
+			::operator delete(memory);
+		}
+	}
+
+	LevelArena* getArena() const
+	{
+		return arena;
+	}
+
+private:
+	LevelArena* arena = nullptr;
+};
+
+template <class T, class U>
+bool operator==(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b)
+{
+	return a.getArena() == b.getArena();
+}
+
+template <class T, class U>
+bool operator!=(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b)
+{
+	return a.getArena() != b.getArena();
+}
+
+/**< A vector whose storage lives in a level arena. */
+template <class T>
+using LevelVector = std::vector<T, ArenaAllocator<T>>;
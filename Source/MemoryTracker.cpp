@@ -0,0 +1,114 @@
+#include <atomic>
+#include <ostream>
+#include "MemoryTracker.h"
+
+namespace
+{
+	struct TagCounters
+	{
+		std::atomic<size_t> current{ 0 };
+		std::atomic<size_t> peak{ 0 };
+		std::atomic<size_t> allocations{ 0 };
+	};
+
+	TagCounters counters[NUM_MEMORY_TAGS];
+
+	const char* const TAG_NAMES[NUM_MEMORY_TAGS] =
+	{
+		"textures", "sprites", "levels", "ui", "physics"
+	};
+
+	const size_t BUDGETS[NUM_MEMORY_TAGS] =
+	{
+		MEMORY_BUDGET_TEXTURES, MEMORY_BUDGET_SPRITES, MEMORY_BUDGET_LEVELS,
+		MEMORY_BUDGET_UI, MEMORY_BUDGET_PHYSICS
+	};
+
+	bool validTag(int tag)
+	{
+		return tag >= 0 && tag < NUM_MEMORY_TAGS;
+	}
+}
+
+/**
+*   @brief   Track Allocation
+*   @details Adds to the bytes held, then raises the peak if this
+			 took the tag higher than any thread has seen before.
+*   @return  void
+*/
+void trackAllocation(int tag, size_t bytes)
+{
+	if (!validTag(tag))
+	{
+		return;
+	}
+
+	TagCounters& tag_counters = counters[tag];
+	tag_counters.allocations.fetch_add(1, std::memory_order_relaxed);
+	size_t held = tag_counters.current.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+	size_t peak = tag_counters.peak.load(std::memory_order_relaxed);
+	while (held > peak &&
+		!tag_counters.peak.compare_exchange_weak(peak, held, std::memory_order_relaxed))
+	{
+	}
+}
+
+void trackRelease(int tag, size_t bytes)
+{
+	if (!validTag(tag))
+	{
+		return;
+	}
+	counters[tag].current.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+MemoryStats memoryStats(int tag)
+{
+	MemoryStats stats;
+	if (!validTag(tag))
+	{
+		return stats;
+	}
+
+	stats.current = counters[tag].current.load(std::memory_order_relaxed);
+	stats.peak = counters[tag].peak.load(std::memory_order_relaxed);
+	stats.allocations = counters[tag].allocations.load(std::memory_order_relaxed);
+	stats.budget = BUDGETS[tag];
+	return stats;
+}
+
+const char* memoryTagName(int tag)
+{
+	return validTag(tag) ? TAG_NAMES[tag] : "unknown";
+}
+
+bool memoryWithinBudget()
+{
+	for (int tag = 0; tag < NUM_MEMORY_TAGS; tag++)
+	{
+		if (memoryStats(tag).peak > BUDGETS[tag])
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+*   @brief   Write Memory Report
+*   @details Writes a header and one whitespace separated line per
+			 tag, so scripts can read the report with no parsing
+			 beyond splitting lines.
+*   @return  void
+*/
+void writeMemoryReport(std::ostream& out)
+{
+	out << "tag current peak allocations budget status\n";
+	for (int tag = 0; tag < NUM_MEMORY_TAGS; tag++)
+	{
+		MemoryStats stats = memoryStats(tag);
+		out << memoryTagName(tag) << ' ' << stats.current << ' ' << stats.peak << ' ' <<
+			stats.allocations << ' ' << stats.budget << ' ' <<
+			(stats.peak > stats.budget ? "OVER" : "ok") << '\n';
+	}
+}
@@ -0,0 +1,123 @@
+#pragma once
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+#include <vector>
+#include "Constants.h"
+
+/*! \file MemoryTracker.h
+@brief   Memory accounting per subsystem.
+@details Every allocation made through a TaggedAllocator, and every
+		 texture the backends load, is counted against one of the
+		 MEMORY_ tags. Each tag keeps the bytes currently held, the
+		 highest that has ever been held and the number of allocations,
+		 which can be read at any time and are written out as a report
+		 when the game exits. Counting is thread safe and costs a few
+		 atomic adds per allocation.
+*/
+
+/**
+*  The memory accounted to one tag.
+*/
+struct MemoryStats
+{
+	size_t current = 0;
+	size_t peak = 0;
+	size_t allocations = 0;
+	size_t budget = 0;
+};
+
+/**
+*  Counts memory taken by a subsystem.
+*  @param [in] tag The MEMORY_ tag to count against
+*  @param [in] bytes The size of the allocation
+*/
+void trackAllocation(int tag, size_t bytes);
+
+/**
+*  Counts memory given back by a subsystem.
+*  @param [in] tag The MEMORY_ tag the memory was counted against
+*  @param [in] bytes The size of the allocation
+*/
+void trackRelease(int tag, size_t bytes);
+
+/**
+*  Reads the accounting of a tag.
+*  @param [in] tag The MEMORY_ tag to read
+*  @return the bytes held, the peak, the allocations and the budget
+*/
+MemoryStats memoryStats(int tag);
+
+/**
+*  @return the name a tag is reported under
+*/
+const char* memoryTagName(int tag);
+
+/**
+*  @return true if no tag has ever held more than its budget
+*/
+bool memoryWithinBudget();
+
+/**
+*  Writes one line per tag with its current and peak bytes, its
+*  allocations and its budget. Tags whose peak went over budget are
+*  marked, so a build can fail on them.
+*  @param [in] out The stream to write to
+*/
+void writeMemoryReport(std::ostream& out);
+
+/**
+*  Standard allocator that counts its memory against a tag.
+*  The memory itself comes from the general heap. The tag is part of
+*  the type, so containers keep it without storing anything.
+*/
+template <class T, int Tag>
+class TaggedAllocator
+{
+public:
+	using value_type = T;
+
+	template <class U>
+	struct rebind
+	{
+		using other = TaggedAllocator<U, Tag>;
+	};
+
+	TaggedAllocator() = default;
+
+	template <class U>
+	TaggedAllocator(const TaggedAllocator<U, Tag>&) {}
+
+	T* allocate(size_t count)
+	{
+		T* memory = static_cast<T*>(::operator new(sizeof(T) * count));
+		trackAllocation(Tag, sizeof(T) * count);
+		return memory;
+	}
+
+	void deallocate(T* memory, size_t count)
+	{
+		trackRelease(Tag, sizeof(T) * count);
+		::operator delete(memory);
+	}
+};
+
+template <class T, class U, int Tag>
+bool operator==(const TaggedAllocator<T, Tag>&, const TaggedAllocator<U, Tag>&)
+{
+	return true;
+}
+
+template <class T, class U, int Tag>
+bool operator!=(const TaggedAllocator<T, Tag>&, const TaggedAllocator<U, Tag>&)
+{
+	return false;
+}
+
+/**< A vector whose storage is counted against a tag. */
+template <class T, int Tag>
+using TaggedVector = std::vector<T, TaggedAllocator<T, Tag>>;
+
+/**< A string whose storage is counted against a tag. */
+template <int Tag>
+using TaggedString = std::basic_string<char, std::char_traits<char>, TaggedAllocator<char, Tag>>;
@@ -0,0 +1,171 @@
+#include "PhysicsCheck.h"
+#include <chrono>
+#include <ostream>
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+#include "Constants.h"
+#include "ProjectileSystem.h"
+#include "Trajectory.h"
+#include "World.h"
+
+namespace
+{
+	const int REPLAY_BODIES = 64;
+	const int REPLAY_BIRDS = 32;
+	const int REPLAY_TICKS = 240;
+	const float REPLAY_STEP = 1.f / 60.f;
+	const int STEP_BODIES = 4096;
+	const int STEP_PASSES = 200;
+
+	// taken from DETERMINISTIC_PHYSICS builds with GCC at -O0 and at
+	// -O3 with FMA and fast math, which all agreed
+	const uint64_t REFERENCE_HASH = 0xc81b5fa1ff90d972ull;
+
+	using Clock = std::chrono::high_resolution_clock;
+
+	double nanosecondsSince(Clock::time_point start, int count)
+	{
+		std::chrono::duration<double, std::nano> elapsed = Clock::now() - start;
+		return elapsed.count() / count;
+	}
+
+	void mix(uint64_t& hash, float value)
+	{
+		uint32_t bits;
+		memcpy(&bits, &value, sizeof(bits));
+		for (int i = 0; i < 4; i++)
+		{
+			hash ^= (bits >> (i * 8)) & 0xff;
+			hash *= 1099511628211ull;
+		}
+	}
+
+	/**
+	*  Launches the scripted pigs and birds and steps them the way a
+	*  game tick does, hashing the state after every tick. Every start
+	*  value is exact in both float and 16.16.
+	*/
+	uint64_t replay(double& ms_per_tick)
+	{
+		World world;
+		for (int i = 0; i < REPLAY_BODIES; i++)
+		{
+			int entity = world.create();
+			Transform& transform = world.transforms.get(entity);
+			transform.x = i * 8.f;
+			transform.y = 100.f + (i % 7) * 4.5f;
+			Velocity& velocity = world.velocities.add(entity);
+			velocity.x = ((i % 11) - 5) * 0.25f;
+			velocity.y = -(float)(i % 13) * 0.5f;
+			velocity.speed_scale = ENEMY_FALL_SCALE;
+			velocity.gravity = ENEMY_GRAVITY;
+		}
+
+		ProjectileSystem birds;
+		birds.reserve(REPLAY_BIRDS);
+		for (int i = 0; i < REPLAY_BIRDS; i++)
+		{
+			birds.spawn(50.f, 500.f + i * 2.f, 32.f, 32.f,
+				vector2(40.f + i * 2.5f, -60.f + i * 1.25f));
+		}
+
+		uint64_t hash = 14695981039346656037ull;
+		Clock::time_point start = Clock::now();
+		for (int tick = 0; tick < REPLAY_TICKS; tick++)
+		{
+			world.integrate(REPLAY_STEP);
+			birds.integrate(REPLAY_STEP);
+
+			const ComponentPool<Transform>& transforms = world.transforms;
+			const ComponentPool<Velocity>& velocities = world.velocities;
+			for (int i = 0; i < transforms.size(); i++)
+			{
+				mix(hash, transforms[i].x);
+				mix(hash, transforms[i].y);
+			}
+			for (int i = 0; i < velocities.size(); i++)
+			{
+				mix(hash, velocities[i].x);
+				mix(hash, velocities[i].y);
+			}
+			for (int i = 0; i < birds.size(); i++)
+			{
+				rect box = birds.getBoundingBox(i);
+				vector2 velocity = birds.getVelocity(i);
+				mix(hash, box.x);
+				mix(hash, box.y);
+				mix(hash, velocity.getX());
+				mix(hash, velocity.getY());
+			}
+		}
+		ms_per_tick = nanosecondsSince(start, REPLAY_TICKS) / 1000000.0;
+		return hash;
+	}
+
+	/**
+	*  Times one flight step of a body in nanoseconds, in fixed point
+	*  or with the float coefficients the default build uses.
+	*/
+	double timeStep(bool fixed, std::vector<float>& state)
+	{
+		FixedFlightStep fixed_step(REPLAY_STEP);
+		vector2 a, b, c, e;
+		Trajectory::stepCoefficients(REPLAY_STEP, a, b, c, e);
+
+		Clock::time_point start = Clock::now();
+		for (int pass = 0; pass < STEP_PASSES; pass++)
+		{
+			for (int i = 0; i < STEP_BODIES * 4; i += 4)
+			{
+				if (fixed)
+				{
+					fixed_step.apply(state[i], state[i + 1], state[i + 2], state[i + 3]);
+					continue;
+				}
+				state[i] += a.getX() * state[i + 2] + b.getX();
+				state[i + 1] += a.getY() * state[i + 3] + b.getY();
+				state[i + 2] = e.getX() * state[i + 2] + c.getX();
+				state[i + 3] = e.getY() * state[i + 3] + c.getY();
+			}
+		}
+		return nanosecondsSince(start, STEP_PASSES * STEP_BODIES);
+	}
+}
+
+/**
+*   @brief   Check Physics
+*   @details Plays the replay twice and compares the hashes, then the
+			 reference hash when the fixed point mode is built in. The
+			 float build has no reference, as its results depend on the
+			 compiler. Collision is not part of the replay, since its
+			 response is still worked out in float.
+*   @return  bool
+*/
+bool checkPhysics(std::ostream& out)
+{
+	double first_ms = 0.0;
+	double second_ms = 0.0;
+	uint64_t first = replay(first_ms);
+	uint64_t second = replay(second_ms);
+	bool passed = first == second;
+	out << std::hex << "replay hash " << first << ", replayed " << second << std::dec <<
+		(passed ? " (same)\n" : " (DIFFERENT)\n");
+
+#ifdef DETERMINISTIC_PHYSICS
+	bool matches = first == REFERENCE_HASH;
+	out << std::hex << "reference hash " << REFERENCE_HASH << std::dec <<
+		(matches ? " (same)\n" : " (DIFFERENT)\n");
+	passed = passed && matches;
+#else
+	out << "float build, define DETERMINISTIC_PHYSICS to compare against the reference\n";
+#endif
+	out << "replay tick " << first_ms << " ms\n";
+
+	std::vector<float> state(STEP_BODIES * 4, 1.f);
+	double float_ns = timeStep(false, state);
+	double fixed_ns = timeStep(true, state);
+	out << "flight step: float " << float_ns << " ns, fixed " << fixed_ns <<
+		" ns a body, " << fixed_ns / float_ns << "x\n";
+	return passed;
+}
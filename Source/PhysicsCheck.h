@@ -0,0 +1,22 @@
+#pragma once
+#include <iosfwd>
+
+/*! \file PhysicsCheck.h
+@brief   Determinism check and throughput comparison of the physics.
+@details Run by starting the game with --check-physics, which writes
+		 the results to Physics_check.txt instead of playing. A scripted
+		 set of bodies and birds is stepped with the same systems the
+		 game uses, and the state is hashed after every tick. The replay
+		 is played twice and must hash the same both times. When
+		 DETERMINISTIC_PHYSICS is defined the hash must also match a
+		 reference taken on another compiler, so a build whose results
+		 drift is caught. The fixed and float flight steps are then timed
+		 against each other.
+*/
+
+/**
+*  Replays the physics, compares the hashes and times the steps.
+*  @param [in] out The stream to write the results to
+*  @return false if the replay was not reproducible
+*/
+bool checkPhysics(std::ostream& out);
@@ -0,0 +1,57 @@
+#include "Picture.h"
+#include "AsgeBackend.h"
+#include "TextureAtlas.h"
+
+bool Picture::load(AsgeBackend& backend, const std::string& texture_file_name)
+{
+	sprite.texture = backend.addTexture(texture_file_name);
+	if (sprite.texture < 0)
+	{
+		return false;
+	}
+
+	float width = 0;
+	float height = 0;
+	backend.getTextureSize(sprite.texture, width, height);
+	sprite.source[0] = 0;
+	sprite.source[1] = 0;
+	sprite.source[2] = width;
+	sprite.source[3] = height;
+	transform.width = width;
+	transform.height = height;
+	return true;
+}
+
+bool Picture::load(AsgeBackend& backend, const TextureAtlas& atlas,
+	const std::string& region_name)
+{
+	const AtlasRegion* region = atlas.find(region_name);
+	if (!region)
+	{
+		return false;
+	}
+
+	sprite.texture = backend.addTexture(region->texture);
+	if (sprite.texture < 0)
+	{
+		return false;
+	}
+
+	sprite.source[0] = region->x;
+	sprite.source[1] = region->y;
+	sprite.source[2] = region->width;
+	sprite.source[3] = region->height;
+	transform.width = region->width;
+	transform.height = region->height;
+	return true;
+}
+
+rect Picture::getBoundingBox() const
+{
+	rect bounding_box;
+	bounding_box.x = transform.x;
+	bounding_box.y = transform.y;
+	bounding_box.length = transform.width;
+	bounding_box.height = transform.height;
+	return bounding_box;
+}
@@ -0,0 +1,38 @@
+#pragma once
+#include <string>
+#include "Components.h"
+#include "Rect.h"
+
+class AsgeBackend;
+class TextureAtlas;
+
+/**
+*  A sprite drawn by a screen itself rather than by the world.
+*  Used for backgrounds, the ui and sprites that systems stamp many
+*  times, which are not entities in the simulation.
+*/
+struct Picture
+{
+	/**
+	*  Loads a whole texture. The picture takes the texture's size.
+	*  @param [in] backend The backend the texture is registered with
+	*  @param [in] texture_file_name The file path of the texture
+	*  @return true if the texture was loaded
+	*/
+	bool load(AsgeBackend& backend, const std::string& texture_file_name);
+
+	/**
+	*  Loads a region of an atlas. The picture takes the region's size.
+	*  @param [in] backend The backend the atlas texture is registered with
+	*  @param [in] atlas The atlas holding the region
+	*  @param [in] region_name The name of the region to draw
+	*  @return true if the region exists and its texture was loaded
+	*/
+	bool load(AsgeBackend& backend, const TextureAtlas& atlas,
+		const std::string& region_name);
+
+	rect getBoundingBox() const;
+
+	Transform transform;
+	Sprite sprite;
+};
@@ -0,0 +1,15 @@
+#pragma once
+
+/**
+*  What has happened in a pool of short lived effects since it was
+*  initialised.
+*  @see EffectPool, ProjectileSystem
+*/
+struct PoolStats
+{
+	int live = 0;
+	int peak = 0;
+	int acquired = 0;
+	int rejected = 0;
+	int recycled = 0;
+};
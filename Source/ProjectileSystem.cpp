@@ -0,0 +1,334 @@
+#include "ProjectileSystem.h"
+#include "DrawBuffer.h"
+#include "Snapshot.h"
+#include "Components.h"
+#include "Trajectory.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define PROJECTILE_SIMD
+#include <emmintrin.h>
+#endif
+
+/**
+*   @brief   Reserve
+*   @details Grows the arrays up front. Storage is always a multiple
+			 of four so the SIMD loops never need a scalar tail.
+*   @return  void
+*/
+void ProjectileSystem::reserve(int capacity)
+{
+	if (capacity > (int)pos_x.size())
+	{
+		resize(capacity);
+	}
+}
+
+void ProjectileSystem::resize(int capacity)
+{
+	capacity = (capacity + 3) & ~3;
+	pos_x.resize(capacity, 0.f);
+	pos_y.resize(capacity, 0.f);
+	vel_x.resize(capacity, 0.f);
+	vel_y.resize(capacity, 0.f);
+	width.resize(capacity, 0.f);
+	height.resize(capacity, 0.f);
+	rotation.resize(capacity, 0.f);
+}
+
+/**
+*   @brief   Spawn
+*   @details Appends a projectile to the end of the live range, or
+			 counts the refusal when the storage is full.
+*   @return  int
+*/
+int ProjectileSystem::spawn(float x, float y, float w, float h, vector2 velocity)
+{
+	if (count == (int)pos_x.size())
+	{
+		stats.rejected++;
+		return -1;
+	}
+
+	pos_x[count] = x;
+	pos_y[count] = y;
+	vel_x[count] = velocity.getX();
+	vel_y[count] = velocity.getY();
+	width[count] = w;
+	height[count] = h;
+	rotation[count] = 0.f;
+	stats.acquired++;
+	stats.live = count + 1;
+	stats.peak = stats.live > stats.peak ? stats.live : stats.peak;
+	return count++;
+}
+
+/**
+*   @brief   Kill
+*   @details Swap removes the projectile to keep the live range dense.
+*   @return  void
+*/
+void ProjectileSystem::kill(int idx)
+{
+	int last = --count;
+	pos_x[idx] = pos_x[last];
+	pos_y[idx] = pos_y[last];
+	vel_x[idx] = vel_x[last];
+	vel_y[idx] = vel_y[last];
+	width[idx] = width[last];
+	height[idx] = height[last];
+	rotation[idx] = rotation[last];
+	stats.live = count;
+}
+
+void ProjectileSystem::save(Snapshot& snapshot) const
+{
+	snapshot.write(count);
+	snapshot.writeArray(pos_x.data(), count);
+	snapshot.writeArray(pos_y.data(), count);
+	snapshot.writeArray(vel_x.data(), count);
+	snapshot.writeArray(vel_y.data(), count);
+	snapshot.writeArray(width.data(), count);
+	snapshot.writeArray(height.data(), count);
+	snapshot.writeArray(rotation.data(), count);
+	snapshot.write(stats);
+}
+
+/**
+*   @brief   Restore
+*   @details Reads the live count first, so the arrays can be sized
+			 before the projectiles are copied into them.
+*   @return  void
+*/
+void ProjectileSystem::restore(SnapshotReader& reader)
+{
+	int saved = 0;
+	reader.read(saved);
+	if (!reader.good() || saved < 0)
+	{
+		return;
+	}
+
+	reserve(saved);
+	count = saved;
+	reader.readArray(pos_x.data(), count);
+	reader.readArray(pos_y.data(), count);
+	reader.readArray(vel_x.data(), count);
+	reader.readArray(vel_y.data(), count);
+	reader.readArray(width.data(), count);
+	reader.readArray(height.data(), count);
+	reader.readArray(rotation.data(), count);
+	reader.read(stats);
+}
+
+void ProjectileSystem::clear()
+{
+	count = 0;
+	stats.live = 0;
+}
+
+int ProjectileSystem::size() const
+{
+	return count;
+}
+
+const PoolStats& ProjectileSystem::getStats() const
+{
+	return stats;
+}
+
+/**
+*   @brief   Integrate
+*   @details For a fixed step the exact flight model is affine:
+			 p' = p + a * v + b and v' = e * v + c on each axis. The
+			 coefficients are taken from Trajectory by superposition,
+			 so the batch follows exactly the same model as the bird.
+*   @return  void
+*/
+void ProjectileSystem::integrate(float dt)
+{
+#ifdef DETERMINISTIC_PHYSICS
+	FixedFlightStep step(dt);
+	for (int i = 0; i < count; i++)
+	{
+		step.apply(pos_x[i], pos_y[i], vel_x[i], vel_y[i]);
+		rotation[i] += dt;
+	}
+#else
+	vector2 a, b, c, e;
+	Trajectory::stepCoefficients(dt, a, b, c, e);
+
+	int i = 0;
+#ifdef PROJECTILE_SIMD
+	const __m128 ax = _mm_set1_ps(a.getX());
+	const __m128 ay = _mm_set1_ps(a.getY());
+	const __m128 bx = _mm_set1_ps(b.getX());
+	const __m128 by = _mm_set1_ps(b.getY());
+	const __m128 cx = _mm_set1_ps(c.getX());
+	const __m128 cy = _mm_set1_ps(c.getY());
+	const __m128 ex = _mm_set1_ps(e.getX());
+	const __m128 ey = _mm_set1_ps(e.getY());
+	const __m128 spin = _mm_set1_ps(dt);
+	for (; i < count; i += 4)
+	{
+		__m128 vx = _mm_loadu_ps(&vel_x[i]);
+		__m128 vy = _mm_loadu_ps(&vel_y[i]);
+		__m128 px = _mm_add_ps(_mm_loadu_ps(&pos_x[i]), _mm_add_ps(_mm_mul_ps(ax, vx), bx));
+		__m128 py = _mm_add_ps(_mm_loadu_ps(&pos_y[i]), _mm_add_ps(_mm_mul_ps(ay, vy), by));
+		_mm_storeu_ps(&pos_x[i], px);
+		_mm_storeu_ps(&pos_y[i], py);
+		_mm_storeu_ps(&vel_x[i], _mm_add_ps(_mm_mul_ps(ex, vx), cx));
+		_mm_storeu_ps(&vel_y[i], _mm_add_ps(_mm_mul_ps(ey, vy), cy));
+		_mm_storeu_ps(&rotation[i], _mm_add_ps(_mm_loadu_ps(&rotation[i]), spin));
+	}
+#else
+	for (; i < count; i++)
+	{
+		pos_x[i] += a.getX() * vel_x[i] + b.getX();
+		pos_y[i] += a.getY() * vel_y[i] + b.getY();
+		vel_x[i] = e.getX() * vel_x[i] + c.getX();
+		vel_y[i] = e.getY() * vel_y[i] + c.getY();
+		rotation[i] += dt;
+	}
+#endif
+#endif
+}
+
+/**
+*   @brief   Collide
+*   @details Uses the same inclusive overlap test as rect::isInside.
+			 Each target is tested against four projectiles at a time.
+*   @return  void
+*/
+void ProjectileSystem::collide(const rect* targets, int num_targets,
+	LevelVector<ProjectileHit>& hits) const
+{
+	for (int t = 0; t < num_targets; t++)
+	{
+		const rect& target = targets[t];
+		int i = 0;
+#ifdef PROJECTILE_SIMD
+		const __m128 min_x = _mm_set1_ps(target.x);
+		const __m128 min_y = _mm_set1_ps(target.y);
+		const __m128 max_x = _mm_set1_ps(target.x + target.length);
+		const __m128 max_y = _mm_set1_ps(target.y + target.height);
+		for (; i < count; i += 4)
+		{
+			__m128 px = _mm_loadu_ps(&pos_x[i]);
+			__m128 py = _mm_loadu_ps(&pos_y[i]);
+			__m128 far_x = _mm_add_ps(px, _mm_loadu_ps(&width[i]));
+			__m128 far_y = _mm_add_ps(py, _mm_loadu_ps(&height[i]));
+			__m128 overlap = _mm_and_ps(
+				_mm_and_ps(_mm_cmpge_ps(far_x, min_x), _mm_cmple_ps(px, max_x)),
+				_mm_and_ps(_mm_cmpge_ps(far_y, min_y), _mm_cmple_ps(py, max_y)));
+			int mask = _mm_movemask_ps(overlap);
+			for (int lane = 0; mask != 0; lane++, mask >>= 1)
+			{
+				if ((mask & 1) && i + lane < count)
+				{
+					ProjectileHit hit;
+					hit.projectile = i + lane;
+					hit.target = t;
+					hits.push_back(hit);
+				}
+			}
+		}
+#else
+		for (; i < count; i++)
+		{
+			if (getBoundingBox(i).isInside(target))
+			{
+				ProjectileHit hit;
+				hit.projectile = i;
+				hit.target = t;
+				hits.push_back(hit);
+			}
+		}
+#endif
+	}
+}
+
+/**
+*   @brief   Bounce
+*   @details Resolves the overlap with the smallest push and reflects
+			 the velocity along that axis, scaled by the restitution.
+*   @return  void
+*/
+void ProjectileSystem::bounce(int idx, const rect& solid, float restitution)
+{
+	float push_left = (pos_x[idx] + width[idx]) - solid.x;
+	float push_right = (solid.x + solid.length) - pos_x[idx];
+	float push_up = (pos_y[idx] + height[idx]) - solid.y;
+	float push_down = (solid.y + solid.height) - pos_y[idx];
+	float push_x = push_left < push_right ? -push_left : push_right;
+	float push_y = push_up < push_down ? -push_up : push_down;
+
+	if ((push_x < 0.f ? -push_x : push_x) < (push_y < 0.f ? -push_y : push_y))
+	{
+		pos_x[idx] += push_x;
+		vel_x[idx] = -vel_x[idx] * restitution;
+	}
+	else
+	{
+		pos_y[idx] += push_y;
+		vel_y[idx] = -vel_y[idx] * restitution;
+	}
+}
+
+/**
+*   @brief   Cull
+*   @details Removes projectiles that have left the area. Iterates
+			 backwards so swap removal does not skip any entries.
+*   @return  void
+*/
+void ProjectileSystem::cull(const rect& area)
+{
+	for (int i = count - 1; i >= 0; i--)
+	{
+		if (pos_x[i] < area.x || pos_y[i] < area.y ||
+			pos_x[i] + width[i] > area.x + area.length ||
+			pos_y[i] + height[i] > area.y + area.height)
+		{
+			kill(i);
+		}
+	}
+}
+
+/**
+*   @brief   Render
+*   @details Stamps the shared sprite at every live projectile.
+*   @return  void
+*/
+void ProjectileSystem::render(DrawBuffer& buffer, const Sprite& sprite, int layer) const
+{
+	Transform transform;
+	for (int i = 0; i < count; i++)
+	{
+		transform.x = pos_x[i];
+		transform.y = pos_y[i];
+		transform.width = width[i];
+		transform.height = height[i];
+		transform.rotation = rotation[i];
+		buffer.sprite(transform, sprite, layer);
+	}
+}
+
+rect ProjectileSystem::getBoundingBox(int idx) const
+{
+	rect bounding_box;
+	bounding_box.x = pos_x[idx];
+	bounding_box.y = pos_y[idx];
+	bounding_box.length = width[idx];
+	bounding_box.height = height[idx];
+	return bounding_box;
+}
+
+vector2 ProjectileSystem::getVelocity(int idx) const
+{
+	return vector2(vel_x[idx], vel_y[idx]);
+}
+
+void ProjectileSystem::setVelocity(int idx, float x, float y)
+{
+	vel_x[idx] = x;
+	vel_y[idx] = y;
+}
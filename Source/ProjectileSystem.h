@@ -0,0 +1,144 @@
+#pragma once
+#include "LevelArena.h"
+#include "MemoryTracker.h"
+#include "PoolStats.h"
+#include "Rect.h"
+#include "Vector2.h"
+
+class DrawBuffer;
+class Snapshot;
+class SnapshotReader;
+struct Sprite;
+
+/**
+*  A hit reported by the batched collision pass.
+*  Holds the index of the projectile and the index of the target
+*  in the array that was passed to ProjectileSystem::collide.
+*/
+struct ProjectileHit
+{
+	int projectile = 0;
+	int target = 0;
+};
+
+/**
+*  Stores every in-flight sub projectile in structure of arrays form.
+*  Scatter shots, shrapnel and similar effects are spawned into this
+*  system rather than into individual entities. Live projectiles are
+*  kept densely packed so that integration and collision run over
+*  contiguous arrays, four lanes at a time where SSE2 is available.
+*  All projectiles share one sprite which is stamped when rendering.
+*  @see Trajectory
+*/
+class ProjectileSystem
+{
+public:
+	/**
+	*  Default constructor.
+	*/
+	ProjectileSystem() = default;
+
+	/**
+	*  Pre-allocates storage so spawning does not allocate mid-flight.
+	*  @param [in] capacity The number of projectiles to reserve
+	*/
+	void reserve(int capacity);
+
+	/**
+	*  Adds a projectile to the system. The system never grows while
+	*  spawning, so once the reserved storage is full the projectile
+	*  is refused and counted, as in an EffectPool with POOL_REJECT.
+	*  The projectiles stay in their own arrays rather than an
+	*  EffectPool, so integration and collision keep running over
+	*  contiguous lanes.
+	*  @return the index of the new projectile, or -1 if it was refused
+	*/
+	int  spawn(float x, float y, float width, float height, vector2 velocity);
+
+	/**
+	*  Removes a projectile. The last projectile is moved into its slot,
+	*  so indices above the removed one are not stable.
+	*  @param [in] idx The projectile to remove
+	*/
+	void kill(int idx);
+
+	/**
+	*  Appends the live projectiles and the counters to a snapshot.
+	*  @param [in] snapshot The snapshot to write to
+	*/
+	void save(Snapshot& snapshot) const;
+
+	/**
+	*  Replaces the projectiles with the next ones in a snapshot,
+	*  growing the storage only if the snapshot holds more than it.
+	*  @param [in] reader The snapshot being read
+	*/
+	void restore(SnapshotReader& reader);
+
+	void clear();
+	int  size() const;
+
+	/**
+	*  Counts spawns the way an EffectPool counts acquires. Projectiles
+	*  refused because the system was full are counted as rejected.
+	*  @return the counters since the system was created
+	*/
+	const PoolStats& getStats() const;
+
+	/**
+	*  Moves every projectile along its exact flight path by dt seconds.
+	*  The flight model is affine in the state for a fixed step, so the
+	*  coefficients are solved once and applied to all lanes.
+	*  @param [in] dt The time step in seconds
+	*/
+	void integrate(float dt);
+
+	/**
+	*  Tests every projectile against every target in a single pass.
+	*  @param [in] targets The rectangles to test against
+	*  @param [in] num_targets The number of rectangles
+	*  @param [out] hits The overlapping pairs, appended in target order
+	*/
+	void collide(const rect* targets, int num_targets,
+		LevelVector<ProjectileHit>& hits) const;
+
+	/**
+	*  Pushes a projectile out of a solid rectangle along the shallowest
+	*  axis and reflects its velocity on that axis.
+	*  @param [in] idx The projectile to resolve
+	*  @param [in] solid The rectangle it is overlapping
+	*  @param [in] restitution The energy kept after the bounce
+	*/
+	void bounce(int idx, const rect& solid, float restitution);
+
+	/**
+	*  Removes every projectile that has left the area.
+	*  @param [in] area The area projectiles must stay inside
+	*/
+	void cull(const rect& area);
+
+	/**
+	*  Records every projectile as a stamp of a shared sprite.
+	*  @param [in] buffer The buffer to record into
+	*  @param [in] sprite The sprite used for every projectile
+	*  @param [in] layer The layer to draw the projectiles on
+	*/
+	void render(DrawBuffer& buffer, const Sprite& sprite, int layer) const;
+
+	rect    getBoundingBox(int idx) const;
+	vector2 getVelocity(int idx) const;
+	void    setVelocity(int idx, float x, float y);
+
+private:
+	void resize(int capacity);
+
+	TaggedVector<float, MEMORY_PHYSICS> pos_x;
+	TaggedVector<float, MEMORY_PHYSICS> pos_y;
+	TaggedVector<float, MEMORY_PHYSICS> vel_x;
+	TaggedVector<float, MEMORY_PHYSICS> vel_y;
+	TaggedVector<float, MEMORY_PHYSICS> width;
+	TaggedVector<float, MEMORY_PHYSICS> height;
+	TaggedVector<float, MEMORY_PHYSICS> rotation;
+	int count = 0;
+	PoolStats stats;
+};
@@ -0,0 +1,36 @@
+#include "Random.h"
+
+/**
+*   @brief   Constructor
+*   @details Mixes the seed with the murmur3 finalizer first. Seeds
+			 that differ only in their low bits, like the clock a
+			 second apart, would otherwise start with the same draws.
+*/
+Random::Random(uint32_t seed)
+{
+	seed ^= seed >> 16;
+	seed *= 0x85ebca6bu;
+	seed ^= seed >> 13;
+	seed *= 0xc2b2ae35u;
+	seed ^= seed >> 16;
+	state = seed != 0 ? seed : state;
+}
+
+/**
+*   @brief   Next
+*   @details Marsaglia's 13, 17, 5 xorshift, which walks every value
+			 except zero before repeating.
+*   @return  uint32_t
+*/
+uint32_t Random::next()
+{
+	state ^= state << 13;
+	state ^= state >> 17;
+	state ^= state << 5;
+	return state;
+}
+
+int Random::below(int bound)
+{
+	return (int)(next() % (uint32_t)bound);
+}
@@ -0,0 +1,38 @@
+#pragma once
+#include <stdint.h>
+
+/**
+*  A 32-bit xorshift generator owned by the code that draws from it.
+*  The CRT keeps the state of rand for each thread, so a sequence drawn
+*  on whichever worker runs the tick starts from the default seed. This
+*  one keeps its state in the object, so the sequence only depends on
+*  the seed and the order of the draws, and it can be snapshotted.
+*/
+class Random
+{
+public:
+	/**
+	*  Default constructor. Starts from a fixed seed.
+	*/
+	Random() = default;
+
+	/**
+	*  Constructor.
+	*  @param [in] seed The seed, mixed so that close seeds diverge
+	*/
+	explicit Random(uint32_t seed);
+
+	/**
+	*  @return the next number of the sequence, never zero
+	*/
+	uint32_t next();
+
+	/**
+	*  @param [in] bound The number of values to pick from
+	*  @return a number from 0 up to, but not including, bound
+	*/
+	int  below(int bound);
+
+private:
+	uint32_t state = 2463534242u;
+};
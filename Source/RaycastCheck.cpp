@@ -0,0 +1,290 @@
+#include "RaycastCheck.h"
+#include <algorithm>
+#include <chrono>
+#include <math.h>
+#include <ostream>
+#include <vector>
+#include "Random.h"
+#include "SpatialGrid.h"
+
+namespace
+{
+	const float AREA_WIDTH = 1920.f;
+	const float AREA_HEIGHT = 1080.f;
+	const float CELL_SIZE = 64.f;
+	const int NUM_BOXES = 400;
+	const int NUM_CASTS = 4000;
+	const int TIMED_PASSES = 20;
+	const float TOLERANCE = 1e-3f;
+
+	using Clock = std::chrono::high_resolution_clock;
+
+	/**
+	*  A cast to check. Rays use the direction and distance, segments
+	*  the end point.
+	*/
+	struct Cast
+	{
+		float x = 0.f;
+		float y = 0.f;
+		float dir_x = 0.f;
+		float dir_y = 0.f;
+		float max_distance = 0.f;
+		bool segment = false;
+		bool filtered = false;
+	};
+
+	float between(Random& random, float lo, float hi)
+	{
+		return lo + (hi - lo) * (random.below(1 << 16) / 65536.f);
+	}
+
+	/**
+	*  Slab tests one box on its own. Written out apart from the grid,
+	*  so the two only agree if the grid's walk visits the right boxes.
+	*  Where the ray crosses both slabs at once, at a corner, the x
+	*  face is the one reported.
+	*/
+	bool slab(const rect& box, const Cast& cast, RayHit& hit)
+	{
+		float origin[2] = { cast.x, cast.y };
+		float dir[2] = { cast.dir_x, cast.dir_y };
+		float lo[2] = { box.x, box.y };
+		float hi[2] = { box.x + box.length, box.y + box.height };
+		float t_near = 0.f;
+		float t_far = cast.max_distance;
+		int entry_axis = -1;
+		for (int axis = 0; axis < 2; axis++)
+		{
+			if (dir[axis] == 0.f)
+			{
+				if (origin[axis] < lo[axis] || origin[axis] > hi[axis])
+				{
+					return false;
+				}
+				continue;
+			}
+			float t0 = (lo[axis] - origin[axis]) / dir[axis];
+			float t1 = (hi[axis] - origin[axis]) / dir[axis];
+			float enter = t0 < t1 ? t0 : t1;
+			float leave = t0 < t1 ? t1 : t0;
+			if (enter > t_near)
+			{
+				t_near = enter;
+				entry_axis = axis;
+			}
+			t_far = leave < t_far ? leave : t_far;
+		}
+		if (t_near > t_far)
+		{
+			return false;
+		}
+		hit.distance = t_near;
+		hit.normal_x = entry_axis == 0 ? (cast.dir_x > 0.f ? -1.f : 1.f) : 0.f;
+		hit.normal_y = entry_axis == 1 ? (cast.dir_y > 0.f ? -1.f : 1.f) : 0.f;
+		return true;
+	}
+
+	bool accepted(const Cast& cast, int id)
+	{
+		return !cast.filtered || id % 3 != 0;
+	}
+
+	/**
+	*  Every hit of a cast found by testing every box, nearest first.
+	*/
+	void bruteForce(const std::vector<rect>& boxes, Cast cast, std::vector<RayHit>& hits)
+	{
+		hits.clear();
+		float length = sqrtf(cast.dir_x * cast.dir_x + cast.dir_y * cast.dir_y);
+		cast.dir_x /= length;
+		cast.dir_y /= length;
+		for (int id = 0; id < (int)boxes.size(); id++)
+		{
+			RayHit hit;
+			if (accepted(cast, id) && slab(boxes[id], cast, hit))
+			{
+				hit.id = id;
+				hits.push_back(hit);
+			}
+		}
+		std::sort(hits.begin(), hits.end(), [](const RayHit& lhs, const RayHit& rhs)
+		{
+			return lhs.distance != rhs.distance ? lhs.distance < rhs.distance : lhs.id < rhs.id;
+		});
+	}
+
+	bool sameHit(const RayHit& lhs, const RayHit& rhs)
+	{
+		float scale = fabsf(lhs.distance) > 1.f ? fabsf(lhs.distance) : 1.f;
+		return lhs.id == rhs.id && fabsf(lhs.distance - rhs.distance) <= TOLERANCE * scale &&
+			lhs.normal_x == rhs.normal_x && lhs.normal_y == rhs.normal_y;
+	}
+
+	/**
+	*  Makes a cast of the kind picked by its index: any direction,
+	*  along one axis, or from inside a box, as a ray or a segment.
+	*/
+	Cast makeCast(Random& random, const std::vector<rect>& boxes, int index)
+	{
+		Cast cast;
+		cast.x = between(random, -200.f, AREA_WIDTH + 200.f);
+		cast.y = between(random, -200.f, AREA_HEIGHT + 200.f);
+		float angle = between(random, 0.f, 6.2831853f);
+		cast.dir_x = cosf(angle);
+		cast.dir_y = sinf(angle);
+
+		int kind = index % 4;
+		if (kind == 1)
+		{
+			float sign = random.below(2) == 0 ? -1.f : 1.f;
+			cast.dir_x = random.below(2) == 0 ? sign : 0.f;
+			cast.dir_y = cast.dir_x == 0.f ? sign : 0.f;
+		}
+		else if (kind == 2)
+		{
+			const rect& box = boxes[random.below((int)boxes.size())];
+			cast.x = between(random, box.x, box.x + box.length);
+			cast.y = between(random, box.y, box.y + box.height);
+		}
+		cast.max_distance = random.below(4) == 0 ? 1e6f : between(random, 10.f, 1500.f);
+		cast.segment = index % 8 >= 4;
+		cast.filtered = index % 5 == 0;
+		return cast;
+	}
+}
+
+/**
+*   @brief   Check Raycast
+*   @details Fills a grid with random boxes, some spanning many cells
+			 and some too thin to have any width, then checks each
+			 cast's first hit and every hit against testing every box.
+			 Ties in distance may come back in either order, so every
+			 hit is matched after sorting both lists by distance and
+			 id. The first hit only has to match one of the nearest.
+*   @return  bool
+*/
+bool checkRaycast(std::ostream& out)
+{
+	Random random(1);
+	rect area;
+	area.x = 0.f;
+	area.y = 0.f;
+	area.length = AREA_WIDTH;
+	area.height = AREA_HEIGHT;
+	SpatialGrid grid;
+	grid.setup(area, CELL_SIZE);
+
+	std::vector<rect> boxes(NUM_BOXES);
+	for (int i = 0; i < NUM_BOXES; i++)
+	{
+		rect& box = boxes[i];
+		float size = i % 10 == 0 ? 400.f : 80.f;
+		box.length = i % 17 == 0 ? 0.f : between(random, 4.f, size);
+		box.height = i % 19 == 0 ? 0.f : between(random, 4.f, size);
+		box.x = between(random, 0.f, AREA_WIDTH - box.length);
+		box.y = between(random, 0.f, AREA_HEIGHT - box.height);
+		grid.insert(box);
+	}
+
+	std::vector<Cast> casts(NUM_CASTS);
+	for (int i = 0; i < NUM_CASTS; i++)
+	{
+		casts[i] = makeCast(random, boxes, i);
+	}
+
+	std::vector<RayHit> expected;
+	std::vector<RayHit> hits;
+	int first_errors = 0;
+	int all_errors = 0;
+	int total_hits = 0;
+	for (const Cast& cast : casts)
+	{
+		RayFilter accept = nullptr;
+		if (cast.filtered)
+		{
+			accept = [&cast](int id) { return accepted(cast, id); };
+		}
+		bruteForce(boxes, cast, expected);
+		total_hits += (int)expected.size();
+
+		RayHit first;
+		bool found = false;
+		hits.clear();
+		if (cast.segment)
+		{
+			float x1 = cast.x + cast.dir_x * cast.max_distance;
+			float y1 = cast.y + cast.dir_y * cast.max_distance;
+			found = grid.segmentCast(cast.x, cast.y, x1, y1, first, accept);
+			grid.segmentCastAll(cast.x, cast.y, x1, y1, hits, accept);
+		}
+		else
+		{
+			found = grid.raycast(cast.x, cast.y, cast.dir_x, cast.dir_y,
+				cast.max_distance, first, accept);
+			grid.raycastAll(cast.x, cast.y, cast.dir_x, cast.dir_y,
+				cast.max_distance, hits, accept);
+		}
+
+		bool first_matches = found == !expected.empty();
+		if (found && first_matches)
+		{
+			first_matches = false;
+			for (const RayHit& hit : expected)
+			{
+				if (hit.distance > expected[0].distance)
+				{
+					break;
+				}
+				first_matches = first_matches || sameHit(hit, first);
+			}
+		}
+		first_errors += first_matches ? 0 : 1;
+
+		std::sort(hits.begin(), hits.end(), [](const RayHit& lhs, const RayHit& rhs)
+		{
+			return lhs.distance != rhs.distance ? lhs.distance < rhs.distance : lhs.id < rhs.id;
+		});
+		bool all_match = hits.size() == expected.size();
+		for (size_t i = 0; all_match && i < hits.size(); i++)
+		{
+			all_match = sameHit(hits[i], expected[i]);
+		}
+		all_errors += all_match ? 0 : 1;
+	}
+	bool passed = first_errors == 0 && all_errors == 0;
+	out << NUM_CASTS << " casts, " << total_hits << " hits: " << first_errors <<
+		" first hits and " << all_errors << " hit lists differ from testing every box\n";
+
+	Clock::time_point start = Clock::now();
+	int grid_found = 0;
+	for (int pass = 0; pass < TIMED_PASSES; pass++)
+	{
+		for (const Cast& cast : casts)
+		{
+			RayHit hit;
+			grid_found += grid.raycast(cast.x, cast.y, cast.dir_x, cast.dir_y,
+				cast.max_distance, hit) ? 1 : 0;
+		}
+	}
+	std::chrono::duration<double, std::nano> grid_ns = Clock::now() - start;
+
+	start = Clock::now();
+	int brute_found = 0;
+	for (int pass = 0; pass < TIMED_PASSES; pass++)
+	{
+		for (Cast cast : casts)
+		{
+			cast.filtered = false;
+			bruteForce(boxes, cast, expected);
+			brute_found += expected.empty() ? 0 : 1;
+		}
+	}
+	std::chrono::duration<double, std::nano> brute_ns = Clock::now() - start;
+
+	double casts_timed = (double)TIMED_PASSES * NUM_CASTS;
+	out << "first hit: grid " << grid_ns.count() / casts_timed << " ns, every box " <<
+		brute_ns.count() / casts_timed << " ns a cast, " << grid_found << " and " <<
+		brute_found << " found\n";
+	return passed;
+}
@@ -0,0 +1,21 @@
+#pragma once
+#include <iosfwd>
+
+/*! \file RaycastCheck.h
+@brief   Check and timing of the grid's ray and segment casts.
+@details Run by starting the game with --check-raycast, which writes
+		 the results to Raycast_check.txt instead of playing. Random
+		 boxes are put into a grid, and random rays and segments are
+		 cast through it, including axis aligned ones and ones that
+		 start inside a box. Every cast is compared with a slab test
+		 of every box. The first hit, every hit, the distances and the
+		 normals must all agree. The first hit cast is then timed
+		 against testing every box.
+*/
+
+/**
+*  Compares the grid casts with testing every box and times them.
+*  @param [in] out The stream to write the results to
+*  @return false if any cast disagreed with testing every box
+*/
+bool checkRaycast(std::ostream& out);
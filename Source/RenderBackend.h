@@ -0,0 +1,34 @@
+#pragma once
+#include "ViewTransform.h"
+
+class DrawBuffer;
+
+/**
+*  Consumes recorded frames.
+*  Backends turn the commands in a buffer into draws, whether on the
+*  live renderer or somewhere else. Commands are drawn in the order
+*  they appear in the buffer, so it should be sorted first. Commands
+*  are recorded in world units and placed on screen by the view.
+*  @see DrawBuffer
+*/
+class RenderBackend
+{
+public:
+	virtual ~RenderBackend() = default;
+
+	/**
+	*  Draws every command in a buffer.
+	*  @param [in] buffer The recorded frame
+	*/
+	virtual void draw(const DrawBuffer& buffer) = 0;
+
+	/**
+	*  Sets the transform from world units to screen pixels.
+	*  @param [in] transform The view to draw through
+	*/
+	void setView(const ViewTransform& transform) { view = transform; }
+	const ViewTransform& getView() const { return view; }
+
+protected:
+	ViewTransform view;
+};
@@ -0,0 +1,204 @@
+#include <math.h>
+#include "ShotForecast.h"
+#include "JobSystem.h"
+#include "Trajectory.h"
+#include "World.h"
+
+namespace
+{
+	rect colliderBox(const ComponentPool<Transform>& bodies, int entity)
+	{
+		const Transform& body = bodies.get(entity);
+		rect box;
+		box.x = body.x;
+		box.y = body.y;
+		box.length = body.width;
+		box.height = body.height;
+		return box;
+	}
+
+	/**
+	*  Plays out the bird touching a collider the way the game does.
+	*  Bodies with a material break and slow the bird, bodies with
+	*  only health are knocked out and solid ground ends the shot.
+	*/
+	void touch(World& trial, int collider, Velocity& bird_vel, ShotOutcome& outcome)
+	{
+		int entity = trial.colliders.entity(collider);
+		int response = trial.hitResponse(entity);
+		if (response == HIT_SOLID)
+		{
+			outcome.landed = true;
+			return;
+		}
+
+		trial.setVisible(entity, false);
+		if (response == HIT_BREAK)
+		{
+			outcome.blocks_hit++;
+			bird_vel.x -= bird_vel.x * FORECAST_BLOCK_SLOWDOWN;
+		}
+		else
+		{
+			outcome.enemies_hit++;
+		}
+	}
+
+#ifndef DETERMINISTIC_PHYSICS
+	/**
+	*  Finds the earliest time a body on the flight path leaves the
+	*  play area, as its time of impact with the four sides outside it.
+	*/
+	bool timeToLeave(const Trajectory& flight, float width, float height,
+		const rect& bounds, float max_time, float& exit_time)
+	{
+		float reach = bounds.length + bounds.height;
+		rect sides[4];
+		sides[0].x = bounds.x - reach;
+		sides[0].y = bounds.y - reach;
+		sides[0].length = reach;
+		sides[0].height = bounds.height + reach * 2.f;
+		sides[1] = sides[0];
+		sides[1].x = bounds.x + bounds.length;
+		sides[2].x = bounds.x - reach;
+		sides[2].y = bounds.y - reach;
+		sides[2].length = bounds.length + reach * 2.f;
+		sides[2].height = reach;
+		sides[3] = sides[2];
+		sides[3].y = bounds.y + bounds.height;
+
+		bool leaves = false;
+		for (const rect& side : sides)
+		{
+			float t = 0.f;
+			if (flight.timeOfImpact(width, height, side, max_time, t) &&
+				(!leaves || t < exit_time))
+			{
+				exit_time = t;
+				leaves = true;
+			}
+		}
+		return leaves;
+	}
+#endif
+
+	/**
+	*  Flies one shot in its own fork of the world.
+	*  Only the bird and the visibility of what it hits are written,
+	*  so the rest of the level stays shared with the original.
+	*/
+	ShotOutcome flyShot(const World& world, int projectile, const rect& bounds,
+		vector2 launch)
+	{
+		World trial = world;
+		ShotOutcome outcome;
+		Transform& bird = trial.transforms.get(projectile);
+		Velocity& bird_vel = trial.velocities.add(projectile);
+		bird_vel.x = launch.getX();
+		bird_vel.y = launch.getY();
+
+		const ComponentPool<Transform>& bodies = trial.transforms;
+		const ComponentPool<Collider>& colliders = trial.colliders;
+#ifdef DETERMINISTIC_PHYSICS
+		// impacts are solved in float, so this build steps the bird in
+		// fixed point like the game does and probes after every tick
+		FixedFlightStep step(FORECAST_STEP);
+		while (!outcome.landed && outcome.ticks < FORECAST_MAX_TICKS)
+		{
+			outcome.ticks++;
+			step.apply(bird.x, bird.y, bird_vel.x, bird_vel.y);
+			if (bird.x < bounds.x || bird.y < bounds.y ||
+				bird.x + bird.width > bounds.x + bounds.length ||
+				bird.y + bird.height > bounds.y + bounds.height)
+			{
+				break;
+			}
+
+			rect bird_rect;
+			bird_rect.x = bird.x;
+			bird_rect.y = bird.y;
+			bird_rect.length = bird.width;
+			bird_rect.height = bird.height;
+			for (int i = 0; i < colliders.size() && !outcome.landed; i++)
+			{
+				int entity = colliders.entity(i);
+				if (trial.isVisible(entity) &&
+					bird_rect.isInside(colliderBox(bodies, entity)))
+				{
+					touch(trial, i, bird_vel, outcome);
+				}
+			}
+		}
+#else
+		// the flight path is solved exactly, so the shot jumps straight
+		// from one impact to the next instead of probing every tick
+		float time_left = FORECAST_MAX_TICKS * FORECAST_STEP;
+		float flown = 0.f;
+		while (!outcome.landed)
+		{
+			Trajectory flight(bird.x, bird.y, vector2(bird_vel.x, bird_vel.y));
+			float impact = time_left;
+			int first = -1;
+			for (int i = 0; i < colliders.size(); i++)
+			{
+				int entity = colliders.entity(i);
+				float t = 0.f;
+				if (trial.isVisible(entity) &&
+					flight.timeOfImpact(bird.width, bird.height,
+						colliderBox(bodies, entity), impact, t) &&
+					(first < 0 || t < impact))
+				{
+					impact = t;
+					first = i;
+				}
+			}
+
+			float exit_time = 0.f;
+			bool leaves = timeToLeave(flight, bird.width, bird.height, bounds,
+				impact, exit_time) && (first < 0 || exit_time < impact);
+			float t = leaves ? exit_time : impact;
+			vector2 position = flight.positionAt(t);
+			vector2 velocity = flight.velocityAt(t);
+			bird.x = position.getX();
+			bird.y = position.getY();
+			bird_vel.x = velocity.getX();
+			bird_vel.y = velocity.getY();
+			flown += t;
+			time_left -= t;
+			if (leaves || first < 0)
+			{
+				break;
+			}
+			touch(trial, first, bird_vel, outcome);
+		}
+		outcome.ticks = (int)ceilf(flown / FORECAST_STEP);
+		outcome.ticks = outcome.ticks > FORECAST_MAX_TICKS ? FORECAST_MAX_TICKS : outcome.ticks;
+#endif
+		outcome.end = vector2(bird.x, bird.y);
+		return outcome;
+	}
+}
+
+ShotForecast::ShotForecast(JobSystem& job_system) :
+	jobs(job_system)
+{
+}
+
+/**
+*   @brief   Evaluate
+*   @details Splits the candidates into jobs of a few shots each and
+			 waits for them all. The jobs only read the world, and each
+			 fork is private to the job flying it.
+*   @return  void
+*/
+void ShotForecast::evaluate(const World& world, int projectile, const rect& bounds,
+	const vector2* launches, ShotOutcome* outcomes, int count)
+{
+	jobs.parallelFor(count, FORECAST_GRAIN, [&](int first, int last)
+	{
+		for (int i = first; i < last; i++)
+		{
+			outcomes[i] = flyShot(world, projectile, bounds, launches[i]);
+		}
+	});
+}
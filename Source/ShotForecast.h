@@ -0,0 +1,60 @@
+#pragma once
+#include "Constants.h"
+#include "Rect.h"
+#include "Vector2.h"
+
+class JobSystem;
+class World;
+
+/**
+*  What a forecast shot did before it stopped.
+*/
+struct ShotOutcome
+{
+	int enemies_hit = 0;
+	int blocks_hit = 0;
+	int ticks = 0;
+	bool landed = false;
+	vector2 end;
+};
+
+/**
+*  Flies candidate shots in forks of the world to see what they hit.
+*  Every candidate starts from the same world, which each one forks,
+*  so the level is shared between them and a fork only holds the
+*  pages its shot changes. The forks are flown in parallel as jobs.
+*  A shot flies the way the game flies the bird, breaking the blocks
+*  and pigs it passes through and slowing on each block, until it
+*  lands on a platform, leaves the play area or runs out of ticks.
+*  Its path is solved in closed form, so it jumps from each impact
+*  straight to the next, found with Trajectory::timeOfImpact. The
+*  fixed point build steps it tick by tick instead, as the game does.
+*  Everything else in the level is held still, and blasts and bird
+*  abilities are not played out.
+*/
+class ShotForecast
+{
+public:
+	/**
+	*  Constructor.
+	*  @param [in] job_system The jobs the shots are flown on
+	*/
+	explicit ShotForecast(JobSystem& job_system);
+
+	/**
+	*  Flies every candidate launch and waits for them all.
+	*  The world is read by every thread, so it must not change until
+	*  this returns.
+	*  @param [in] world The world the shots start from
+	*  @param [in] projectile The entity of the bird being launched
+	*  @param [in] bounds The play area, leaving it ends a shot
+	*  @param [in] launches The launch velocity of each candidate
+	*  @param [out] outcomes What each candidate did, in the same order
+	*  @param [in] count The number of candidates
+	*/
+	void evaluate(const World& world, int projectile, const rect& bounds,
+		const vector2* launches, ShotOutcome* outcomes, int count);
+
+private:
+	JobSystem& jobs;
+};
@@ -0,0 +1,31 @@
+#include "Snapshot.h"
+
+void Snapshot::clear()
+{
+	bytes.clear();
+}
+
+size_t Snapshot::size() const
+{
+	return bytes.size();
+}
+
+const char* Snapshot::data() const
+{
+	return bytes.data();
+}
+
+SnapshotReader::SnapshotReader(const Snapshot& snapshot) :
+	bytes(snapshot.data()), size(snapshot.size())
+{
+}
+
+bool SnapshotReader::good() const
+{
+	return !failed;
+}
+
+bool SnapshotReader::finished() const
+{
+	return !failed && offset == size;
+}
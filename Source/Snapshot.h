@@ -0,0 +1,135 @@
+#pragma once
+#include <cstring>
+#include <type_traits>
+#include "MemoryTracker.h"
+
+/**
+*  A flat copy of simulation state.
+*  Systems append their state with save, in a fixed order, and read
+*  it back in the same order with restore. Only trivially copyable
+*  data goes in, so both directions are a run of memcpys and cost as
+*  much as the state is big. Arrays are stored as a count followed by
+*  their elements. The buffer keeps its capacity when it is cleared,
+*  so taking the same snapshot again does not allocate.
+*  @see SnapshotReader
+*/
+class Snapshot
+{
+public:
+	/**
+	*  Default constructor.
+	*/
+	Snapshot() = default;
+
+	/**
+	*  Empties the snapshot, keeping its buffer.
+	*/
+	void clear();
+
+	template <class T>
+	void write(const T& value)
+	{
+		writeArray(&value, 1);
+	}
+
+	template <class T>
+	void writeArray(const T* values, size_t count)
+	{
+		static_assert(std::is_trivially_copyable<T>::value,
+			"snapshots are restored by copying bytes");
+		if (count == 0)
+		{
+			return;
+		}
+		size_t offset = bytes.size();
+		bytes.resize(offset + sizeof(T) * count);
+		memcpy(bytes.data() + offset, values, sizeof(T) * count);
+	}
+
+	template <class T, class Allocator>
+	void writeVector(const std::vector<T, Allocator>& values)
+	{
+		write(values.size());
+		writeArray(values.data(), values.size());
+	}
+
+	size_t size() const;
+	const char* data() const;
+
+private:
+	TaggedVector<char, MEMORY_PHYSICS> bytes;
+};
+
+/**
+*  Reads a snapshot back in the order it was written.
+*  Reading past the end of the snapshot leaves the values untouched
+*  and marks the reader as failed.
+*/
+class SnapshotReader
+{
+public:
+	/**
+	*  Starts reading a snapshot from its beginning.
+	*  @param [in] snapshot The snapshot to read
+	*/
+	explicit SnapshotReader(const Snapshot& snapshot);
+
+	template <class T>
+	void read(T& value)
+	{
+		readArray(&value, 1);
+	}
+
+	template <class T>
+	void readArray(T* values, size_t count)
+	{
+		static_assert(std::is_trivially_copyable<T>::value,
+			"snapshots are restored by copying bytes");
+		size_t length = sizeof(T) * count;
+		if (failed || length > size - offset)
+		{
+			failed = true;
+			return;
+		}
+		if (length == 0)
+		{
+			return;
+		}
+		memcpy(values, bytes + offset, length);
+		offset += length;
+	}
+
+	/**
+	*  Reads an array into a vector, resizing it to fit. A vector
+	*  that already has the capacity is not reallocated.
+	*/
+	template <class T, class Allocator>
+	void readVector(std::vector<T, Allocator>& values)
+	{
+		size_t count = 0;
+		read(count);
+		if (failed || count > (size - offset) / sizeof(T))
+		{
+			failed = true;
+			return;
+		}
+		values.resize(count);
+		readArray(values.data(), count);
+	}
+
+	/**
+	*  @return true if every read so far was inside the snapshot
+	*/
+	bool good() const;
+
+	/**
+	*  @return true if the whole snapshot has been read
+	*/
+	bool finished() const;
+
+private:
+	const char* bytes = nullptr;
+	size_t size = 0;
+	size_t offset = 0;
+	bool failed = false;
+};
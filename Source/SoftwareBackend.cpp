@@ -0,0 +1,653 @@
+#include <fstream>
+#include <math.h>
+#include <string.h>
+#include "SoftwareBackend.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SOFTWARE_SIMD
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+	const int TILE_SIZE = 64;
+
+	// height in pixels of a line of text drawn at a scale of one
+	const float FONT_SIZE = 16.f;
+	const float LINE_SPACING = 1.25f;
+
+	/**
+	*  8x8 glyphs for the printable ASCII characters, one byte per row
+	*  with the leftmost pixel in the lowest bit.
+	*/
+	const unsigned char GLYPHS[95][8] = {
+		{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+		{ 0x18, 0x3C, 0x3C, 0x18, 0x18, 0x00, 0x18, 0x00 },
+		{ 0x36, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+		{ 0x36, 0x36, 0x7F, 0x36, 0x7F, 0x36, 0x36, 0x00 },
+		{ 0x0C, 0x3E, 0x03, 0x1E, 0x30, 0x1F, 0x0C, 0x00 },
+		{ 0x00, 0x63, 0x33, 0x18, 0x0C, 0x66, 0x63, 0x00 },
+		{ 0x1C, 0x36, 0x1C, 0x6E, 0x3B, 0x33, 0x6E, 0x00 },
+		{ 0x06, 0x06, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00 },
+		{ 0x18, 0x0C, 0x06, 0x06, 0x06, 0x0C, 0x18, 0x00 },
+		{ 0x06, 0x0C, 0x18, 0x18, 0x18, 0x0C, 0x06, 0x00 },
+		{ 0x00, 0x66, 0x3C, 0xFF, 0x3C, 0x66, 0x00, 0x00 },
+		{ 0x00, 0x0C, 0x0C, 0x3F, 0x0C, 0x0C, 0x00, 0x00 },
+		{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x06 },
+		{ 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00 },
+		{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x00 },
+		{ 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x00 },
+		{ 0x3E, 0x63, 0x73, 0x7B, 0x6F, 0x67, 0x3E, 0x00 },
+		{ 0x0C, 0x0E, 0x0C, 0x0C, 0x0C, 0x0C, 0x3F, 0x00 },
+		{ 0x1E, 0x33, 0x30, 0x1C, 0x06, 0x33, 0x3F, 0x00 },
+		{ 0x1E, 0x33, 0x30, 0x1C, 0x30, 0x33, 0x1E, 0x00 },
+		{ 0x38, 0x3C, 0x36, 0x33, 0x7F, 0x30, 0x78, 0x00 },
+		{ 0x3F, 0x03, 0x1F, 0x30, 0x30, 0x33, 0x1E, 0x00 },
+		{ 0x1C, 0x06, 0x03, 0x1F, 0x33, 0x33, 0x1E, 0x00 },
+		{ 0x3F, 0x33, 0x30, 0x18, 0x0C, 0x0C, 0x0C, 0x00 },
+		{ 0x1E, 0x33, 0x33, 0x1E, 0x33, 0x33, 0x1E, 0x00 },
+		{ 0x1E, 0x33, 0x33, 0x3E, 0x30, 0x18, 0x0E, 0x00 },
+		{ 0x00, 0x0C, 0x0C, 0x00, 0x00, 0x0C, 0x0C, 0x00 },
+		{ 0x00, 0x0C, 0x0C, 0x00, 0x00, 0x0C, 0x0C, 0x06 },
+		{ 0x18, 0x0C, 0x06, 0x03, 0x06, 0x0C, 0x18, 0x00 },
+		{ 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00 },
+		{ 0x06, 0x0C, 0x18, 0x30, 0x18, 0x0C, 0x06, 0x00 },
+		{ 0x1E, 0x33, 0x30, 0x18, 0x0C, 0x00, 0x0C, 0x00 },
+		{ 0x3E, 0x63, 0x7B, 0x7B, 0x7B, 0x03, 0x1E, 0x00 },
+		{ 0x0C, 0x1E, 0x33, 0x33, 0x3F, 0x33, 0x33, 0x00 },
+		{ 0x3F, 0x66, 0x66, 0x3E, 0x66, 0x66, 0x3F, 0x00 },
+		{ 0x3C, 0x66, 0x03, 0x03, 0x03, 0x66, 0x3C, 0x00 },
+		{ 0x1F, 0x36, 0x66, 0x66, 0x66, 0x36, 0x1F, 0x00 },
+		{ 0x7F, 0x46, 0x16, 0x1E, 0x16, 0x46, 0x7F, 0x00 },
+		{ 0x7F, 0x46, 0x16, 0x1E, 0x16, 0x06, 0x0F, 0x00 },
+		{ 0x3C, 0x66, 0x03, 0x03, 0x73, 0x66, 0x7C, 0x00 },
+		{ 0x33, 0x33, 0x33, 0x3F, 0x33, 0x33, 0x33, 0x00 },
+		{ 0x1E, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x1E, 0x00 },
+		{ 0x78, 0x30, 0x30, 0x30, 0x33, 0x33, 0x1E, 0x00 },
+		{ 0x67, 0x66, 0x36, 0x1E, 0x36, 0x66, 0x67, 0x00 },
+		{ 0x0F, 0x06, 0x06, 0x06, 0x46, 0x66, 0x7F, 0x00 },
+		{ 0x63, 0x77, 0x7F, 0x7F, 0x6B, 0x63, 0x63, 0x00 },
+		{ 0x63, 0x67, 0x6F, 0x7B, 0x73, 0x63, 0x63, 0x00 },
+		{ 0x1C, 0x36, 0x63, 0x63, 0x63, 0x36, 0x1C, 0x00 },
+		{ 0x3F, 0x66, 0x66, 0x3E, 0x06, 0x06, 0x0F, 0x00 },
+		{ 0x1E, 0x33, 0x33, 0x33, 0x3B, 0x1E, 0x38, 0x00 },
+		{ 0x3F, 0x66, 0x66, 0x3E, 0x36, 0x66, 0x67, 0x00 },
+		{ 0x1E, 0x33, 0x07, 0x0E, 0x38, 0x33, 0x1E, 0x00 },
+		{ 0x3F, 0x2D, 0x0C, 0x0C, 0x0C, 0x0C, 0x1E, 0x00 },
+		{ 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3F, 0x00 },
+		{ 0x33, 0x33, 0x33, 0x33, 0x33, 0x1E, 0x0C, 0x00 },
+		{ 0x63, 0x63, 0x63, 0x6B, 0x7F, 0x77, 0x63, 0x00 },
+		{ 0x63, 0x63, 0x36, 0x1C, 0x1C, 0x36, 0x63, 0x00 },
+		{ 0x33, 0x33, 0x33, 0x1E, 0x0C, 0x0C, 0x1E, 0x00 },
+		{ 0x7F, 0x63, 0x31, 0x18, 0x4C, 0x66, 0x7F, 0x00 },
+		{ 0x1E, 0x06, 0x06, 0x06, 0x06, 0x06, 0x1E, 0x00 },
+		{ 0x03, 0x06, 0x0C, 0x18, 0x30, 0x60, 0x40, 0x00 },
+		{ 0x1E, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1E, 0x00 },
+		{ 0x08, 0x1C, 0x36, 0x63, 0x00, 0x00, 0x00, 0x00 },
+		{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF },
+		{ 0x0C, 0x0C, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00 },
+		{ 0x00, 0x00, 0x1E, 0x30, 0x3E, 0x33, 0x6E, 0x00 },
+		{ 0x07, 0x06, 0x06, 0x3E, 0x66, 0x66, 0x3B, 0x00 },
+		{ 0x00, 0x00, 0x1E, 0x33, 0x03, 0x33, 0x1E, 0x00 },
+		{ 0x38, 0x30, 0x30, 0x3E, 0x33, 0x33, 0x6E, 0x00 },
+		{ 0x00, 0x00, 0x1E, 0x33, 0x3F, 0x03, 0x1E, 0x00 },
+		{ 0x1C, 0x36, 0x06, 0x0F, 0x06, 0x06, 0x0F, 0x00 },
+		{ 0x00, 0x00, 0x6E, 0x33, 0x33, 0x3E, 0x30, 0x1F },
+		{ 0x07, 0x06, 0x36, 0x6E, 0x66, 0x66, 0x67, 0x00 },
+		{ 0x0C, 0x00, 0x0E, 0x0C, 0x0C, 0x0C, 0x1E, 0x00 },
+		{ 0x30, 0x00, 0x30, 0x30, 0x30, 0x33, 0x33, 0x1E },
+		{ 0x07, 0x06, 0x66, 0x36, 0x1E, 0x36, 0x67, 0x00 },
+		{ 0x0E, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x1E, 0x00 },
+		{ 0x00, 0x00, 0x33, 0x7F, 0x7F, 0x6B, 0x63, 0x00 },
+		{ 0x00, 0x00, 0x1F, 0x33, 0x33, 0x33, 0x33, 0x00 },
+		{ 0x00, 0x00, 0x1E, 0x33, 0x33, 0x33, 0x1E, 0x00 },
+		{ 0x00, 0x00, 0x3B, 0x66, 0x66, 0x3E, 0x06, 0x0F },
+		{ 0x00, 0x00, 0x6E, 0x33, 0x33, 0x3E, 0x30, 0x78 },
+		{ 0x00, 0x00, 0x3B, 0x6E, 0x66, 0x06, 0x0F, 0x00 },
+		{ 0x00, 0x00, 0x3E, 0x03, 0x1E, 0x30, 0x1F, 0x00 },
+		{ 0x08, 0x0C, 0x3E, 0x0C, 0x0C, 0x2C, 0x18, 0x00 },
+		{ 0x00, 0x00, 0x33, 0x33, 0x33, 0x33, 0x6E, 0x00 },
+		{ 0x00, 0x00, 0x33, 0x33, 0x33, 0x1E, 0x0C, 0x00 },
+		{ 0x00, 0x00, 0x63, 0x6B, 0x7F, 0x7F, 0x36, 0x00 },
+		{ 0x00, 0x00, 0x63, 0x36, 0x1C, 0x36, 0x63, 0x00 },
+		{ 0x00, 0x00, 0x33, 0x33, 0x33, 0x3E, 0x30, 0x1F },
+		{ 0x00, 0x00, 0x3F, 0x19, 0x0C, 0x26, 0x3F, 0x00 },
+		{ 0x38, 0x0C, 0x0C, 0x07, 0x0C, 0x0C, 0x38, 0x00 },
+		{ 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x18, 0x00 },
+		{ 0x07, 0x0C, 0x0C, 0x38, 0x0C, 0x0C, 0x07, 0x00 },
+		{ 0x6E, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	};
+
+	unsigned int toByte(float value)
+	{
+		value = value < 0.f ? 0.f : (value > 1.f ? 1.f : value);
+		return (unsigned int)(value * 255.f + 0.5f);
+	}
+
+	/**
+	*  Scales each channel of a premultiplied pixel by a factor
+	*  out of 256.
+	*/
+	unsigned int modulate(unsigned int pixel, const unsigned int factor[4])
+	{
+		unsigned int result = 0;
+		for (int channel = 0; channel < 4; channel++)
+		{
+			unsigned int value = (pixel >> (channel * 8)) & 0xff;
+			result |= ((value * factor[channel]) >> 8) << (channel * 8);
+		}
+		return result;
+	}
+
+	/**
+	*  Blends a premultiplied pixel over the destination.
+	*/
+	unsigned int blend(unsigned int source, unsigned int destination)
+	{
+		unsigned int inverse = 255 - (source >> 24);
+		unsigned int result = 0;
+		for (int channel = 0; channel < 4; channel++)
+		{
+			unsigned int value = ((destination >> (channel * 8)) & 0xff) * inverse + 128;
+			value = (value + (value >> 8)) >> 8;
+			value += (source >> (channel * 8)) & 0xff;
+			result |= (value > 255 ? 255 : value) << (channel * 8);
+		}
+		return result;
+	}
+
+	/**
+	*  Modulates a row of source pixels and blends them over the
+	*  destination. Runs of transparent source pixels are skipped and
+	*  opaque pixels drawn without a tint are copied. The SSE2 path
+	*  widens each channel to 16 bits and works on four pixels at once,
+	*  with the same arithmetic as modulate and blend.
+	*/
+	void blendSpan(const unsigned int* source, unsigned int* destination, int count,
+		const unsigned int factor[4])
+	{
+		bool untinted = factor[0] == 256 && factor[1] == 256 && factor[2] == 256 &&
+			factor[3] == 256;
+		int i = 0;
+#ifdef SOFTWARE_SIMD
+		__m128i zero = _mm_setzero_si128();
+		__m128i bias = _mm_set1_epi16(128);
+		__m128i full = _mm_set1_epi16(255);
+		__m128i alpha_mask = _mm_set1_epi32((int)0xff000000u);
+		__m128i simd_factor = _mm_setr_epi16(
+			(short)factor[0], (short)factor[1], (short)factor[2], (short)factor[3],
+			(short)factor[0], (short)factor[1], (short)factor[2], (short)factor[3]);
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128i source_pixels = _mm_loadu_si128((const __m128i*)&source[i]);
+			__m128i alpha = _mm_and_si128(source_pixels, alpha_mask);
+			if (_mm_movemask_epi8(_mm_cmpeq_epi32(alpha, zero)) == 0xffff)
+			{
+				continue;
+			}
+			if (untinted && _mm_movemask_epi8(_mm_cmpeq_epi32(alpha, alpha_mask)) == 0xffff)
+			{
+				_mm_storeu_si128((__m128i*)&destination[i], source_pixels);
+				continue;
+			}
+
+			__m128i destination_pixels = _mm_loadu_si128((const __m128i*)&destination[i]);
+			__m128i halves[2];
+			for (int half = 0; half < 2; half++)
+			{
+				__m128i src = half == 0 ? _mm_unpacklo_epi8(source_pixels, zero) :
+					_mm_unpackhi_epi8(source_pixels, zero);
+				__m128i dst = half == 0 ? _mm_unpacklo_epi8(destination_pixels, zero) :
+					_mm_unpackhi_epi8(destination_pixels, zero);
+				src = _mm_srli_epi16(_mm_mullo_epi16(src, simd_factor), 8);
+
+				__m128i inverse = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 3, 3, 3));
+				inverse = _mm_sub_epi16(full, _mm_shufflehi_epi16(inverse, _MM_SHUFFLE(3, 3, 3, 3)));
+				__m128i value = _mm_add_epi16(_mm_mullo_epi16(dst, inverse), bias);
+				value = _mm_srli_epi16(_mm_add_epi16(value, _mm_srli_epi16(value, 8)), 8);
+				halves[half] = _mm_add_epi16(value, src);
+			}
+			_mm_storeu_si128((__m128i*)&destination[i], _mm_packus_epi16(halves[0], halves[1]));
+		}
+#endif
+		for (; i < count; i++)
+		{
+			if ((source[i] >> 24) == 0)
+			{
+				continue;
+			}
+			destination[i] = untinted && (source[i] >> 24) == 255 ? source[i] :
+				blend(modulate(source[i], factor), destination[i]);
+		}
+	}
+}
+
+/**
+*   @brief   Init
+*   @details Allocates the framebuffer and the per tile command lists.
+*   @return  void
+*/
+void SoftwareBackend::init(int new_width, int new_height)
+{
+	width = new_width > 0 ? new_width : 1;
+	height = new_height > 0 ? new_height : 1;
+	tiles_x = (width + TILE_SIZE - 1) / TILE_SIZE;
+	tiles_y = (height + TILE_SIZE - 1) / TILE_SIZE;
+	tile_commands.assign(tiles_x * tiles_y, std::vector<int>());
+	framebuffer.assign((size_t)width * height, clear_pixel);
+}
+
+/**
+*   @brief   Set Texture
+*   @details Copies the pixels, premultiplying the colour by alpha.
+*   @return  void
+*/
+void SoftwareBackend::setTexture(int id, int texture_width, int texture_height,
+	const unsigned char* rgba)
+{
+	if (id < 0)
+	{
+		return;
+	}
+	if (id >= (int)textures.size())
+	{
+		textures.resize(id + 1);
+	}
+
+	SoftwareTexture& texture = textures[id];
+	texture.width = texture_width;
+	texture.height = texture_height;
+	texture.pixels.resize((size_t)texture_width * texture_height);
+	for (size_t i = 0; i < texture.pixels.size(); i++)
+	{
+		const unsigned char* in = &rgba[i * 4];
+		unsigned int alpha = in[3];
+		unsigned int pixel = alpha << 24;
+		for (int channel = 0; channel < 3; channel++)
+		{
+			pixel |= ((in[channel] * alpha + 127) / 255) << (channel * 8);
+		}
+		texture.pixels[i] = pixel;
+	}
+}
+
+/**
+*   @brief   Draw
+*   @details Composites the static layer into its own target when it,
+			 the clear colour or the view has changed since it was last
+			 drawn, then draws the frame on top of a copy of that target.
+*   @return  void
+*/
+void SoftwareBackend::draw(const DrawBuffer& buffer)
+{
+	if (buffer.hasClearColour())
+	{
+		const float* colour = buffer.getClearColour();
+		clear_pixel = 0xff000000u | toByte(colour[0]) |
+			(toByte(colour[1]) << 8) | (toByte(colour[2]) << 16);
+	}
+
+	const DrawBuffer* layer = buffer.getStaticLayer();
+	if (layer == nullptr)
+	{
+		rasterize(buffer, nullptr);
+		return;
+	}
+	if (!static_valid || static_clear != clear_pixel ||
+		!static_view.matches(view) || !static_commands.matches(*layer))
+	{
+		rasterize(*layer, nullptr);
+		static_pixels = framebuffer;
+		static_commands = *layer;
+		static_clear = clear_pixel;
+		static_view = view;
+		static_valid = true;
+		static_redraws++;
+	}
+	rasterize(buffer, &static_pixels);
+}
+
+/**
+*   @brief   Rasterize
+*   @details Places every command through the view and bins it into
+			 the tiles its bounds overlap, then draws the tiles one at
+			 a time. Each tile starts from
+			 the base image, or the clear colour if there is none.
+			 Commands keep their order within each tile.
+*   @return  void
+*/
+void SoftwareBackend::rasterize(const DrawBuffer& buffer, const std::vector<unsigned int>* base)
+{
+	for (std::vector<int>& commands : tile_commands)
+	{
+		commands.clear();
+	}
+
+	const TaggedVector<DrawCommand, MEMORY_SPRITES>& commands = buffer.getCommands();
+	placed.resize(commands.size());
+	draw_calls = 0;
+	for (int i = 0; i < (int)commands.size(); i++)
+	{
+		placed[i] = view.apply(commands[i]);
+		const DrawCommand& command = placed[i];
+		if (command.type == DRAW_TEXT)
+		{
+			// text grows right and down from the top of its first line,
+			// its layout size in character cells is kept in the command
+			float size = FONT_SIZE * command.scale;
+			bin(i, command.x, command.y - size, command.x + command.width * size,
+				command.y - size + command.height * size * LINE_SPACING);
+		}
+		else
+		{
+			if (command.texture < 0 || command.texture >= (int)textures.size() ||
+				textures[command.texture].pixels.empty())
+			{
+				continue;
+			}
+
+			// bounds of the quad after rotating around its centre
+			float half_width = command.width * command.scale * 0.5f;
+			float half_height = command.height * command.scale * 0.5f;
+			float centre_x = command.x + command.width * 0.5f;
+			float centre_y = command.y + command.height * 0.5f;
+			float cos_r = fabsf(cosf(command.rotation));
+			float sin_r = fabsf(sinf(command.rotation));
+			float extent_x = half_width * cos_r + half_height * sin_r;
+			float extent_y = half_width * sin_r + half_height * cos_r;
+			bin(i, centre_x - extent_x, centre_y - extent_y,
+				centre_x + extent_x, centre_y + extent_y);
+		}
+		draw_calls++;
+	}
+
+	for (int tile_y = 0; tile_y < tiles_y; tile_y++)
+	{
+		for (int tile_x = 0; tile_x < tiles_x; tile_x++)
+		{
+			int min_x = tile_x * TILE_SIZE;
+			int min_y = tile_y * TILE_SIZE;
+			int max_x = min_x + TILE_SIZE < width ? min_x + TILE_SIZE : width;
+			int max_y = min_y + TILE_SIZE < height ? min_y + TILE_SIZE : height;
+			for (int y = min_y; y < max_y; y++)
+			{
+				unsigned int* row = &framebuffer[(size_t)y * width];
+				if (base != nullptr)
+				{
+					memcpy(&row[min_x], &(*base)[(size_t)y * width + min_x],
+						(max_x - min_x) * sizeof(unsigned int));
+					continue;
+				}
+				for (int x = min_x; x < max_x; x++)
+				{
+					row[x] = clear_pixel;
+				}
+			}
+
+			for (int idx : tile_commands[tile_y * tiles_x + tile_x])
+			{
+				const DrawCommand& command = placed[idx];
+				if (command.type == DRAW_TEXT)
+				{
+					drawText(command, buffer.getGlyphs(command), tile_x, tile_y);
+				}
+				else
+				{
+					drawSprite(command, tile_x, tile_y);
+				}
+			}
+		}
+	}
+}
+
+void SoftwareBackend::bin(int command, float min_x, float min_y, float max_x, float max_y)
+{
+	if (max_x <= 0.f || max_y <= 0.f || min_x >= width || min_y >= height)
+	{
+		return;
+	}
+
+	int first_x = min_x <= 0.f ? 0 : (int)min_x / TILE_SIZE;
+	int first_y = min_y <= 0.f ? 0 : (int)min_y / TILE_SIZE;
+	int last_x = max_x >= width ? tiles_x - 1 : (int)max_x / TILE_SIZE;
+	int last_y = max_y >= height ? tiles_y - 1 : (int)max_y / TILE_SIZE;
+	for (int y = first_y; y <= last_y; y++)
+	{
+		for (int x = first_x; x <= last_x; x++)
+		{
+			tile_commands[y * tiles_x + x].push_back(command);
+		}
+	}
+}
+
+/**
+*   @brief   Draw Sprite
+*   @details Draws the part of a quad inside one tile. Pixels are
+			 mapped back into the quad through the inverse rotation and
+			 sampled from the source rectangle. Quads without rotation
+			 look up their texel columns once per row and blend four
+			 pixels at a time.
+*   @return  void
+*/
+void SoftwareBackend::drawSprite(const DrawCommand& command, int tile_x, int tile_y)
+{
+	const SoftwareTexture& texture = textures[command.texture];
+	float quad_width = command.width * command.scale;
+	float quad_height = command.height * command.scale;
+	if (quad_width <= 0.f || quad_height <= 0.f)
+	{
+		return;
+	}
+
+	unsigned int factor[4] = {
+		toByte(command.colour[0] * command.opacity) + 1,
+		toByte(command.colour[1] * command.opacity) + 1,
+		toByte(command.colour[2] * command.opacity) + 1,
+		toByte(command.opacity) + 1 };
+
+	float centre_x = command.x + command.width * 0.5f;
+	float centre_y = command.y + command.height * 0.5f;
+	float left = centre_x - quad_width * 0.5f;
+	float top = centre_y - quad_height * 0.5f;
+	float texels_x = command.source[2] / quad_width;
+	float texels_y = command.source[3] / quad_height;
+
+	int min_x = tile_x * TILE_SIZE;
+	int min_y = tile_y * TILE_SIZE;
+	int max_x = min_x + TILE_SIZE < width ? min_x + TILE_SIZE : width;
+	int max_y = min_y + TILE_SIZE < height ? min_y + TILE_SIZE : height;
+
+	if (command.rotation == 0.f)
+	{
+		// pixel centres inside the quad
+		int start_x = (int)ceilf(left - 0.5f);
+		int start_y = (int)ceilf(top - 0.5f);
+		int end_x = (int)ceilf(left + quad_width - 0.5f);
+		int end_y = (int)ceilf(top + quad_height - 0.5f);
+		start_x = start_x < min_x ? min_x : start_x;
+		start_y = start_y < min_y ? min_y : start_y;
+		end_x = end_x > max_x ? max_x : end_x;
+		end_y = end_y > max_y ? max_y : end_y;
+		if (start_x >= end_x || start_y >= end_y)
+		{
+			return;
+		}
+
+		// texel columns are the same for every row of the quad
+		int span = end_x - start_x;
+		int columns[TILE_SIZE];
+		unsigned int texels[TILE_SIZE];
+		for (int x = 0; x < span; x++)
+		{
+			int texel_x = (int)(command.source[0] + (start_x + x + 0.5f - left) * texels_x);
+			columns[x] = texel_x < 0 ? 0 : (texel_x >= texture.width ? texture.width - 1 : texel_x);
+		}
+		for (int y = start_y; y < end_y; y++)
+		{
+			int texel_y = (int)(command.source[1] + (y + 0.5f - top) * texels_y);
+			texel_y = texel_y < 0 ? 0 : (texel_y >= texture.height ? texture.height - 1 : texel_y);
+			const unsigned int* texture_row = &texture.pixels[(size_t)texel_y * texture.width];
+			for (int x = 0; x < span; x++)
+			{
+				texels[x] = texture_row[columns[x]];
+			}
+
+			blendSpan(texels, &framebuffer[(size_t)y * width + start_x], span, factor);
+		}
+		return;
+	}
+
+	// only visit the pixels inside the bounds of the rotated quad
+	float cos_r = cosf(command.rotation);
+	float sin_r = sinf(command.rotation);
+	float extent_x = (fabsf(cos_r) * quad_width + fabsf(sin_r) * quad_height) * 0.5f;
+	float extent_y = (fabsf(sin_r) * quad_width + fabsf(cos_r) * quad_height) * 0.5f;
+	int start_x = (int)(centre_x - extent_x);
+	int start_y = (int)(centre_y - extent_y);
+	int end_x = (int)(centre_x + extent_x) + 1;
+	int end_y = (int)(centre_y + extent_y) + 1;
+	start_x = start_x < min_x ? min_x : start_x;
+	start_y = start_y < min_y ? min_y : start_y;
+	end_x = end_x > max_x ? max_x : end_x;
+	end_y = end_y > max_y ? max_y : end_y;
+
+	if (start_x >= end_x || start_y >= end_y)
+	{
+		return;
+	}
+
+	// pixels outside the quad stay transparent and are skipped by the blend
+	int span = end_x - start_x;
+	unsigned int texels[TILE_SIZE];
+	for (int y = start_y; y < end_y; y++)
+	{
+		float dx = start_x + 0.5f - centre_x;
+		float dy = y + 0.5f - centre_y;
+		float local_x = dx * cos_r + dy * sin_r + quad_width * 0.5f;
+		float local_y = -dx * sin_r + dy * cos_r + quad_height * 0.5f;
+		for (int x = 0; x < span; x++, local_x += cos_r, local_y -= sin_r)
+		{
+			texels[x] = 0;
+			if (local_x < 0.f || local_y < 0.f || local_x >= quad_width || local_y >= quad_height)
+			{
+				continue;
+			}
+			int texel_x = (int)(command.source[0] + local_x * texels_x);
+			int texel_y = (int)(command.source[1] + local_y * texels_y);
+			texel_x = texel_x >= texture.width ? texture.width - 1 : texel_x;
+			texel_y = texel_y >= texture.height ? texture.height - 1 : texel_y;
+			texels[x] = texture.pixels[(size_t)texel_y * texture.width + texel_x];
+		}
+
+		blendSpan(texels, &framebuffer[(size_t)y * width + start_x], span, factor);
+	}
+}
+
+/**
+*   @brief   Draw Text
+*   @details Draws the pixels of the shaped glyphs inside one tile.
+			 The text starts on the baseline of its first line, as it
+			 does in ASGE.
+*   @return  void
+*/
+void SoftwareBackend::drawText(const DrawCommand& command, const Glyph* glyphs,
+	int tile_x, int tile_y)
+{
+	unsigned int colour = 0xff000000u | toByte(command.colour[0]) |
+		(toByte(command.colour[1]) << 8) | (toByte(command.colour[2]) << 16);
+	float size = FONT_SIZE * command.scale;
+	float cell = size / 8.f;
+
+	int min_x = tile_x * TILE_SIZE;
+	int min_y = tile_y * TILE_SIZE;
+	int max_x = min_x + TILE_SIZE < width ? min_x + TILE_SIZE : width;
+	int max_y = min_y + TILE_SIZE < height ? min_y + TILE_SIZE : height;
+
+	for (int i = 0; i < command.glyph_count; i++)
+	{
+		float pen_x = command.x + glyphs[i].column * size;
+		float pen_y = command.y - size + glyphs[i].line * size * LINE_SPACING;
+		if (pen_x >= max_x || pen_x + size <= min_x || pen_y >= max_y || pen_y + size <= min_y)
+		{
+			continue;
+		}
+
+		const unsigned char* glyph = GLYPHS[glyphs[i].code - 32];
+		int start_x = (int)pen_x < min_x ? min_x : (int)pen_x;
+		int start_y = (int)pen_y < min_y ? min_y : (int)pen_y;
+		int end_x = (int)(pen_x + size) > max_x ? max_x : (int)(pen_x + size);
+		int end_y = (int)(pen_y + size) > max_y ? max_y : (int)(pen_y + size);
+		for (int y = start_y; y < end_y; y++)
+		{
+			int glyph_row = (int)((y + 0.5f - pen_y) / cell);
+			if (glyph_row < 0 || glyph_row > 7)
+			{
+				continue;
+			}
+			unsigned char bits = glyph[glyph_row];
+			unsigned int* row = &framebuffer[(size_t)y * width];
+			for (int x = start_x; x < end_x; x++)
+			{
+				int glyph_column = (int)((x + 0.5f - pen_x) / cell);
+				if (glyph_column >= 0 && glyph_column < 8 && (bits >> glyph_column) & 1)
+				{
+					row[x] = colour;
+				}
+			}
+		}
+	}
+}
+
+/**
+*   @brief   Save PPM
+*   @details Writes the colour channels of every pixel, top to bottom.
+*   @return  bool
+*/
+bool SoftwareBackend::savePPM(const std::string& file_name) const
+{
+	std::ofstream file(file_name, std::ios::binary);
+	if (!file)
+	{
+		return false;
+	}
+
+	file << "P6\n" << width << " " << height << "\n255\n";
+	std::vector<unsigned char> row((size_t)width * 3);
+	for (int y = 0; y < height; y++)
+	{
+		for (int x = 0; x < width; x++)
+		{
+			unsigned int pixel = framebuffer[(size_t)y * width + x];
+			row[x * 3] = (unsigned char)(pixel & 0xff);
+			row[x * 3 + 1] = (unsigned char)((pixel >> 8) & 0xff);
+			row[x * 3 + 2] = (unsigned char)((pixel >> 16) & 0xff);
+		}
+		file.write((const char*)row.data(), row.size());
+	}
+	return (bool)file;
+}
+
+const std::vector<unsigned int>& SoftwareBackend::getPixels() const
+{
+	return framebuffer;
+}
+
+int SoftwareBackend::getWidth() const
+{
+	return width;
+}
+
+int SoftwareBackend::getHeight() const
+{
+	return height;
+}
+
+int SoftwareBackend::drawCalls() const
+{
+	return draw_calls;
+}
+
+int SoftwareBackend::staticRedraws() const
+{
+	return static_redraws;
+}
@@ -0,0 +1,99 @@
+#pragma once
+#include <string>
+#include <vector>
+#include "DrawBuffer.h"
+#include "MemoryTracker.h"
+#include "RenderBackend.h"
+
+/**
+*  A texture held in memory by the software backend.
+*  Pixels are packed RGBA, red in the lowest byte, with the colour
+*  premultiplied by alpha.
+*/
+struct SoftwareTexture
+{
+	int width = 0;
+	int height = 0;
+	TaggedVector<unsigned int, MEMORY_TEXTURES> pixels;
+};
+
+/**
+*  Draws recorded frames on the CPU into a framebuffer in memory.
+*  Needs no window or graphics driver, so frames can be rendered,
+*  timed and compared on machines without the OpenGL build.
+*  Sprites are textured quads with rotation, opacity and tint, sampled
+*  with the nearest texel. Text uses a built in 8x8 bitmap font. The
+*  screen is split into tiles and each tile draws only the commands
+*  that overlap it, so every tile stays in cache while it is drawn.
+*  Blending uses SSE2 where it is available. A static layer under the
+*  frame is composited into its own target and reused until it changes.
+*/
+class SoftwareBackend : public RenderBackend
+{
+public:
+	/**
+	*  Default constructor.
+	*/
+	SoftwareBackend() = default;
+
+	/**
+	*  Sizes the framebuffer and clears it to black.
+	*  @param [in] width The width of the framebuffer in pixels
+	*  @param [in] height The height of the framebuffer in pixels
+	*/
+	void init(int width, int height);
+
+	/**
+	*  Stores the pixels of a texture under the id the draw commands
+	*  use for it.
+	*  @param [in] id The texture id
+	*  @param [in] width The width of the texture
+	*  @param [in] height The height of the texture
+	*  @param [in] rgba The pixels, four bytes each, row by row
+	*/
+	void setTexture(int id, int width, int height, const unsigned char* rgba);
+
+	void draw(const DrawBuffer& buffer) override;
+
+	/**
+	*  Writes the framebuffer as a binary PPM image.
+	*  @param [in] file_name The path of the file to write
+	*  @return true if the file was written
+	*/
+	bool savePPM(const std::string& file_name) const;
+
+	const std::vector<unsigned int>& getPixels() const;
+	int getWidth() const;
+	int getHeight() const;
+	int drawCalls() const;
+
+	/**
+	*  @return the number of times the static layer was composited
+	*/
+	int staticRedraws() const;
+
+private:
+	void rasterize(const DrawBuffer& buffer, const std::vector<unsigned int>* base);
+	void bin(int command, float min_x, float min_y, float max_x, float max_y);
+	void drawSprite(const DrawCommand& command, int tile_x, int tile_y);
+	void drawText(const DrawCommand& command, const Glyph* glyphs, int tile_x, int tile_y);
+
+	int width = 0;
+	int height = 0;
+	int tiles_x = 0;
+	int tiles_y = 0;
+	unsigned int clear_pixel = 0xff000000u;
+	std::vector<unsigned int> framebuffer;
+	std::vector<SoftwareTexture> textures;
+	std::vector<std::vector<int>> tile_commands;
+	std::vector<DrawCommand> placed;
+	int draw_calls = 0;
+
+	// the static layer, composited offscreen until its commands change
+	std::vector<unsigned int> static_pixels;
+	DrawBuffer static_commands;
+	unsigned int static_clear = 0;
+	ViewTransform static_view;
+	bool static_valid = false;
+	int static_redraws = 0;
+};
@@ -0,0 +1,434 @@
+#include <algorithm>
+#include <float.h>
+#include <math.h>
+#include "SpatialGrid.h"
+
+/**
+*   @brief   Setup
+*   @details Sizes the cell array to cover the area. Existing cells
+			 are reused so rebuilding the grid does not reallocate.
+*   @return  void
+*/
+void SpatialGrid::setup(const rect& grid_area, float size)
+{
+	area = grid_area;
+	cell_size = size > 0.f ? size : 1.f;
+	columns = (int)ceilf(area.length / cell_size);
+	rows = (int)ceilf(area.height / cell_size);
+	columns = columns < 1 ? 1 : columns;
+	rows = rows < 1 ? 1 : rows;
+	cells.resize(columns * rows);
+	clear();
+}
+
+void SpatialGrid::clear()
+{
+	for (TaggedVector<int, MEMORY_PHYSICS>& cell : cells)
+	{
+		cell.clear();
+	}
+	bounds.clear();
+	query_marks.clear();
+}
+
+int SpatialGrid::cellX(float x) const
+{
+	int cell = (int)floorf((x - area.x) / cell_size);
+	return cell < 0 ? 0 : (cell >= columns ? columns - 1 : cell);
+}
+
+int SpatialGrid::cellY(float y) const
+{
+	int cell = (int)floorf((y - area.y) / cell_size);
+	return cell < 0 ? 0 : (cell >= rows ? rows - 1 : cell);
+}
+
+/**
+*   @brief   Insert
+*   @details Links the entry into every cell its bounds overlap.
+*   @return  int
+*/
+int SpatialGrid::insert(const rect& entry)
+{
+	int id = (int)bounds.size();
+	bounds.push_back(entry);
+	query_marks.push_back(query_stamp);
+
+	int min_x = cellX(entry.x);
+	int max_x = cellX(entry.x + entry.length);
+	int min_y = cellY(entry.y);
+	int max_y = cellY(entry.y + entry.height);
+	for (int y = min_y; y <= max_y; y++)
+	{
+		for (int x = min_x; x <= max_x; x++)
+		{
+			cells[y * columns + x].push_back(id);
+		}
+	}
+	return id;
+}
+
+void SpatialGrid::nextQuery()
+{
+	if (++query_stamp == 0)
+	{
+		// the stamp wrapped, so old marks could match again
+		for (unsigned int& mark : query_marks)
+		{
+			mark = 0;
+		}
+		query_stamp = 1;
+	}
+}
+
+/**
+*   @brief   Query
+*   @details Visits the cells under the area and reports each
+			 overlapping entry once. Entries are stamped with the
+			 query number instead of clearing a visited list.
+*   @return  void
+*/
+void SpatialGrid::query(const rect& search, std::vector<int>& results)
+{
+	nextQuery();
+	int min_x = cellX(search.x);
+	int max_x = cellX(search.x + search.length);
+	int min_y = cellY(search.y);
+	int max_y = cellY(search.y + search.height);
+	for (int y = min_y; y <= max_y; y++)
+	{
+		for (int x = min_x; x <= max_x; x++)
+		{
+			for (int id : cells[y * columns + x])
+			{
+				if (query_marks[id] != query_stamp)
+				{
+					query_marks[id] = query_stamp;
+					if (bounds[id].isInside(search))
+					{
+						results.push_back(id);
+					}
+				}
+			}
+		}
+	}
+}
+
+/**
+*   @brief   Query Circle
+*   @details Queries the square around the circle, then keeps the
+			 entries whose closest point lies within the radius.
+*   @return  void
+*/
+void SpatialGrid::queryCircle(float x, float y, float radius, std::vector<int>& results)
+{
+	rect search;
+	search.x = x - radius;
+	search.y = y - radius;
+	search.length = radius * 2.f;
+	search.height = radius * 2.f;
+
+	size_t first = results.size();
+	query(search, results);
+
+	size_t kept = first;
+	for (size_t i = first; i < results.size(); i++)
+	{
+		if (distanceTo(results[i], x, y) <= radius)
+		{
+			results[kept++] = results[i];
+		}
+	}
+	results.resize(kept);
+}
+
+/**
+*   @brief   Raycast
+*   @details Returns the closest hit along the ray.
+*   @return  bool
+*/
+bool SpatialGrid::raycast(float x, float y, float dir_x, float dir_y,
+	float max_distance, RayHit& hit, const RayFilter& accept)
+{
+	cast_hits.clear();
+	if (cast(x, y, dir_x, dir_y, max_distance, true, cast_hits, accept) == 0)
+	{
+		return false;
+	}
+	hit = cast_hits[0];
+	return true;
+}
+
+int SpatialGrid::raycastAll(float x, float y, float dir_x, float dir_y,
+	float max_distance, std::vector<RayHit>& hits, const RayFilter& accept)
+{
+	return cast(x, y, dir_x, dir_y, max_distance, false, hits, accept);
+}
+
+/**
+*   @brief   Segment Cast
+*   @details Casts a ray from the first point that stops at the second.
+*   @return  bool
+*/
+bool SpatialGrid::segmentCast(float x0, float y0, float x1, float y1,
+	RayHit& hit, const RayFilter& accept)
+{
+	float dir_x = x1 - x0;
+	float dir_y = y1 - y0;
+	return raycast(x0, y0, dir_x, dir_y, sqrtf(dir_x * dir_x + dir_y * dir_y), hit, accept);
+}
+
+int SpatialGrid::segmentCastAll(float x0, float y0, float x1, float y1,
+	std::vector<RayHit>& hits, const RayFilter& accept)
+{
+	float dir_x = x1 - x0;
+	float dir_y = y1 - y0;
+	return raycastAll(x0, y0, dir_x, dir_y, sqrtf(dir_x * dir_x + dir_y * dir_y), hits, accept);
+}
+
+/**
+*   @brief   Cast
+*   @details Clips the ray to the grid, then walks the cells it passes
+			 through in order using a DDA traversal. Each entry is
+			 tested once, however many cells it spans. When only the
+			 first hit is wanted the walk stops as soon as the best hit
+			 lies before the far side of the current cell, as no later
+			 cell can hold anything closer.
+*   @return  int The number of hits added
+*/
+int SpatialGrid::cast(float x, float y, float dir_x, float dir_y, float max_distance,
+	bool first_only, std::vector<RayHit>& hits, const RayFilter& accept)
+{
+	float length = sqrtf(dir_x * dir_x + dir_y * dir_y);
+	if (length <= 0.f || max_distance < 0.f || bounds.empty())
+	{
+		return 0;
+	}
+	dir_x /= length;
+	dir_y /= length;
+
+	// clip the ray to the area covered by the grid
+	float origin[2] = { x, y };
+	float dir[2] = { dir_x, dir_y };
+	float lo[2] = { area.x, area.y };
+	float hi[2] = { area.x + area.length, area.y + area.height };
+	float t_enter = 0.f;
+	float t_exit = max_distance;
+	for (int axis = 0; axis < 2; axis++)
+	{
+		if (dir[axis] == 0.f)
+		{
+			if (origin[axis] < lo[axis] || origin[axis] > hi[axis])
+			{
+				return 0;
+			}
+			continue;
+		}
+		float t0 = (lo[axis] - origin[axis]) / dir[axis];
+		float t1 = (hi[axis] - origin[axis]) / dir[axis];
+		t_enter = fmaxf(t_enter, fminf(t0, t1));
+		t_exit = fminf(t_exit, fmaxf(t0, t1));
+	}
+	if (t_enter > t_exit)
+	{
+		return 0;
+	}
+
+	nextQuery();
+	int cell_x = cellX(x + dir_x * t_enter);
+	int cell_y = cellY(y + dir_y * t_enter);
+	int step_x = dir_x > 0.f ? 1 : -1;
+	int step_y = dir_y > 0.f ? 1 : -1;
+
+	// distance along the ray to the next cell edge on each axis
+	float next_x = FLT_MAX;
+	float next_y = FLT_MAX;
+	float delta_x = FLT_MAX;
+	float delta_y = FLT_MAX;
+	if (dir_x != 0.f)
+	{
+		float edge = area.x + (cell_x + (step_x > 0 ? 1 : 0)) * cell_size;
+		next_x = (edge - x) / dir_x;
+		delta_x = cell_size / fabsf(dir_x);
+	}
+	if (dir_y != 0.f)
+	{
+		float edge = area.y + (cell_y + (step_y > 0 ? 1 : 0)) * cell_size;
+		next_y = (edge - y) / dir_y;
+		delta_y = cell_size / fabsf(dir_y);
+	}
+
+	size_t first = hits.size();
+	while (true)
+	{
+		for (int id : cells[cell_y * columns + cell_x])
+		{
+			if (query_marks[id] == query_stamp)
+			{
+				continue;
+			}
+			query_marks[id] = query_stamp;
+
+			RayHit hit;
+			if (!intersect(id, x, y, dir_x, dir_y, max_distance, 0.f, 0.f, hit) ||
+				(accept && !accept(id)))
+			{
+				continue;
+			}
+
+			if (!first_only)
+			{
+				hits.push_back(hit);
+			}
+			else if (hits.size() == first)
+			{
+				hits.push_back(hit);
+			}
+			else if (hit.distance < hits[first].distance)
+			{
+				hits[first] = hit;
+			}
+		}
+
+		float cell_exit = fminf(next_x, next_y);
+		if ((first_only && hits.size() > first && hits[first].distance <= cell_exit) ||
+			cell_exit > t_exit)
+		{
+			break;
+		}
+
+		if (next_x < next_y)
+		{
+			cell_x += step_x;
+			next_x += delta_x;
+		}
+		else
+		{
+			cell_y += step_y;
+			next_y += delta_y;
+		}
+		if (cell_x < 0 || cell_x >= columns || cell_y < 0 || cell_y >= rows)
+		{
+			break;
+		}
+	}
+
+	std::sort(hits.begin() + first, hits.end(),
+		[](const RayHit& lhs, const RayHit& rhs) { return lhs.distance < rhs.distance; });
+	return (int)(hits.size() - first);
+}
+
+/**
+*   @brief   Sweep All
+*   @details Queries the area the box passes over, then slab tests the
+			 path of the box's corner against each entry grown by the
+			 box, which is where the box would first touch it.
+*   @return  int The number of hits added
+*/
+int SpatialGrid::sweepAll(const rect& box, float dx, float dy,
+	std::vector<RayHit>& hits, const RayFilter& accept)
+{
+	float length = sqrtf(dx * dx + dy * dy);
+	if (length <= 0.f || bounds.empty())
+	{
+		return 0;
+	}
+
+	rect swept;
+	swept.x = fminf(box.x, box.x + dx);
+	swept.y = fminf(box.y, box.y + dy);
+	swept.length = box.length + fabsf(dx);
+	swept.height = box.height + fabsf(dy);
+	sweep_ids.clear();
+	query(swept, sweep_ids);
+
+	size_t first = hits.size();
+	for (int id : sweep_ids)
+	{
+		RayHit hit;
+		if (intersect(id, box.x, box.y, dx / length, dy / length, length,
+				box.length, box.height, hit) &&
+			(!accept || accept(id)))
+		{
+			hits.push_back(hit);
+		}
+	}
+
+	std::sort(hits.begin() + first, hits.end(),
+		[](const RayHit& lhs, const RayHit& rhs) { return lhs.distance < rhs.distance; });
+	return (int)(hits.size() - first);
+}
+
+/**
+*   @brief   Intersect
+*   @details Slab test of the ray against a single entry, grown to the
+			 left and up by the size of a swept box. The normal comes
+			 from the axis the ray entered through last.
+*   @return  bool
+*/
+bool SpatialGrid::intersect(int id, float x, float y, float dir_x, float dir_y,
+	float max_distance, float grow_x, float grow_y, RayHit& hit) const
+{
+	const rect& entry = bounds[id];
+	float origin[2] = { x, y };
+	float dir[2] = { dir_x, dir_y };
+	float lo[2] = { entry.x - grow_x, entry.y - grow_y };
+	float hi[2] = { entry.x + entry.length, entry.y + entry.height };
+	float t_near = 0.f;
+	float t_far = max_distance;
+	int entry_axis = -1;
+	for (int axis = 0; axis < 2; axis++)
+	{
+		if (dir[axis] == 0.f)
+		{
+			if (origin[axis] < lo[axis] || origin[axis] > hi[axis])
+			{
+				return false;
+			}
+			continue;
+		}
+		float t0 = (lo[axis] - origin[axis]) / dir[axis];
+		float t1 = (hi[axis] - origin[axis]) / dir[axis];
+		if (fminf(t0, t1) > t_near)
+		{
+			t_near = fminf(t0, t1);
+			entry_axis = axis;
+		}
+		t_far = fminf(t_far, fmaxf(t0, t1));
+	}
+	if (t_near > t_far)
+	{
+		return false;
+	}
+
+	hit.id = id;
+	hit.distance = t_near;
+	hit.normal_x = entry_axis == 0 ? (dir_x > 0.f ? -1.f : 1.f) : 0.f;
+	hit.normal_y = entry_axis == 1 ? (dir_y > 0.f ? -1.f : 1.f) : 0.f;
+	return true;
+}
+
+/**
+*   @brief   Distance To
+*   @details Clamps the point to the entry to find its closest point.
+*   @return  float
+*/
+float SpatialGrid::distanceTo(int id, float x, float y) const
+{
+	const rect& entry = bounds[id];
+	float closest_x = fmaxf(entry.x, fminf(x, entry.x + entry.length));
+	float closest_y = fmaxf(entry.y, fminf(y, entry.y + entry.height));
+	float dx = x - closest_x;
+	float dy = y - closest_y;
+	return sqrtf(dx * dx + dy * dy);
+}
+
+const rect& SpatialGrid::getBounds(int id) const
+{
+	return bounds[id];
+}
+
+int SpatialGrid::size() const
+{
+	return (int)bounds.size();
+}
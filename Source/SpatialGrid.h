@@ -0,0 +1,165 @@
+#pragma once
+#include <functional>
+#include <vector>
+#include "MemoryTracker.h"
+#include "Rect.h"
+
+/**
+*  A hit reported by a ray or segment cast.
+*  The distance is measured from the start of the cast along its
+*  direction. The normal is the face of the entry that was hit, or
+*  zero if the cast started inside the entry.
+*/
+struct RayHit
+{
+	int id = -1;
+	float distance = 0;
+	float normal_x = 0;
+	float normal_y = 0;
+};
+
+/**
+*  Decides whether a cast may hit an entry, e.g. to skip entries
+*  whose objects were removed since the grid was built.
+*/
+using RayFilter = std::function<bool(int id)>;
+
+/**
+*  A uniform grid used as the broadphase for level queries.
+*  Entries are stored as rectangles and identified by the order
+*  they were inserted in, so callers can keep any per entry data
+*  in parallel arrays. Each entry is linked into every cell it
+*  overlaps. The grid is cheap to rebuild, so it is cleared and
+*  refilled whenever the objects in it move. Rays and segments are
+*  walked through the cells inside the grid area only.
+*/
+class SpatialGrid
+{
+public:
+	/**
+	*  Default constructor.
+	*/
+	SpatialGrid() = default;
+
+	/**
+	*  Sets the area covered by the grid and the size of its cells.
+	*  Entries outside of the area are clamped into the border cells.
+	*  @param [in] area The area covered by the grid
+	*  @param [in] cell_size The width and height of a single cell
+	*/
+	void setup(const rect& area, float cell_size);
+
+	/**
+	*  Removes all entries while keeping the allocated cells.
+	*/
+	void clear();
+
+	/**
+	*  Adds an entry to every cell that its bounds overlap.
+	*  @param [in] bounds The bounding box of the entry
+	*  @return the id of the entry
+	*/
+	int  insert(const rect& bounds);
+
+	/**
+	*  Finds every entry whose bounds overlap an area.
+	*  Each entry is reported once, even if it spans several cells.
+	*  @param [in] area The area to search
+	*  @param [out] results The ids of the overlapping entries
+	*/
+	void query(const rect& area, std::vector<int>& results);
+
+	/**
+	*  Finds every entry whose bounds overlap a circle.
+	*  @param [in] x The centre of the circle on the x axis
+	*  @param [in] y The centre of the circle on the y axis
+	*  @param [in] radius The radius of the circle
+	*  @param [out] results The ids of the overlapping entries
+	*/
+	void queryCircle(float x, float y, float radius, std::vector<int>& results);
+
+	/**
+	*  Finds the first entry along a ray. The cells under the ray are
+	*  walked in order, so the search stops at the first cell that
+	*  holds a hit closer than the far side of the cell.
+	*  @param [in] x The start of the ray on the x axis
+	*  @param [in] y The start of the ray on the y axis
+	*  @param [in] dir_x The direction of the ray on the x axis
+	*  @param [in] dir_y The direction of the ray on the y axis
+	*  @param [in] max_distance How far along the ray to search
+	*  @param [out] hit The closest hit, if any
+	*  @param [in] accept Optional filter for the entries that can be hit
+	*  @return true if the ray hit an entry
+	*/
+	bool raycast(float x, float y, float dir_x, float dir_y, float max_distance,
+		RayHit& hit, const RayFilter& accept = nullptr);
+
+	/**
+	*  Finds every entry along a ray.
+	*  @param [out] hits The hits, sorted from nearest to furthest
+	*  @return the number of hits added
+	*  @see raycast
+	*/
+	int  raycastAll(float x, float y, float dir_x, float dir_y, float max_distance,
+		std::vector<RayHit>& hits, const RayFilter& accept = nullptr);
+
+	/**
+	*  Finds the first entry on the line between two points.
+	*  @return true if the segment hit an entry
+	*  @see raycast
+	*/
+	bool segmentCast(float x0, float y0, float x1, float y1,
+		RayHit& hit, const RayFilter& accept = nullptr);
+
+	/**
+	*  Finds every entry on the line between two points.
+	*  @return the number of hits added
+	*  @see raycastAll
+	*/
+	int  segmentCastAll(float x0, float y0, float x1, float y1,
+		std::vector<RayHit>& hits, const RayFilter& accept = nullptr);
+
+	/**
+	*  Finds every entry a box touches while moving in a straight line.
+	*  Each entry is grown by the size of the box and tested against
+	*  the path of its top left corner, so nothing the box passes over
+	*  is missed, however thin.
+	*  @param [in] box The box at the start of the sweep
+	*  @param [in] dx How far the box moves on the x axis
+	*  @param [in] dy How far the box moves on the y axis
+	*  @param [out] hits The hits, sorted from nearest to furthest
+	*  @param [in] accept Optional filter for the entries that can be hit
+	*  @return the number of hits added
+	*/
+	int  sweepAll(const rect& box, float dx, float dy,
+		std::vector<RayHit>& hits, const RayFilter& accept = nullptr);
+
+	/**
+	*  Returns the distance from a point to the closest point of an entry.
+	*  @return zero if the point is inside the entry
+	*/
+	float distanceTo(int id, float x, float y) const;
+
+	const rect& getBounds(int id) const;
+	int size() const;
+
+private:
+	int  cellX(float x) const;
+	int  cellY(float y) const;
+	void nextQuery();
+	bool intersect(int id, float x, float y, float dir_x, float dir_y,
+		float max_distance, float grow_x, float grow_y, RayHit& hit) const;
+	int  cast(float x, float y, float dir_x, float dir_y, float max_distance,
+		bool first_only, std::vector<RayHit>& hits, const RayFilter& accept);
+
+	rect area;
+	float cell_size = 1.f;
+	int columns = 0;
+	int rows = 0;
+	TaggedVector<TaggedVector<int, MEMORY_PHYSICS>, MEMORY_PHYSICS> cells;
+	TaggedVector<rect, MEMORY_PHYSICS> bounds;
+	TaggedVector<unsigned int, MEMORY_PHYSICS> query_marks;
+	std::vector<RayHit> cast_hits;
+	std::vector<int> sweep_ids;
+	unsigned int query_stamp = 0;
+};
@@ -0,0 +1,24 @@
+#include "TextCache.h"
+
+const TextLayout& TextCache::text(int slot, const char* text)
+{
+	if (layouts[slot].set(text))
+	{
+		shape_count++;
+	}
+	return layouts[slot];
+}
+
+const TextLayout& TextCache::number(int slot, long value)
+{
+	if (layouts[slot].setNumber(value))
+	{
+		shape_count++;
+	}
+	return layouts[slot];
+}
+
+int TextCache::shapes() const
+{
+	return shape_count;
+}
@@ -0,0 +1,43 @@
+#pragma once
+#include "TextLayout.h"
+#include "Constants.h"
+
+/**
+*  Holds a text layout for every string the game draws.
+*  Each string has a fixed slot, so asking for the same text in the
+*  same slot every frame returns the layout shaped the first time.
+*  A slot is only reshaped when its content changes.
+*/
+class TextCache
+{
+public:
+	/**
+	*  Default constructor.
+	*/
+	TextCache() = default;
+
+	/**
+	*  Returns the layout of a slot holding some text.
+	*  @param [in] slot The slot the text is drawn from
+	*  @param [in] text The text the slot should hold
+	*  @return the layout of the slot
+	*/
+	const TextLayout& text(int slot, const char* text);
+
+	/**
+	*  Returns the layout of a slot holding a number.
+	*  @param [in] slot The slot the number is drawn from
+	*  @param [in] value The number the slot should hold
+	*  @return the layout of the slot
+	*/
+	const TextLayout& number(int slot, long value);
+
+	/**
+	*  @return the number of times any slot has been shaped
+	*/
+	int shapes() const;
+
+private:
+	TextLayout layouts[NUM_TEXT_SLOTS];
+	int shape_count = 0;
+};
@@ -0,0 +1,90 @@
+#include <stdio.h>
+#include "TextLayout.h"
+
+/**
+*   @brief   Set
+*   @details Compares against the current text in place, so setting
+			 the same text again costs a string compare.
+*   @return  bool
+*/
+bool TextLayout::set(const char* new_text)
+{
+	has_number = false;
+	if (text == new_text)
+	{
+		return false;
+	}
+	text = new_text;
+	shape();
+	return true;
+}
+
+bool TextLayout::setNumber(long value)
+{
+	if (has_number && number == value)
+	{
+		return false;
+	}
+
+	char digits[24];
+	snprintf(digits, sizeof(digits), "%ld", value);
+	set(digits);
+	has_number = true;
+	number = value;
+	return true;
+}
+
+/**
+*   @brief   Shape
+*   @details Walks the text once, placing a glyph for every visible
+			 character. Spaces and other characters without a glyph
+			 still take up a column.
+*   @return  void
+*/
+void TextLayout::shape()
+{
+	glyphs.clear();
+	columns = 0;
+	lines = 1;
+
+	int column = 0;
+	for (char c : text)
+	{
+		if (c == '\n')
+		{
+			column = 0;
+			lines++;
+			continue;
+		}
+		if (c > 32 && c < 127)
+		{
+			Glyph glyph;
+			glyph.column = (short)column;
+			glyph.line = (short)(lines - 1);
+			glyph.code = c;
+			glyphs.push_back(glyph);
+		}
+		column++;
+		columns = column > columns ? column : columns;
+	}
+}
+
+const TaggedString<MEMORY_UI>& TextLayout::getText() const
+{
+	return text;
+}
+
+const TaggedVector<Glyph, MEMORY_UI>& TextLayout::getGlyphs() const
+{
+	return glyphs;
+}
+
+int TextLayout::getColumns() const
+{
+	return columns;
+}
+
+int TextLayout::getLines() const
+{
+	return lines;
+}
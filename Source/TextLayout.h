@@ -0,0 +1,59 @@
+#pragma once
+#include "MemoryTracker.h"
+
+/**
+*  A character placed by a text layout.
+*  Positions are in character cells from the start of the first line,
+*  so backends scale them by the size of their own font.
+*/
+struct Glyph
+{
+	short column = 0;
+	short line = 0;
+	char  code = 0;
+};
+
+/**
+*  A string and the glyphs it was shaped into.
+*  The glyphs are only rebuilt when the content changes, so text that
+*  stays the same from one frame to the next is never shaped or
+*  allocated again. Numbers are compared by value and formatted without
+*  going through a temporary string.
+*/
+class TextLayout
+{
+public:
+	/**
+	*  Default constructor.
+	*/
+	TextLayout() = default;
+
+	/**
+	*  Sets the text, shaping it if it differs from the current text.
+	*  @param [in] text The null terminated text
+	*  @return true if the layout was rebuilt
+	*/
+	bool set(const char* text);
+
+	/**
+	*  Sets the text to a whole number.
+	*  @param [in] value The number to show
+	*  @return true if the layout was rebuilt
+	*/
+	bool setNumber(long value);
+
+	const TaggedString<MEMORY_UI>& getText() const;
+	const TaggedVector<Glyph, MEMORY_UI>& getGlyphs() const;
+	int getColumns() const;
+	int getLines() const;
+
+private:
+	void shape();
+
+	TaggedString<MEMORY_UI> text;
+	TaggedVector<Glyph, MEMORY_UI> glyphs;
+	int columns = 0;
+	int lines = 1;
+	long number = 0;
+	bool has_number = false;
+};
@@ -0,0 +1,84 @@
+#include <fstream>
+#include <iterator>
+#include <stdlib.h>
+#include "TextureAtlas.h"
+
+namespace
+{
+	/**
+	*  Returns the value of an attribute inside a single element.
+	*/
+	std::string attribute(const std::string& element, const std::string& name)
+	{
+		std::string key = " " + name + "=\"";
+		size_t start = element.find(key);
+		if (start == std::string::npos)
+		{
+			return std::string();
+		}
+		start += key.size();
+		size_t end = element.find('"', start);
+		return end == std::string::npos ? std::string() : element.substr(start, end - start);
+	}
+}
+
+/**
+*   @brief   Load
+*   @details Walks the elements in order. Each SubTexture belongs to
+			 the TextureAtlas element that came before it.
+*   @return  bool
+*/
+bool TextureAtlas::load(const std::string& file_name)
+{
+	std::ifstream file(file_name);
+	if (!file)
+	{
+		return false;
+	}
+	std::string xml((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+	size_t slash = file_name.find_last_of("/\\");
+	std::string directory = slash == std::string::npos ? "" : file_name.substr(0, slash + 1);
+
+	regions.clear();
+	std::string texture;
+	size_t pos = 0;
+	while ((pos = xml.find('<', pos)) != std::string::npos)
+	{
+		size_t end = xml.find('>', pos);
+		if (end == std::string::npos)
+		{
+			return false;
+		}
+		std::string element = xml.substr(pos, end - pos);
+		pos = end;
+
+		if (element.compare(0, 13, "<TextureAtlas") == 0 && element.size() > 13 &&
+			element[13] == ' ')
+		{
+			texture = directory + attribute(element, "imagePath");
+		}
+		else if (element.compare(0, 11, "<SubTexture") == 0)
+		{
+			std::string name = attribute(element, "name");
+			if (texture.empty() || name.empty())
+			{
+				return false;
+			}
+
+			AtlasRegion& region = regions[name];
+			region.texture = texture;
+			region.x = (float)atof(attribute(element, "x").c_str());
+			region.y = (float)atof(attribute(element, "y").c_str());
+			region.width = (float)atof(attribute(element, "width").c_str());
+			region.height = (float)atof(attribute(element, "height").c_str());
+		}
+	}
+	return !regions.empty();
+}
+
+const AtlasRegion* TextureAtlas::find(const std::string& name) const
+{
+	auto region = regions.find(name);
+	return region == regions.end() ? nullptr : &region->second;
+}
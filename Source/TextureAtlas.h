@@ -0,0 +1,49 @@
+#pragma once
+#include <string>
+#include <unordered_map>
+
+/**
+*  A named region of an atlas texture, in texture pixels.
+*/
+struct AtlasRegion
+{
+	std::string texture;
+	float x = 0;
+	float y = 0;
+	float width = 0;
+	float height = 0;
+};
+
+/**
+*  Index of the regions packed into one or more atlas textures.
+*  Reads the Kenney TextureAtlas xml written by the AtlasPacker tool.
+*  Regions are named after the image they were packed from, so sprites
+*  can be bound by name instead of loading a texture per file. Sprites
+*  drawing from the same atlas share a texture and batch together.
+*/
+class TextureAtlas
+{
+public:
+	/**
+	*  Default constructor.
+	*/
+	TextureAtlas() = default;
+
+	/**
+	*  Loads an atlas index. Texture paths are resolved relative to
+	*  the directory holding the index.
+	*  @param [in] file_name The path of the xml index
+	*  @return true if the index was read and holds at least one region
+	*/
+	bool load(const std::string& file_name);
+
+	/**
+	*  Looks up a region by name.
+	*  @param [in] name The file name of the packed image
+	*  @return the region, or nullptr if there is none with that name
+	*/
+	const AtlasRegion* find(const std::string& name) const;
+
+private:
+	std::unordered_map<std::string, AtlasRegion> regions;
+};
@@ -0,0 +1,372 @@
+#include <math.h>
+#include "Trajectory.h"
+
+/**
+*   @brief   Constructor.
+*   @details Launches the trajectory from the given position
+			 and velocity using the in game flight model.
+*/
+Trajectory::Trajectory(float x, float y, vector2 velocity)
+{
+	x_axis.position = x;
+	y_axis.position = y;
+	x_axis.velocity = velocity.getX();
+	y_axis.velocity = velocity.getY();
+}
+
+void Trajectory::setGravity(float x, float y)
+{
+	x_axis.gravity = x;
+	y_axis.gravity = y;
+}
+
+void Trajectory::setDrag(float x, float y)
+{
+	x_axis.drag = x;
+	y_axis.drag = y;
+}
+
+void Trajectory::setSpeedScale(float scale)
+{
+	speed_scale = scale;
+}
+
+/**
+*   @brief   Axis velocity
+*   @details Exact solution of dv/dt = g - k * v. With no drag the
+			 velocity grows linearly, otherwise it decays exponentially
+			 towards the terminal velocity g / k.
+*   @return  float
+*/
+float Trajectory::speed(const Axis& axis, float t) const
+{
+	if (axis.drag == 0.0f)
+	{
+		return axis.velocity + axis.gravity * t;
+	}
+
+	float terminal = axis.gravity / axis.drag;
+	return terminal + (axis.velocity - terminal) * expf(-axis.drag * t);
+}
+
+/**
+*   @brief   Axis offset
+*   @details Integral of the axis velocity from 0 to t. expm1 is used
+			 so that small drag values do not lose precision.
+*   @return  float
+*/
+float Trajectory::offset(const Axis& axis, float t) const
+{
+	if (axis.drag == 0.0f)
+	{
+		return (axis.velocity * t) + (0.5f * axis.gravity * t * t);
+	}
+
+	float terminal = axis.gravity / axis.drag;
+	return (terminal * t) +
+		((axis.velocity - terminal) * -expm1f(-axis.drag * t) / axis.drag);
+}
+
+/**
+*   @brief   Position at time
+*   @details Evaluates the closed-form position after t seconds.
+*   @return  vector2
+*/
+vector2 Trajectory::positionAt(float t) const
+{
+	vector2 position(x_axis.position + speed_scale * offset(x_axis, t),
+		y_axis.position + speed_scale * offset(y_axis, t));
+	return position;
+}
+
+/**
+*   @brief   Velocity at time
+*   @details Evaluates the closed-form velocity after t seconds.
+*   @return  vector2
+*/
+vector2 Trajectory::velocityAt(float t) const
+{
+	vector2 velocity(speed(x_axis, t), speed(y_axis, t));
+	return velocity;
+}
+
+/**
+*   @brief   Solve axis
+*   @details Finds the time in [a, b] at which the axis reaches the
+			 target position. The axis must be monotonic over the range.
+			 Drag free and gravity free axes are inverted analytically,
+			 the general case falls back to bisection.
+*   @return  float
+*/
+float Trajectory::solve(const Axis& axis, float a, float b, float target) const
+{
+	float distance = (target - axis.position) / speed_scale;
+
+	if (axis.drag == 0.0f)
+	{
+		if (axis.gravity == 0.0f)
+		{
+			if (axis.velocity != 0.0f)
+			{
+				float t = distance / axis.velocity;
+				return t < a ? a : (t > b ? b : t);
+			}
+			return a;
+		}
+
+		// 0.5g t^2 + v t - d = 0, using the numerically stable form
+		float half_g = 0.5f * axis.gravity;
+		float disc = axis.velocity * axis.velocity + 4.f * half_g * distance;
+		if (disc >= 0.0f)
+		{
+			float q = -0.5f * (axis.velocity +
+				(axis.velocity >= 0.0f ? sqrtf(disc) : -sqrtf(disc)));
+			float roots[2] = { q / half_g, q != 0.0f ? -distance / q : 0.0f };
+			float tolerance = (b - a) * 1e-4f + 1e-6f;
+			for (int i = 0; i < 2; i++)
+			{
+				if (roots[i] >= a - tolerance && roots[i] <= b + tolerance)
+				{
+					return roots[i] < a ? a : (roots[i] > b ? b : roots[i]);
+				}
+			}
+		}
+	}
+	else if (axis.gravity == 0.0f && axis.velocity != 0.0f)
+	{
+		// d = v (1 - e^-kt) / k
+		float arg = -axis.drag * distance / axis.velocity;
+		if (arg > -1.0f)
+		{
+			float t = -log1pf(arg) / axis.drag;
+			return t < a ? a : (t > b ? b : t);
+		}
+		return b;
+	}
+
+	// general case, the axis is monotonic over [a, b]
+	bool increasing = offset(axis, b) >= offset(axis, a);
+	for (int i = 0; i < 48 && (b - a) > 1e-6f; i++)
+	{
+		float mid = 0.5f * (a + b);
+		bool below = offset(axis, mid) < distance;
+		if (below == increasing)
+		{
+			a = mid;
+		}
+		else
+		{
+			b = mid;
+		}
+	}
+	return 0.5f * (a + b);
+}
+
+/**
+*   @brief   Overlap intervals
+*   @details Collects the time ranges within [0, max_time] where the
+			 axis position lies inside [lo, hi]. The velocity along an
+			 axis changes sign at most once, so the position has at most
+			 one turning point and there are at most two ranges.
+*   @return  int The number of ranges written to intervals
+*/
+int Trajectory::overlapIntervals(const Axis& axis, float lo, float hi,
+	float max_time, float intervals[4]) const
+{
+	float turning_point = -1.0f;
+	if (axis.drag == 0.0f)
+	{
+		if (axis.gravity != 0.0f)
+		{
+			turning_point = -axis.velocity / axis.gravity;
+		}
+	}
+	else
+	{
+		float terminal = axis.gravity / axis.drag;
+		if (terminal != axis.velocity)
+		{
+			float ratio = terminal / (terminal - axis.velocity);
+			if (ratio > 0.0f && ratio <= 1.0f)
+			{
+				turning_point = -logf(ratio) / axis.drag;
+			}
+		}
+	}
+
+	float bounds[3] = { 0.0f, max_time, max_time };
+	int pieces = 1;
+	if (turning_point > 0.0f && turning_point < max_time)
+	{
+		bounds[1] = turning_point;
+		pieces = 2;
+	}
+
+	int count = 0;
+	for (int i = 0; i < pieces; i++)
+	{
+		float a = bounds[i];
+		float b = bounds[i + 1];
+		float pos_a = axis.position + speed_scale * offset(axis, a);
+		float pos_b = axis.position + speed_scale * offset(axis, b);
+		bool increasing = pos_b >= pos_a;
+		float enter = fmaxf(lo, increasing ? pos_a : pos_b);
+		float exit = fminf(hi, increasing ? pos_b : pos_a);
+		if (enter > exit)
+		{
+			continue;
+		}
+
+		// values touching the ends of the piece are exact
+		float first = increasing ? enter : exit;
+		float last = increasing ? exit : enter;
+		float t_enter = first == pos_a ? a : solve(axis, a, b, first);
+		float t_exit = last == pos_b ? b : solve(axis, a, b, last);
+		intervals[count * 2] = fminf(t_enter, t_exit);
+		intervals[count * 2 + 1] = fmaxf(t_enter, t_exit);
+		count++;
+	}
+	return count;
+}
+
+/**
+*   @brief   Time of impact
+*   @details Intersects the times at which the moving box overlaps
+			 the target on each axis and returns the earliest. Uses the
+			 same inclusive overlap test as rect::isInside.
+*   @return  bool
+*/
+bool Trajectory::timeOfImpact(float width, float height, const rect& target,
+	float max_time, float& toi) const
+{
+	if (max_time < 0.0f)
+	{
+		return false;
+	}
+
+	float x_ranges[4];
+	float y_ranges[4];
+	int x_count = overlapIntervals(x_axis, target.x - width,
+		target.x + target.length, max_time, x_ranges);
+	int y_count = overlapIntervals(y_axis, target.y - height,
+		target.y + target.height, max_time, y_ranges);
+
+	bool hit = false;
+	for (int i = 0; i < x_count; i++)
+	{
+		for (int j = 0; j < y_count; j++)
+		{
+			float start = fmaxf(x_ranges[i * 2], y_ranges[j * 2]);
+			float end = fminf(x_ranges[i * 2 + 1], y_ranges[j * 2 + 1]);
+			if (start <= end && (!hit || start < toi))
+			{
+				toi = start;
+				hit = true;
+			}
+		}
+	}
+	return hit;
+}
+
+/**
+*   @brief   Step coefficients
+*   @details The flight model is linear in the launch velocity, so the
+			 coefficients are recovered by superposition of a body at
+			 rest and a body launched with unit velocity.
+*   @return  void
+*/
+void Trajectory::stepCoefficients(float dt, vector2& a, vector2& b,
+	vector2& c, vector2& e)
+{
+	Trajectory rest(0.f, 0.f, vector2(0.f, 0.f));
+	Trajectory unit(0.f, 0.f, vector2(1.f, 1.f));
+	b = rest.positionAt(dt);
+	c = rest.velocityAt(dt);
+	a = unit.positionAt(dt).subtract(b);
+	e = unit.velocityAt(dt).subtract(c);
+}
+
+namespace
+{
+	const int STEP_BITS = FixedFlightStep::COEFFICIENT_BITS;
+	const int64_t STEP_ONE = (int64_t)1 << STEP_BITS;
+
+	int64_t toStep(float value)
+	{
+		// exact in a double, as in Fixed::fromFloat
+		double scaled = (double)value * STEP_ONE;
+		return (int64_t)(scaled >= 0 ? scaled + 0.5 : scaled - 0.5);
+	}
+
+	int64_t multiplyStep(int64_t a, int64_t b)
+	{
+		return (a * b + (STEP_ONE / 2)) >> STEP_BITS;
+	}
+
+	/**
+	*  Sums (-x)^n / (n + first)! over n, with the term for n = 0
+	*  given. Stops once the terms round to zero.
+	*/
+	int64_t series(int64_t x, int64_t first_term, int first)
+	{
+		int64_t sum = first_term;
+		int64_t term = first_term;
+		for (int n = 1; n < 32 && term != 0; n++)
+		{
+			term = -multiplyStep(term, x) / (n + first);
+			sum += term;
+		}
+		return sum;
+	}
+
+	/**
+	*  Solves one axis of the step. With x = drag * dt,
+	*  phi = (1 - e^-x) / x and psi = (1 - phi) / x, the exact step is
+	*  a = s dt phi, b = s g dt^2 psi, c = g dt phi and e = 1 - x phi.
+	*  Both series are well behaved as the drag goes to zero, where
+	*  they give the drag free step.
+	*/
+	void solveAxis(float dt, float gravity, float drag, float speed_scale,
+		int64_t& a, int64_t& b, int64_t& c, int64_t& e)
+	{
+		int64_t step = toStep(dt);
+		int64_t g = toStep(gravity);
+		int64_t s = toStep(speed_scale);
+		int64_t x = multiplyStep(toStep(drag), step);
+
+		int64_t phi = series(x, STEP_ONE, 1);
+		int64_t psi = series(x, STEP_ONE / 2, 2);
+		int64_t step_phi = multiplyStep(step, phi);
+		a = multiplyStep(s, step_phi);
+		b = multiplyStep(multiplyStep(multiplyStep(s, g), multiplyStep(step, step)), psi);
+		c = multiplyStep(g, step_phi);
+		e = STEP_ONE - multiplyStep(x, phi);
+	}
+
+	/**
+	*  scale * value + offset, rounded to 16.16. The product carries
+	*  the fraction bits of both, so the offset is lined up with it.
+	*/
+	Fixed affine(int64_t scale, Fixed value, int64_t offset)
+	{
+		const int64_t half = (int64_t)1 << (STEP_BITS - 1);
+		int64_t sum = scale * value.getRaw() + (offset << Fixed::FRACTION_BITS) + half;
+		return Fixed::fromRaw((int32_t)(sum >> STEP_BITS));
+	}
+}
+
+FixedFlightStep::FixedFlightStep(float dt)
+{
+	solveAxis(dt, 0.f, FLIGHT_DRAG, FLIGHT_SPEED_SCALE, ax, bx, cx, ex);
+	solveAxis(dt, FLIGHT_GRAVITY, 0.f, FLIGHT_SPEED_SCALE, ay, by, cy, ey);
+}
+
+void FixedFlightStep::apply(float& x, float& y, float& vel_x, float& vel_y) const
+{
+	Fixed velocity_x = Fixed::fromFloat(vel_x);
+	Fixed velocity_y = Fixed::fromFloat(vel_y);
+	x = (Fixed::fromFloat(x) + affine(ax, velocity_x, bx)).toFloat();
+	y = (Fixed::fromFloat(y) + affine(ay, velocity_y, by)).toFloat();
+	vel_x = affine(ex, velocity_x, cx).toFloat();
+	vel_y = affine(ey, velocity_y, cy).toFloat();
+}
@@ -1,33 +1,108 @@
 #pragma once
+#include <type_traits>
+
+/**
+*  A two dimensional vector.
+*  Plain value type, trivially copyable so arrays of it can be copied
+*  and walked like floats. Everything that does not need a square root
+*  is constexpr.
+*  @see Vector2Batch.h for operations over arrays of vectors
+*/
 class vector2
 {
 public:
 	// construction
-	vector2();
-	vector2(float xval, float yval);
-	vector2(const vector2& rhs);
+	constexpr vector2() noexcept = default;
+	constexpr vector2(float xval, float yval) noexcept : x(xval), y(yval) {}
+
+	// access
+	constexpr float getX() const noexcept { return x; }
+	constexpr float getY() const noexcept { return y; }
+	constexpr void setX(float newX) noexcept { x = newX; }
+	constexpr void setY(float newY) noexcept { y = newY; }
+
+	// operations
+	constexpr vector2 add(vector2 a) const noexcept
+	{
+		return vector2(x + a.x, y + a.y);
+	}
+
+	constexpr vector2 subtract(vector2 a) const noexcept
+	{
+		return vector2(x - a.x, y - a.y);
+	}
+
+	constexpr vector2 multiply(float scalar) const noexcept
+	{
+		return vector2(x * scalar, y * scalar);
+	}
+
 	/**
-	*  Destructor.
+	*  @return the dot product of the two vectors
 	*/
-	~vector2();
+	constexpr float getScalar(vector2 a) const noexcept
+	{
+		return (x * a.x) + (y * a.y);
+	}
 
-	// operations
-	vector2 operator*(float scalar);
-	vector2 normalise();
-	float getX();
-	float getY();
-	void setX(float newX);
-	void setY(float newY);
-	vector2 add(vector2 a);
-	vector2 subtract(vector2 a);
-	float getDistance(vector2 a);
-	float getMagnitude();
-	vector2 multiply(float scalar);
-	float getScalar(vector2 a);
+	/**
+	*  @return the squared length, cheaper when only comparing lengths
+	*/
+	constexpr float getMagnitudeSquared() const noexcept
+	{
+		return (x * x) + (y * y);
+	}
+
+	float getMagnitude() const noexcept;
+	float getDistance(vector2 a) const noexcept;
+
+	/**
+	*  @return the unit vector in the same direction, or zero
+	*/
+	vector2 normalise() const noexcept;
+
+	constexpr vector2 operator+(vector2 a) const noexcept { return add(a); }
+	constexpr vector2 operator-(vector2 a) const noexcept { return subtract(a); }
+	constexpr vector2 operator-() const noexcept { return vector2(-x, -y); }
+	constexpr vector2 operator*(float scalar) const noexcept { return multiply(scalar); }
+
+	constexpr vector2& operator+=(vector2 a) noexcept
+	{
+		x += a.x;
+		y += a.y;
+		return *this;
+	}
+
+	constexpr vector2& operator-=(vector2 a) noexcept
+	{
+		x -= a.x;
+		y -= a.y;
+		return *this;
+	}
+
+	constexpr vector2& operator*=(float scalar) noexcept
+	{
+		x *= scalar;
+		y *= scalar;
+		return *this;
+	}
+
+	constexpr bool operator==(vector2 a) const noexcept { return x == a.x && y == a.y; }
+	constexpr bool operator!=(vector2 a) const noexcept { return !(*this == a); }
 
 private:
 
 	// data
 	float x = 0;
 	float y = 0;
-};
\ No newline at end of file
+};
+
+constexpr vector2 operator*(float scalar, vector2 a) noexcept
+{
+	return a.multiply(scalar);
+}
+
+static_assert(std::is_trivially_copyable<vector2>::value,
+	"vector2 is copied as raw floats by the batch kernels");
+static_assert(sizeof(vector2) == 2 * sizeof(float),
+	"vector2 is read as pairs of floats by the batch kernels");
@@ -0,0 +1,168 @@
+#include "Vector2Batch.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define VECTOR_SIMD
+#include <emmintrin.h>
+#endif
+
+#if defined(VECTOR_SIMD) && defined(__AVX__)
+#define VECTOR_AVX
+#include <immintrin.h>
+#endif
+
+namespace
+{
+	// vector2 is two packed floats, so the arrays are walked as floats
+	const float* floats(const vector2* vectors)
+	{
+		return reinterpret_cast<const float*>(vectors);
+	}
+
+	float* floats(vector2* vectors)
+	{
+		return reinterpret_cast<float*>(vectors);
+	}
+
+#ifdef VECTOR_SIMD
+	/**
+	*  Squared lengths of two vectors held as x y x y, each written to
+	*  both of the vector's lanes.
+	*/
+	__m128 pairSquares(__m128 vectors)
+	{
+		__m128 squares = _mm_mul_ps(vectors, vectors);
+		return _mm_add_ps(squares, _mm_shuffle_ps(squares, squares, _MM_SHUFFLE(2, 3, 0, 1)));
+	}
+
+	/**
+	*  Divides two vectors by their lengths, leaving zero vectors zero.
+	*/
+	__m128 pairNormalise(__m128 vectors)
+	{
+		__m128 lengths = _mm_sqrt_ps(pairSquares(vectors));
+		__m128 nonzero = _mm_cmpneq_ps(lengths, _mm_setzero_ps());
+		return _mm_and_ps(_mm_div_ps(vectors, lengths), nonzero);
+	}
+#endif
+
+#ifdef VECTOR_AVX
+	__m256 quadSquares(__m256 vectors)
+	{
+		__m256 squares = _mm256_mul_ps(vectors, vectors);
+		return _mm256_add_ps(squares, _mm256_permute_ps(squares, _MM_SHUFFLE(2, 3, 0, 1)));
+	}
+#endif
+}
+
+void addVectors(const vector2* a, const vector2* b, vector2* out, int count)
+{
+	const float* lhs = floats(a);
+	const float* rhs = floats(b);
+	float* result = floats(out);
+	int num_floats = count * 2;
+	int i = 0;
+#ifdef VECTOR_AVX
+	for (; i + 8 <= num_floats; i += 8)
+	{
+		_mm256_storeu_ps(&result[i], _mm256_add_ps(
+			_mm256_loadu_ps(&lhs[i]), _mm256_loadu_ps(&rhs[i])));
+	}
+#endif
+#ifdef VECTOR_SIMD
+	for (; i + 4 <= num_floats; i += 4)
+	{
+		_mm_storeu_ps(&result[i], _mm_add_ps(_mm_loadu_ps(&lhs[i]), _mm_loadu_ps(&rhs[i])));
+	}
+#endif
+	for (; i < num_floats; i++)
+	{
+		result[i] = lhs[i] + rhs[i];
+	}
+}
+
+void scaleVectors(const vector2* in, float scalar, vector2* out, int count)
+{
+	const float* source = floats(in);
+	float* result = floats(out);
+	int num_floats = count * 2;
+	int i = 0;
+#ifdef VECTOR_AVX
+	__m256 wide_scale = _mm256_set1_ps(scalar);
+	for (; i + 8 <= num_floats; i += 8)
+	{
+		_mm256_storeu_ps(&result[i], _mm256_mul_ps(_mm256_loadu_ps(&source[i]), wide_scale));
+	}
+#endif
+#ifdef VECTOR_SIMD
+	__m128 simd_scale = _mm_set1_ps(scalar);
+	for (; i + 4 <= num_floats; i += 4)
+	{
+		_mm_storeu_ps(&result[i], _mm_mul_ps(_mm_loadu_ps(&source[i]), simd_scale));
+	}
+#endif
+	for (; i < num_floats; i++)
+	{
+		result[i] = source[i] * scalar;
+	}
+}
+
+/**
+*   @brief   Vector Lengths
+*   @details Squares and sums the components of four vectors at once,
+			 then gathers one sum per vector before the square root.
+*   @return  void
+*/
+void vectorLengths(const vector2* in, float* out, int count)
+{
+	const float* source = floats(in);
+	int i = 0;
+#ifdef VECTOR_AVX
+	for (; i + 4 <= count; i += 4)
+	{
+		__m256 sums = quadSquares(_mm256_loadu_ps(&source[i * 2]));
+		__m128 gathered = _mm_shuffle_ps(_mm256_castps256_ps128(sums),
+			_mm256_extractf128_ps(sums, 1), _MM_SHUFFLE(2, 0, 2, 0));
+		_mm_storeu_ps(&out[i], _mm_sqrt_ps(gathered));
+	}
+#endif
+#ifdef VECTOR_SIMD
+	for (; i + 4 <= count; i += 4)
+	{
+		__m128 low = pairSquares(_mm_loadu_ps(&source[i * 2]));
+		__m128 high = pairSquares(_mm_loadu_ps(&source[i * 2 + 4]));
+		__m128 gathered = _mm_shuffle_ps(low, high, _MM_SHUFFLE(2, 0, 2, 0));
+		_mm_storeu_ps(&out[i], _mm_sqrt_ps(gathered));
+	}
+#endif
+	for (; i < count; i++)
+	{
+		out[i] = in[i].getMagnitude();
+	}
+}
+
+void normaliseVectors(const vector2* in, vector2* out, int count)
+{
+	const float* source = floats(in);
+	float* result = floats(out);
+	int i = 0;
+#ifdef VECTOR_AVX
+	for (; i + 4 <= count; i += 4)
+	{
+		__m256 vectors = _mm256_loadu_ps(&source[i * 2]);
+		__m256 lengths = _mm256_sqrt_ps(quadSquares(vectors));
+		__m256 nonzero = _mm256_cmp_ps(lengths, _mm256_setzero_ps(), _CMP_NEQ_UQ);
+		_mm256_storeu_ps(&result[i * 2],
+			_mm256_and_ps(_mm256_div_ps(vectors, lengths), nonzero));
+	}
+#endif
+#ifdef VECTOR_SIMD
+	for (; i + 2 <= count; i += 2)
+	{
+		_mm_storeu_ps(&result[i * 2], pairNormalise(_mm_loadu_ps(&source[i * 2])));
+	}
+#endif
+	for (; i < count; i++)
+	{
+		out[i] = in[i].normalise();
+	}
+}
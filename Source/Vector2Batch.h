@@ -0,0 +1,45 @@
+#pragma once
+#include "Vector2.h"
+
+/*! \file Vector2Batch.h
+@brief   Operations over arrays of vectors.
+@details Each kernel works on count vectors and gives the same result,
+		 bit for bit, as calling the vector2 method on each element.
+		 SSE2 is used where it is available and AVX when the build
+		 enables it. The output may be the same array as an input.
+*/
+
+/**
+*  Adds two arrays of vectors element by element.
+*  @param [in] a The first array
+*  @param [in] b The second array
+*  @param [out] out The sums
+*  @param [in] count The number of vectors
+*/
+void addVectors(const vector2* a, const vector2* b, vector2* out, int count);
+
+/**
+*  Scales an array of vectors.
+*  @param [in] in The vectors to scale
+*  @param [in] scalar The scale to apply
+*  @param [out] out The scaled vectors
+*  @param [in] count The number of vectors
+*/
+void scaleVectors(const vector2* in, float scalar, vector2* out, int count);
+
+/**
+*  Finds the length of each vector in an array.
+*  @param [in] in The vectors to measure
+*  @param [out] out The length of each vector
+*  @param [in] count The number of vectors
+*/
+void vectorLengths(const vector2* in, float* out, int count);
+
+/**
+*  Turns each vector in an array into a unit vector.
+*  Zero vectors stay zero, as with vector2::normalise.
+*  @param [in] in The vectors to normalise
+*  @param [out] out The unit vectors
+*  @param [in] count The number of vectors
+*/
+void normaliseVectors(const vector2* in, vector2* out, int count);
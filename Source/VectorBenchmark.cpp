@@ -0,0 +1,189 @@
+#include "VectorBenchmark.h"
+#include <chrono>
+#include <ostream>
+#include <string.h>
+#include <vector>
+#include "Vector2.h"
+#include "Vector2Batch.h"
+
+namespace
+{
+	const int MAX_CHECK_COUNT = 37;
+	const int BENCH_COUNT = 4096;
+	const int BENCH_PASSES = 500;
+	const float SCALE = -1.75f;
+
+	using Clock = std::chrono::high_resolution_clock;
+
+	/**
+	*  Fills an array with vectors from a fixed seed. Every seventh is
+	*  one of the edge cases: zero, signed zero, tiny enough that its
+	*  square underflows, denormal, or huge enough that it overflows.
+	*/
+	void fill(std::vector<vector2>& vectors, unsigned int seed)
+	{
+		const vector2 edges[] =
+		{
+			vector2(0.f, 0.f), vector2(-0.f, 0.f), vector2(1e-30f, -1e-30f),
+			vector2(3e-39f, 0.f), vector2(1e30f, -1e30f), vector2(-3.f, 4.f)
+		};
+		const int num_edges = sizeof(edges) / sizeof(edges[0]);
+		for (size_t i = 0; i < vectors.size(); i++)
+		{
+			seed = seed * 1664525u + 1013904223u;
+			float x = ((int)(seed >> 8) - (1 << 23)) / 4096.f;
+			seed = seed * 1664525u + 1013904223u;
+			float y = ((int)(seed >> 8) - (1 << 23)) / 4096.f;
+			vectors[i] = i % 7 == 3 ? edges[(i / 7) % num_edges] : vector2(x, y);
+		}
+	}
+
+	template <typename T>
+	bool same(const std::vector<T>& lhs, const std::vector<T>& rhs)
+	{
+		return lhs.empty() || memcmp(lhs.data(), rhs.data(), lhs.size() * sizeof(T)) == 0;
+	}
+
+	/**
+	*  Runs every kernel on count vectors, into another array and in
+	*  place, and compares the results with the scalar methods.
+	*/
+	bool checkCount(int count, std::ostream& out)
+	{
+		std::vector<vector2> a(count);
+		std::vector<vector2> b(count);
+		std::vector<vector2> expected(count);
+		std::vector<vector2> result(count);
+		std::vector<float> expected_lengths(count);
+		std::vector<float> lengths(count);
+		fill(a, count * 2 + 1);
+		fill(b, count * 2 + 2);
+
+		bool passed = true;
+		auto report = [&](const char* kernel, bool matched)
+		{
+			if (!matched)
+			{
+				out << kernel << " differs for " << count << " vectors\n";
+				passed = false;
+			}
+		};
+
+		for (int i = 0; i < count; i++)
+		{
+			expected[i] = a[i] + b[i];
+		}
+		addVectors(a.data(), b.data(), result.data(), count);
+		report("addVectors", same(result, expected));
+		result = a;
+		addVectors(result.data(), b.data(), result.data(), count);
+		report("addVectors in place", same(result, expected));
+
+		for (int i = 0; i < count; i++)
+		{
+			expected[i] = a[i] * SCALE;
+		}
+		scaleVectors(a.data(), SCALE, result.data(), count);
+		report("scaleVectors", same(result, expected));
+		result = a;
+		scaleVectors(result.data(), SCALE, result.data(), count);
+		report("scaleVectors in place", same(result, expected));
+
+		for (int i = 0; i < count; i++)
+		{
+			expected_lengths[i] = a[i].getMagnitude();
+		}
+		vectorLengths(a.data(), lengths.data(), count);
+		report("vectorLengths", same(lengths, expected_lengths));
+
+		for (int i = 0; i < count; i++)
+		{
+			expected[i] = a[i].normalise();
+		}
+		normaliseVectors(a.data(), result.data(), count);
+		report("normaliseVectors", same(result, expected));
+		result = a;
+		normaliseVectors(result.data(), result.data(), count);
+		report("normaliseVectors in place", same(result, expected));
+		return passed;
+	}
+
+	/**
+	*  Times a pass over the benchmark arrays, in nanoseconds a vector.
+	*/
+	template <typename Pass>
+	double timePass(Pass pass)
+	{
+		Clock::time_point start = Clock::now();
+		for (int i = 0; i < BENCH_PASSES; i++)
+		{
+			pass();
+		}
+		std::chrono::duration<double, std::nano> elapsed = Clock::now() - start;
+		return elapsed.count() / ((double)BENCH_PASSES * BENCH_COUNT);
+	}
+
+	void writeTimes(std::ostream& out, const char* kernel, double scalar_ns, double batch_ns)
+	{
+		out << kernel << ": scalar " << scalar_ns << " ns, batch " << batch_ns <<
+			" ns a vector, " << scalar_ns / batch_ns << "x\n";
+	}
+}
+
+/**
+*   @brief   Benchmark Vectors
+*   @details Checks every count up to MAX_CHECK_COUNT, so each SIMD
+			 path and its scalar tail are covered, then times every
+			 kernel on arrays too large to stay in registers.
+*   @return  bool
+*/
+bool benchmarkVectors(std::ostream& out)
+{
+	bool passed = true;
+	for (int count = 0; count <= MAX_CHECK_COUNT; count++)
+	{
+		passed = checkCount(count, out) && passed;
+	}
+	out << (passed ? "every kernel matches the scalar methods\n" :
+		"the kernels above do NOT match the scalar methods\n");
+
+	std::vector<vector2> a(BENCH_COUNT);
+	std::vector<vector2> b(BENCH_COUNT);
+	std::vector<vector2> result(BENCH_COUNT);
+	std::vector<float> lengths(BENCH_COUNT);
+	fill(a, 1);
+	fill(b, 2);
+
+	writeTimes(out, "add", timePass([&]()
+	{
+		for (int i = 0; i < BENCH_COUNT; i++)
+		{
+			result[i] = a[i] + b[i];
+		}
+	}), timePass([&]() { addVectors(a.data(), b.data(), result.data(), BENCH_COUNT); }));
+
+	writeTimes(out, "scale", timePass([&]()
+	{
+		for (int i = 0; i < BENCH_COUNT; i++)
+		{
+			result[i] = a[i] * SCALE;
+		}
+	}), timePass([&]() { scaleVectors(a.data(), SCALE, result.data(), BENCH_COUNT); }));
+
+	writeTimes(out, "length", timePass([&]()
+	{
+		for (int i = 0; i < BENCH_COUNT; i++)
+		{
+			lengths[i] = a[i].getMagnitude();
+		}
+	}), timePass([&]() { vectorLengths(a.data(), lengths.data(), BENCH_COUNT); }));
+
+	writeTimes(out, "normalise", timePass([&]()
+	{
+		for (int i = 0; i < BENCH_COUNT; i++)
+		{
+			result[i] = a[i].normalise();
+		}
+	}), timePass([&]() { normaliseVectors(a.data(), result.data(), BENCH_COUNT); }));
+	return passed;
+}
@@ -0,0 +1,20 @@
+#pragma once
+#include <iosfwd>
+
+/*! \file VectorBenchmark.h
+@brief   Property check and microbenchmark of the vector batch kernels.
+@details Run by starting the game with --benchmark-vectors, which writes
+		 the results to Vector_benchmark.txt instead of playing. Every
+		 kernel is checked bit for bit against the vector2 method it
+		 replaces, for every count up to a few SIMD widths and for zero,
+		 tiny and huge vectors, in place as well as into another array.
+		 Each kernel is then timed against the same method called once
+		 per element.
+*/
+
+/**
+*  Checks the batch kernels against the scalar methods and times both.
+*  @param [in] out The stream to write the results to
+*  @return false if any kernel gave a different result
+*/
+bool benchmarkVectors(std::ostream& out);
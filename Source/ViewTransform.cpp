@@ -0,0 +1,49 @@
+#include "ViewTransform.h"
+
+/**
+*   @brief   Fit
+*   @details Uses the smaller of the two axis scales so the whole
+			 world is on screen, then centres it on the other axis.
+*   @return  void
+*/
+void ViewTransform::fit(float screen_width, float screen_height,
+	float world_width, float world_height)
+{
+	float scale_x = screen_width / world_width;
+	float scale_y = screen_height / world_height;
+	scale = scale_x < scale_y ? scale_x : scale_y;
+	x = (screen_width - world_width * scale) * 0.5f;
+	y = (screen_height - world_height * scale) * 0.5f;
+}
+
+DrawCommand ViewTransform::apply(const DrawCommand& command) const
+{
+	DrawCommand placed = command;
+	placed.x = x + command.x * scale;
+	placed.y = y + command.y * scale;
+	if (command.type == DRAW_TEXT)
+	{
+		placed.scale = command.scale * scale;
+	}
+	else
+	{
+		placed.width = command.width * scale;
+		placed.height = command.height * scale;
+	}
+	return placed;
+}
+
+float ViewTransform::toWorldX(float screen_x) const
+{
+	return (screen_x - x) / scale;
+}
+
+float ViewTransform::toWorldY(float screen_y) const
+{
+	return (screen_y - y) / scale;
+}
+
+bool ViewTransform::matches(const ViewTransform& rhs) const
+{
+	return scale == rhs.scale && x == rhs.x && y == rhs.y;
+}
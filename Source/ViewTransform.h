@@ -0,0 +1,37 @@
+#pragma once
+#include "DrawCommand.h"
+
+/**
+*  Maps the fixed world units the game is simulated in onto the screen.
+*  The world is scaled evenly to fit the screen and centred, so screens
+*  of another aspect ratio are framed with bars rather than stretched.
+*  Positions are scaled and offset, sizes are only scaled.
+*/
+struct ViewTransform
+{
+	/**
+	*  Fits the world inside the screen.
+	*  @param [in] screen_width The width of the screen in pixels
+	*  @param [in] screen_height The height of the screen in pixels
+	*  @param [in] world_width The width of the world in world units
+	*  @param [in] world_height The height of the world in world units
+	*/
+	void fit(float screen_width, float screen_height,
+		float world_width, float world_height);
+
+	/**
+	*  Moves a recorded command from world units onto the screen.
+	*  Text keeps its layout size in character cells and is scaled.
+	*  @param [in] command The command in world units
+	*  @return the command in screen pixels
+	*/
+	DrawCommand apply(const DrawCommand& command) const;
+
+	float toWorldX(float screen_x) const;
+	float toWorldY(float screen_y) const;
+	bool  matches(const ViewTransform& rhs) const;
+
+	float scale = 1.f;
+	float x = 0.f;
+	float y = 0.f;
+};
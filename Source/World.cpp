@@ -0,0 +1,163 @@
+#include "World.h"
+#include "DrawBuffer.h"
+#include "Snapshot.h"
+#include "SpatialGrid.h"
+#include "Fixed.h"
+
+int World::create()
+{
+	int entity = (int)visible.size();
+	if (!free_ids.empty())
+	{
+		entity = free_ids.back();
+		free_ids.pop_back();
+		visible[entity] = 1;
+	}
+	else
+	{
+		visible.push_back(1);
+	}
+	transforms.add(entity);
+	return entity;
+}
+
+void World::destroy(int entity)
+{
+	transforms.remove(entity);
+	velocities.remove(entity);
+	colliders.remove(entity);
+	sprites.remove(entity);
+	materials.remove(entity);
+	healths.remove(entity);
+	visible[entity] = 0;
+	free_ids.push_back(entity);
+}
+
+int World::size() const
+{
+	return (int)visible.size();
+}
+
+void World::setVisible(int entity, bool new_visible)
+{
+	visible[entity] = new_visible ? 1 : 0;
+}
+
+bool World::isVisible(int entity) const
+{
+	return visible[entity] != 0;
+}
+
+int World::hitResponse(int entity) const
+{
+	if (materials.has(entity))
+	{
+		return HIT_BREAK;
+	}
+	return healths.has(entity) ? HIT_KNOCK_OUT : HIT_SOLID;
+}
+
+void World::save(Snapshot& snapshot) const
+{
+	transforms.save(snapshot);
+	velocities.save(snapshot);
+	colliders.save(snapshot);
+	sprites.save(snapshot);
+	materials.save(snapshot);
+	healths.save(snapshot);
+	snapshot.writeVector(visible);
+	snapshot.writeVector(free_ids);
+}
+
+void World::restore(SnapshotReader& reader)
+{
+	transforms.restore(reader);
+	velocities.restore(reader);
+	colliders.restore(reader);
+	sprites.restore(reader);
+	materials.restore(reader);
+	healths.restore(reader);
+	reader.readVector(visible);
+	reader.readVector(free_ids);
+}
+
+/**
+*   @brief   Integrate
+*   @details Steps each body's position with the velocity it had at
+			 the start of the tick, then applies gravity. Bodies with
+			 no speed scale are left for their own flight paths. The
+			 deterministic build does the same sums in fixed point.
+*   @return  void
+*/
+void World::integrate(double dt_sec)
+{
+	// bodies are checked through the const pool, so the pages of
+	// bodies at rest stay shared with any forks of the world
+	const ComponentPool<Velocity>& bodies = velocities;
+	for (int i = 0; i < bodies.size(); i++)
+	{
+		int entity = bodies.entity(i);
+		if (!visible[entity] || bodies[i].speed_scale == 0.f)
+		{
+			continue;
+		}
+		integrateBody(transforms.get(entity), velocities[i], dt_sec);
+	}
+}
+
+void integrateBody(Transform& transform, Velocity& velocity, double dt_sec)
+{
+#ifdef DETERMINISTIC_PHYSICS
+	Fixed step = Fixed::fromFloat((float)dt_sec);
+	Fixed distance = Fixed::fromFloat(velocity.speed_scale) * step;
+	Fixed vel_y = Fixed::fromFloat(velocity.y);
+	transform.x = (Fixed::fromFloat(transform.x) +
+		Fixed::fromFloat(velocity.x) * distance).toFloat();
+	transform.y = (Fixed::fromFloat(transform.y) + vel_y * distance).toFloat();
+	velocity.y = (vel_y + Fixed::fromFloat(velocity.gravity) * step).toFloat();
+#else
+	transform.x = (float)(transform.x + velocity.x * velocity.speed_scale * dt_sec);
+	transform.y = (float)(transform.y + velocity.y * velocity.speed_scale * dt_sec);
+	velocity.y = (float)(velocity.y + velocity.gravity * dt_sec);
+#endif
+}
+
+void World::collide(SpatialGrid& grid, LevelVector<rect>& bounds,
+	LevelVector<int>& entities) const
+{
+	bounds.clear();
+	entities.clear();
+	grid.clear();
+	for (int i = 0; i < colliders.size(); i++)
+	{
+		int entity = colliders.entity(i);
+		if (!visible[entity])
+		{
+			continue;
+		}
+
+		const Transform& transform = transforms.get(entity);
+		rect box;
+		box.x = transform.x;
+		box.y = transform.y;
+		box.length = transform.width;
+		box.height = transform.height;
+		bounds.push_back(box);
+		entities.push_back(entity);
+		grid.insert(box);
+	}
+}
+
+void World::render(DrawBuffer& buffer, bool fixed) const
+{
+	for (int i = 0; i < sprites.size(); i++)
+	{
+		int entity = sprites.entity(i);
+		const Sprite& sprite = sprites[i];
+		if (!visible[entity] || sprite.fixed != fixed)
+		{
+			continue;
+		}
+		buffer.sprite(transforms.get(entity), sprite, sprite.layer);
+	}
+}
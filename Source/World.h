@@ -0,0 +1,123 @@
+#pragma once
+#include "ComponentPool.h"
+#include "Components.h"
+#include "LevelArena.h"
+#include "Rect.h"
+
+class DrawBuffer;
+class Snapshot;
+class SnapshotReader;
+class SpatialGrid;
+
+/**
+*  Owns every entity in the simulation and the components they are
+*  built from. An entity is only an id, and each kind of component is
+*  kept packed in its own pool, so new kinds of object are made by
+*  combining components rather than adding arrays. The systems walk
+*  one pool each and skip entities that are out of play.
+*  Copying a world forks it. The copy shares every component page
+*  with the original until one of them writes to it, so level data
+*  that never changes is held once however many forks there are.
+*  @see ComponentPool
+*/
+class World
+{
+public:
+	/**
+	*  Default constructor.
+	*/
+	World() = default;
+
+	/**
+	*  Creates an entity with a transform, in play.
+	*  Ids of destroyed entities are handed out again before new ones.
+	*  @return the id of the entity
+	*/
+	int  create();
+
+	/**
+	*  Takes every component from an entity and frees its id.
+	*  Components are stored inline in their pools, so nothing is
+	*  released back to the heap.
+	*  @param [in] entity The entity to destroy
+	*/
+	void destroy(int entity);
+
+	/**
+	*  @return the number of ids in use or waiting to be reused
+	*/
+	int  size() const;
+
+	/**
+	*  Takes an entity in or out of play. Entities out of play keep
+	*  their components but are not moved, hit or drawn.
+	*/
+	void setVisible(int entity, bool visible);
+	bool isVisible(int entity) const;
+
+	/**
+	*  Finds what a hit on a collider does from the components it is
+	*  built from, so a new kind of object needs no new case.
+	*  @param [in] entity The entity that was hit
+	*  @return HIT_BREAK if it has a material, HIT_KNOCK_OUT if it only
+	*  has health, otherwise HIT_SOLID
+	*/
+	int  hitResponse(int entity) const;
+
+	/**
+	*  Integrate system. Moves every body in play by its velocity.
+	*  @param [in] dt_sec The length of the tick in seconds
+	*/
+	void integrate(double dt_sec);
+
+	/**
+	*  Collide system. Rebuilds the broadphase from every collider in
+	*  play. Entries are inserted into the grid in the order they are
+	*  written to the arrays, so grid ids index both arrays.
+	*  @param [in] grid The grid to rebuild
+	*  @param [out] bounds The bounds of each entry
+	*  @param [out] entities The entity of each entry
+	*/
+	void collide(SpatialGrid& grid, LevelVector<rect>& bounds,
+		LevelVector<int>& entities) const;
+
+	/**
+	*  Render system. Records every sprite in play into a buffer.
+	*  @param [in] buffer The buffer to record into
+	*  @param [in] fixed Whether to record the fixed or moving sprites
+	*/
+	void render(DrawBuffer& buffer, bool fixed) const;
+
+	/**
+	*  Appends every entity and component to a snapshot.
+	*  @param [in] snapshot The snapshot to write to
+	*/
+	void save(Snapshot& snapshot) const;
+
+	/**
+	*  Replaces every entity and component with the next ones in a
+	*  snapshot. Entity ids mean the same as when it was taken.
+	*  @param [in] reader The snapshot being read
+	*/
+	void restore(SnapshotReader& reader);
+
+	ComponentPool<Transform> transforms;
+	ComponentPool<Velocity> velocities;
+	ComponentPool<Collider> colliders;
+	ComponentPool<Sprite, MEMORY_SPRITES> sprites;
+	ComponentPool<Material> materials;
+	ComponentPool<Health> healths;
+
+private:
+	TaggedVector<char, MEMORY_PHYSICS> visible;
+	TaggedVector<int, MEMORY_PHYSICS> free_ids;
+};
+
+/**
+*  Moves one body by its velocity and applies its gravity. The step
+*  World::integrate takes for each entity, for bodies kept elsewhere.
+*  @param [in,out] transform Where the body is
+*  @param [in,out] velocity How fast it moves
+*  @param [in] dt_sec The length of the tick in seconds
+*/
+void integrateBody(Transform& transform, Velocity& velocity, double dt_sec);
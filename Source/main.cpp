@@ -1,13 +1,56 @@
 #define WIN32_LEAN_AND_MEAN
 #include <Windows.h>
 #include <Engine/Platform.h>
+#include <cstring>
+#include <fstream>
+#include "ForecastCheck.h"
 #include "Game.h"
+#include "JobBenchmark.h"
+#include "MemoryTracker.h"
+#include "PhysicsCheck.h"
+#include "RaycastCheck.h"
+#include "VectorBenchmark.h"
 
 int WINAPI WinMain(
 	HINSTANCE hInstance, 
 	HINSTANCE hPrevInstance, 
 	PSTR pScmdline, int iCmdshow)
 {
+	if (pScmdline != nullptr && strstr(pScmdline, "--benchmark-jobs") != nullptr)
+	{
+		std::ofstream results("Job_benchmark.txt");
+		benchmarkJobs(results);
+		return 0;
+	}
+	if (pScmdline != nullptr && strstr(pScmdline, "--check-physics") != nullptr)
+	{
+		std::ofstream results("Physics_check.txt");
+		return checkPhysics(results) ? 0 : 1;
+	}
+	if (pScmdline != nullptr && strstr(pScmdline, "--benchmark-vectors") != nullptr)
+	{
+		std::ofstream results("Vector_benchmark.txt");
+		return benchmarkVectors(results) ? 0 : 1;
+	}
+	if (pScmdline != nullptr && strstr(pScmdline, "--check-forecast") != nullptr)
+	{
+		std::ofstream results("Forecast_check.txt");
+		return checkForecast(results) ? 0 : 1;
+	}
+	if (pScmdline != nullptr && strstr(pScmdline, "--check-raycast") != nullptr)
+	{
+		std::ofstream results("Raycast_check.txt");
+		return checkRaycast(results) ? 0 : 1;
+	}
+	if (pScmdline != nullptr && strstr(pScmdline, "--check-snapshot") != nullptr)
+	{
+		std::ofstream results("Snapshot_check.txt");
+		AngryBirdsGame* game = new AngryBirdsGame;
+		bool passed = game->init() && game->checkSnapshot(results);
+		delete game;
+		return passed ? 0 : 1;
+	}
+
 	AngryBirdsGame* game = new AngryBirdsGame;
 	if (game->init())
 	{
@@ -16,4 +59,9 @@ int WINAPI WinMain(
 
 	delete game;
 	game = nullptr;
-}
\ No newline at end of file
+
+	// written once everything is freed, so bytes still held are leaks
+	std::ofstream report("Memory_report.txt");
+	writeMemoryReport(report);
+	return memoryWithinBudget() ? 0 : 1;
+}
@@ -0,0 +1,155 @@
+#include <limits.h>
+#include <stddef.h>
+#include "MaxRectsPacker.h"
+
+namespace
+{
+	bool contains(const PackedRect& outer, const PackedRect& inner)
+	{
+		return inner.x >= outer.x && inner.y >= outer.y &&
+			inner.x + inner.width <= outer.x + outer.width &&
+			inner.y + inner.height <= outer.y + outer.height;
+	}
+}
+
+MaxRectsPacker::MaxRectsPacker(int width, int height)
+	: page_width(width), page_height(height)
+{
+	PackedRect page;
+	page.width = width;
+	page.height = height;
+	free_rects.push_back(page);
+}
+
+/**
+*   @brief   Insert
+*   @details Scores every free rectangle with the best short side fit
+			 heuristic, breaking ties on the long side.
+*   @return  bool
+*/
+bool MaxRectsPacker::insert(int width, int height, PackedRect& placed)
+{
+	int best_short = INT_MAX;
+	int best_long = INT_MAX;
+	int best = -1;
+	for (size_t i = 0; i < free_rects.size(); i++)
+	{
+		const PackedRect& free_rect = free_rects[i];
+		if (free_rect.width < width || free_rect.height < height)
+		{
+			continue;
+		}
+
+		int leftover_x = free_rect.width - width;
+		int leftover_y = free_rect.height - height;
+		int short_side = leftover_x < leftover_y ? leftover_x : leftover_y;
+		int long_side = leftover_x < leftover_y ? leftover_y : leftover_x;
+		if (short_side < best_short || (short_side == best_short && long_side < best_long))
+		{
+			best_short = short_side;
+			best_long = long_side;
+			best = (int)i;
+		}
+	}
+	if (best < 0)
+	{
+		return false;
+	}
+
+	placed.x = free_rects[best].x;
+	placed.y = free_rects[best].y;
+	placed.width = width;
+	placed.height = height;
+	split(placed);
+	prune();
+	used_area += (long)width * height;
+	return true;
+}
+
+/**
+*   @brief   Split
+*   @details Replaces every free rectangle the placement overlaps with
+			 up to four maximal rectangles around it.
+*   @return  void
+*/
+void MaxRectsPacker::split(const PackedRect& used)
+{
+	std::vector<PackedRect> pieces;
+	for (size_t i = 0; i < free_rects.size();)
+	{
+		PackedRect free_rect = free_rects[i];
+		if (used.x >= free_rect.x + free_rect.width || used.x + used.width <= free_rect.x ||
+			used.y >= free_rect.y + free_rect.height || used.y + used.height <= free_rect.y)
+		{
+			i++;
+			continue;
+		}
+
+		if (used.x > free_rect.x)
+		{
+			PackedRect left = free_rect;
+			left.width = used.x - free_rect.x;
+			pieces.push_back(left);
+		}
+		if (used.x + used.width < free_rect.x + free_rect.width)
+		{
+			PackedRect right = free_rect;
+			right.x = used.x + used.width;
+			right.width = free_rect.x + free_rect.width - right.x;
+			pieces.push_back(right);
+		}
+		if (used.y > free_rect.y)
+		{
+			PackedRect top = free_rect;
+			top.height = used.y - free_rect.y;
+			pieces.push_back(top);
+		}
+		if (used.y + used.height < free_rect.y + free_rect.height)
+		{
+			PackedRect bottom = free_rect;
+			bottom.y = used.y + used.height;
+			bottom.height = free_rect.y + free_rect.height - bottom.y;
+			pieces.push_back(bottom);
+		}
+
+		free_rects[i] = free_rects.back();
+		free_rects.pop_back();
+	}
+	free_rects.insert(free_rects.end(), pieces.begin(), pieces.end());
+}
+
+/**
+*   @brief   Prune
+*   @details Removes free rectangles that lie inside another one.
+*   @return  void
+*/
+void MaxRectsPacker::prune()
+{
+	for (size_t i = 0; i < free_rects.size(); i++)
+	{
+		for (size_t j = i + 1; j < free_rects.size();)
+		{
+			if (contains(free_rects[j], free_rects[i]))
+			{
+				free_rects[i] = free_rects[j];
+				free_rects[j] = free_rects.back();
+				free_rects.pop_back();
+				j = i + 1;
+			}
+			else if (contains(free_rects[i], free_rects[j]))
+			{
+				free_rects[j] = free_rects.back();
+				free_rects.pop_back();
+			}
+			else
+			{
+				j++;
+			}
+		}
+	}
+}
+
+float MaxRectsPacker::occupancy() const
+{
+	return (float)used_area / ((float)page_width * page_height);
+}
@@ -0,0 +1,56 @@
+#pragma once
+#include <vector>
+
+/**
+*  A rectangle placed inside an atlas page, in pixels.
+*/
+struct PackedRect
+{
+	int x = 0;
+	int y = 0;
+	int width = 0;
+	int height = 0;
+};
+
+/**
+*  Packs rectangles into a fixed size page using the MaxRects
+*  algorithm. The packer keeps a list of maximal free rectangles,
+*  which may overlap each other. Every placement picks the free
+*  rectangle whose shorter leftover side is smallest, then splits
+*  all free rectangles it overlaps and prunes any that end up inside
+*  another. Rectangles are never rotated, as sprites are drawn
+*  straight from their source regions.
+*/
+class MaxRectsPacker
+{
+public:
+	/**
+	*  Creates a packer for an empty page.
+	*  @param [in] width The width of the page
+	*  @param [in] height The height of the page
+	*/
+	MaxRectsPacker(int width, int height);
+
+	/**
+	*  Places a rectangle in the page.
+	*  @param [in] width The width of the rectangle
+	*  @param [in] height The height of the rectangle
+	*  @param [out] placed Where the rectangle was placed
+	*  @return false if the rectangle does not fit
+	*/
+	bool insert(int width, int height, PackedRect& placed);
+
+	/**
+	*  Returns the fraction of the page covered by placed rectangles.
+	*/
+	float occupancy() const;
+
+private:
+	void split(const PackedRect& used);
+	void prune();
+
+	int page_width = 0;
+	int page_height = 0;
+	long used_area = 0;
+	std::vector<PackedRect> free_rects;
+};
@@ -0,0 +1,878 @@
+#include <fstream>
+#include <iterator>
+#include <string.h>
+#include "PngCodec.h"
+
+namespace
+{
+	const unsigned char SIGNATURE[8] = { 137, 80, 78, 71, 13, 10, 26, 10 };
+
+	const short LENGTH_BASE[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17,
+		19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+	const short LENGTH_EXTRA[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+		2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+	const short DIST_BASE[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49,
+		65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097,
+		6145, 8193, 12289, 16385, 24577 };
+	const short DIST_EXTRA[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4,
+		5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+	/**
+	*  Reads a deflate stream, least significant bit first.
+	*/
+	struct BitReader
+	{
+		const unsigned char* data = nullptr;
+		size_t size = 0;
+		size_t pos = 0;
+		unsigned int buffer = 0;
+		int count = 0;
+		bool overrun = false;
+
+		int bits(int need)
+		{
+			unsigned int value = buffer;
+			while (count < need)
+			{
+				if (pos >= size)
+				{
+					overrun = true;
+					return 0;
+				}
+				value |= (unsigned int)data[pos++] << count;
+				count += 8;
+			}
+			buffer = value >> need;
+			count -= need;
+			return (int)(value & ((1u << need) - 1));
+		}
+	};
+
+	/**
+	*  Writes a deflate stream, least significant bit first.
+	*/
+	struct BitWriter
+	{
+		std::vector<unsigned char>& out;
+		unsigned int buffer = 0;
+		int count = 0;
+
+		explicit BitWriter(std::vector<unsigned char>& output) : out(output) {}
+
+		void put(unsigned int value, int bits)
+		{
+			buffer |= value << count;
+			count += bits;
+			while (count >= 8)
+			{
+				out.push_back((unsigned char)(buffer & 0xff));
+				buffer >>= 8;
+				count -= 8;
+			}
+		}
+
+		// Huffman codes are packed starting from their most significant bit
+		void putCode(unsigned int code, int bits)
+		{
+			unsigned int reversed = 0;
+			for (int i = 0; i < bits; i++)
+			{
+				reversed = (reversed << 1) | (code & 1);
+				code >>= 1;
+			}
+			put(reversed, bits);
+		}
+
+		void flush()
+		{
+			if (count > 0)
+			{
+				out.push_back((unsigned char)(buffer & 0xff));
+			}
+			buffer = 0;
+			count = 0;
+		}
+	};
+
+	/**
+	*  Canonical Huffman decoding table: the number of codes of each
+	*  length and the symbols ordered by code.
+	*/
+	struct Huffman
+	{
+		short count[16];
+		short symbol[320];
+	};
+
+	/**
+	*  Builds a decoding table from code lengths.
+	*  Returns zero for a complete code, a positive value for an
+	*  incomplete one and a negative value for an over-subscribed one.
+	*/
+	int build(Huffman& table, const short* lengths, int num_symbols)
+	{
+		memset(table.count, 0, sizeof(table.count));
+		for (int i = 0; i < num_symbols; i++)
+		{
+			table.count[lengths[i]]++;
+		}
+		if (table.count[0] == num_symbols)
+		{
+			return 0;
+		}
+
+		int left = 1;
+		for (int length = 1; length < 16; length++)
+		{
+			left <<= 1;
+			left -= table.count[length];
+			if (left < 0)
+			{
+				return left;
+			}
+		}
+
+		short offsets[16];
+		offsets[1] = 0;
+		for (int length = 1; length < 15; length++)
+		{
+			offsets[length + 1] = offsets[length] + table.count[length];
+		}
+		for (int i = 0; i < num_symbols; i++)
+		{
+			if (lengths[i] != 0)
+			{
+				table.symbol[offsets[lengths[i]]++] = (short)i;
+			}
+		}
+		return left;
+	}
+
+	int decode(BitReader& in, const Huffman& table)
+	{
+		int code = 0;
+		int first = 0;
+		int index = 0;
+		for (int length = 1; length < 16; length++)
+		{
+			code |= in.bits(1);
+			int count = table.count[length];
+			if (code - count < first)
+			{
+				return table.symbol[index + (code - first)];
+			}
+			index += count;
+			first = (first + count) << 1;
+			code <<= 1;
+			if (in.overrun)
+			{
+				return -1;
+			}
+		}
+		return -1;
+	}
+
+	bool inflateCodes(BitReader& in, std::vector<unsigned char>& out,
+		const Huffman& lengths, const Huffman& distances)
+	{
+		while (true)
+		{
+			int symbol = decode(in, lengths);
+			if (symbol < 0)
+			{
+				return false;
+			}
+			if (symbol < 256)
+			{
+				out.push_back((unsigned char)symbol);
+				continue;
+			}
+			if (symbol == 256)
+			{
+				return true;
+			}
+
+			symbol -= 257;
+			if (symbol >= 29)
+			{
+				return false;
+			}
+			int length = LENGTH_BASE[symbol] + in.bits(LENGTH_EXTRA[symbol]);
+			int distance_symbol = decode(in, distances);
+			if (distance_symbol < 0 || distance_symbol >= 30)
+			{
+				return false;
+			}
+			size_t distance = DIST_BASE[distance_symbol] + in.bits(DIST_EXTRA[distance_symbol]);
+			if (in.overrun || distance > out.size())
+			{
+				return false;
+			}
+
+			size_t from = out.size() - distance;
+			for (int i = 0; i < length; i++)
+			{
+				unsigned char value = out[from + i];
+				out.push_back(value);
+			}
+		}
+	}
+
+	bool inflateDynamic(BitReader& in, std::vector<unsigned char>& out)
+	{
+		static const short ORDER[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5,
+			11, 4, 12, 3, 13, 2, 14, 1, 15 };
+		int num_lengths = in.bits(5) + 257;
+		int num_distances = in.bits(5) + 1;
+		int num_codes = in.bits(4) + 4;
+		if (num_lengths > 286 || num_distances > 30)
+		{
+			return false;
+		}
+
+		short lengths[320];
+		for (int i = 0; i < 19; i++)
+		{
+			lengths[ORDER[i]] = (short)(i < num_codes ? in.bits(3) : 0);
+		}
+		Huffman length_table;
+		if (build(length_table, lengths, 19) != 0)
+		{
+			return false;
+		}
+
+		int index = 0;
+		while (index < num_lengths + num_distances)
+		{
+			int symbol = decode(in, length_table);
+			if (symbol < 0)
+			{
+				return false;
+			}
+			if (symbol < 16)
+			{
+				lengths[index++] = (short)symbol;
+				continue;
+			}
+
+			short repeat_length = 0;
+			int repeat = 0;
+			if (symbol == 16)
+			{
+				if (index == 0)
+				{
+					return false;
+				}
+				repeat_length = lengths[index - 1];
+				repeat = 3 + in.bits(2);
+			}
+			else if (symbol == 17)
+			{
+				repeat = 3 + in.bits(3);
+			}
+			else
+			{
+				repeat = 11 + in.bits(7);
+			}
+			if (index + repeat > num_lengths + num_distances)
+			{
+				return false;
+			}
+			while (repeat-- > 0)
+			{
+				lengths[index++] = repeat_length;
+			}
+		}
+		if (lengths[256] == 0)
+		{
+			return false;
+		}
+
+		// a single unused code is the only incomplete code allowed
+		int left = build(length_table, lengths, num_lengths);
+		if (left < 0 || (left > 0 && num_lengths - length_table.count[0] != 1))
+		{
+			return false;
+		}
+		Huffman distance_table;
+		left = build(distance_table, lengths + num_lengths, num_distances);
+		if (left < 0 || (left > 0 && num_distances - distance_table.count[0] != 1))
+		{
+			return false;
+		}
+		return inflateCodes(in, out, length_table, distance_table);
+	}
+
+	bool inflateFixed(BitReader& in, std::vector<unsigned char>& out)
+	{
+		short lengths[320];
+		int symbol = 0;
+		for (; symbol < 144; symbol++)
+		{
+			lengths[symbol] = 8;
+		}
+		for (; symbol < 256; symbol++)
+		{
+			lengths[symbol] = 9;
+		}
+		for (; symbol < 280; symbol++)
+		{
+			lengths[symbol] = 7;
+		}
+		for (; symbol < 288; symbol++)
+		{
+			lengths[symbol] = 8;
+		}
+		Huffman length_table;
+		build(length_table, lengths, 288);
+
+		for (symbol = 0; symbol < 30; symbol++)
+		{
+			lengths[symbol] = 5;
+		}
+		Huffman distance_table;
+		build(distance_table, lengths, 30);
+		return inflateCodes(in, out, length_table, distance_table);
+	}
+
+	/**
+	*  Decompresses a zlib stream.
+	*/
+	bool inflate(const std::vector<unsigned char>& input, std::vector<unsigned char>& output)
+	{
+		if (input.size() < 2 || (input[0] & 0x0f) != 8)
+		{
+			return false;
+		}
+
+		BitReader in;
+		in.data = input.data() + 2;
+		in.size = input.size() - 2;
+		int last = 0;
+		do
+		{
+			last = in.bits(1);
+			int type = in.bits(2);
+			if (type == 0)
+			{
+				// stored blocks start on a byte boundary
+				in.buffer = 0;
+				in.count = 0;
+				if (in.pos + 4 > in.size)
+				{
+					return false;
+				}
+				size_t length = in.data[in.pos] | (in.data[in.pos + 1] << 8);
+				in.pos += 4;
+				if (in.pos + length > in.size)
+				{
+					return false;
+				}
+				output.insert(output.end(), in.data + in.pos, in.data + in.pos + length);
+				in.pos += length;
+			}
+			else if (type == 1)
+			{
+				if (!inflateFixed(in, output))
+				{
+					return false;
+				}
+			}
+			else if (type == 2)
+			{
+				if (!inflateDynamic(in, output))
+				{
+					return false;
+				}
+			}
+			else
+			{
+				return false;
+			}
+		} while (!last && !in.overrun);
+		return !in.overrun;
+	}
+
+	void writeSymbol(BitWriter& out, int symbol)
+	{
+		if (symbol < 144)
+		{
+			out.putCode(0x30 + symbol, 8);
+		}
+		else if (symbol < 256)
+		{
+			out.putCode(0x190 + (symbol - 144), 9);
+		}
+		else if (symbol < 280)
+		{
+			out.putCode(symbol - 256, 7);
+		}
+		else
+		{
+			out.putCode(0xc0 + (symbol - 280), 8);
+		}
+	}
+
+	void writeMatch(BitWriter& out, int length, int distance)
+	{
+		int code = 28;
+		while (LENGTH_BASE[code] > length)
+		{
+			code--;
+		}
+		writeSymbol(out, 257 + code);
+		out.put(length - LENGTH_BASE[code], LENGTH_EXTRA[code]);
+
+		code = 29;
+		while (DIST_BASE[code] > distance)
+		{
+			code--;
+		}
+		out.putCode(code, 5);
+		out.put(distance - DIST_BASE[code], DIST_EXTRA[code]);
+	}
+
+	/**
+	*  Compresses into a zlib stream holding a single fixed Huffman
+	*  block. Matches are found through hash chains of three bytes.
+	*/
+	void deflate(const std::vector<unsigned char>& input, std::vector<unsigned char>& output)
+	{
+		const int WINDOW = 32768;
+		const int HASH_SIZE = 1 << 15;
+		const int MAX_CHAIN = 64;
+		const int MAX_MATCH = 258;
+
+		output.push_back(0x78);
+		output.push_back(0x01);
+		BitWriter out(output);
+		out.put(1, 1);
+		out.put(1, 2);
+
+		int size = (int)input.size();
+		std::vector<int> head(HASH_SIZE, -1);
+		std::vector<int> previous(WINDOW, -1);
+		auto hash = [&input](int i)
+		{
+			return ((input[i] << 10) ^ (input[i + 1] << 5) ^ input[i + 2]) & (HASH_SIZE - 1);
+		};
+		auto insert = [&](int i)
+		{
+			if (i + 2 < size)
+			{
+				int h = hash(i);
+				previous[i & (WINDOW - 1)] = head[h];
+				head[h] = i;
+			}
+		};
+
+		int i = 0;
+		while (i < size)
+		{
+			int best_length = 0;
+			int best_distance = 0;
+			if (i + 2 < size)
+			{
+				int longest = size - i < MAX_MATCH ? size - i : MAX_MATCH;
+				int candidate = head[hash(i)];
+				for (int chain = 0; chain < MAX_CHAIN && candidate >= 0 &&
+					i - candidate <= WINDOW; chain++)
+				{
+					int length = 0;
+					while (length < longest && input[candidate + length] == input[i + length])
+					{
+						length++;
+					}
+					if (length > best_length)
+					{
+						best_length = length;
+						best_distance = i - candidate;
+						if (length == longest)
+						{
+							break;
+						}
+					}
+
+					// stop if the slot was reused by a newer position
+					int next = previous[candidate & (WINDOW - 1)];
+					if (next >= candidate)
+					{
+						break;
+					}
+					candidate = next;
+				}
+			}
+
+			if (best_length >= 3)
+			{
+				writeMatch(out, best_length, best_distance);
+				for (int end = i + best_length; i < end; i++)
+				{
+					insert(i);
+				}
+			}
+			else
+			{
+				writeSymbol(out, input[i]);
+				insert(i);
+				i++;
+			}
+		}
+		writeSymbol(out, 256);
+		out.flush();
+
+		unsigned int a = 1;
+		unsigned int b = 0;
+		for (unsigned char value : input)
+		{
+			a = (a + value) % 65521;
+			b = (b + a) % 65521;
+		}
+		unsigned int adler = (b << 16) | a;
+		for (int shift = 24; shift >= 0; shift -= 8)
+		{
+			output.push_back((unsigned char)(adler >> shift));
+		}
+	}
+
+	unsigned int crc(const unsigned char* data, size_t size, unsigned int value)
+	{
+		static unsigned int table[256];
+		static bool ready = false;
+		if (!ready)
+		{
+			for (unsigned int n = 0; n < 256; n++)
+			{
+				unsigned int c = n;
+				for (int k = 0; k < 8; k++)
+				{
+					c = (c & 1) ? 0xedb88320u ^ (c >> 1) : c >> 1;
+				}
+				table[n] = c;
+			}
+			ready = true;
+		}
+
+		value = ~value;
+		for (size_t i = 0; i < size; i++)
+		{
+			value = table[(value ^ data[i]) & 0xff] ^ (value >> 8);
+		}
+		return ~value;
+	}
+
+	unsigned int readU32(const unsigned char* data)
+	{
+		return ((unsigned int)data[0] << 24) | ((unsigned int)data[1] << 16) |
+			((unsigned int)data[2] << 8) | (unsigned int)data[3];
+	}
+
+	void appendU32(std::vector<unsigned char>& data, unsigned int value)
+	{
+		for (int shift = 24; shift >= 0; shift -= 8)
+		{
+			data.push_back((unsigned char)(value >> shift));
+		}
+	}
+
+	void writeChunk(std::ofstream& file, const char* type, const std::vector<unsigned char>& data)
+	{
+		std::vector<unsigned char> chunk;
+		appendU32(chunk, (unsigned int)data.size());
+		chunk.insert(chunk.end(), type, type + 4);
+		chunk.insert(chunk.end(), data.begin(), data.end());
+		appendU32(chunk, crc(chunk.data() + 4, chunk.size() - 4, 0));
+		file.write((const char*)chunk.data(), chunk.size());
+	}
+
+	int paeth(int a, int b, int c)
+	{
+		int p = a + b - c;
+		int pa = p > a ? p - a : a - p;
+		int pb = p > b ? p - b : b - p;
+		int pc = p > c ? p - c : c - p;
+		if (pa <= pb && pa <= pc)
+		{
+			return a;
+		}
+		return pb <= pc ? b : c;
+	}
+
+	/**
+	*  Reverses the per row filters, leaving tightly packed pixels.
+	*/
+	bool unfilter(std::vector<unsigned char>& data, int width, int height, int channels)
+	{
+		size_t stride = (size_t)width * channels;
+		if (data.size() < (stride + 1) * height)
+		{
+			return false;
+		}
+
+		std::vector<unsigned char> pixels(stride * height);
+		for (int y = 0; y < height; y++)
+		{
+			int filter = data[y * (stride + 1)];
+			const unsigned char* row = &data[y * (stride + 1) + 1];
+			unsigned char* current = &pixels[y * stride];
+			const unsigned char* above = y > 0 ? &pixels[(y - 1) * stride] : nullptr;
+			for (size_t x = 0; x < stride; x++)
+			{
+				int a = x >= (size_t)channels ? current[x - channels] : 0;
+				int b = above ? above[x] : 0;
+				int c = (above && x >= (size_t)channels) ? above[x - channels] : 0;
+				int predictor = 0;
+				switch (filter)
+				{
+				case 0: predictor = 0; break;
+				case 1: predictor = a; break;
+				case 2: predictor = b; break;
+				case 3: predictor = (a + b) / 2; break;
+				case 4: predictor = paeth(a, b, c); break;
+				default: return false;
+				}
+				current[x] = (unsigned char)(row[x] + predictor);
+			}
+		}
+		data.swap(pixels);
+		return true;
+	}
+}
+
+/**
+*   @brief   Load
+*   @details Walks the chunks, inflates the joined IDAT data, reverses
+			 the filters and expands every pixel to RGBA.
+*   @return  bool
+*/
+bool PngCodec::load(const std::string& file_name, Image& image, std::string& error)
+{
+	std::ifstream file(file_name, std::ios::binary);
+	if (!file)
+	{
+		error = "could not open file";
+		return false;
+	}
+	std::vector<unsigned char> bytes((std::istreambuf_iterator<char>(file)),
+		std::istreambuf_iterator<char>());
+	if (bytes.size() < 8 || memcmp(bytes.data(), SIGNATURE, 8) != 0)
+	{
+		error = "not a PNG file";
+		return false;
+	}
+
+	int width = 0;
+	int height = 0;
+	int depth = 0;
+	int colour_type = 0;
+	int interlace = 0;
+	unsigned char palette[256 * 4];
+	memset(palette, 255, sizeof(palette));
+	bool has_key = false;
+	unsigned char key[3] = { 0, 0, 0 };
+	std::vector<unsigned char> compressed;
+
+	size_t pos = 8;
+	while (pos + 12 <= bytes.size())
+	{
+		size_t length = readU32(&bytes[pos]);
+		const char* type = (const char*)&bytes[pos + 4];
+		const unsigned char* data = &bytes[pos + 8];
+		if (pos + 12 + length > bytes.size())
+		{
+			error = "truncated chunk";
+			return false;
+		}
+
+		if (memcmp(type, "IHDR", 4) == 0 && length >= 13)
+		{
+			width = (int)readU32(data);
+			height = (int)readU32(data + 4);
+			depth = data[8];
+			colour_type = data[9];
+			interlace = data[12];
+		}
+		else if (memcmp(type, "PLTE", 4) == 0)
+		{
+			for (size_t i = 0; i < length / 3 && i < 256; i++)
+			{
+				palette[i * 4] = data[i * 3];
+				palette[i * 4 + 1] = data[i * 3 + 1];
+				palette[i * 4 + 2] = data[i * 3 + 2];
+			}
+		}
+		else if (memcmp(type, "tRNS", 4) == 0)
+		{
+			if (colour_type == 3)
+			{
+				for (size_t i = 0; i < length && i < 256; i++)
+				{
+					palette[i * 4 + 3] = data[i];
+				}
+			}
+			else if (colour_type == 0 && length >= 2)
+			{
+				has_key = true;
+				key[0] = key[1] = key[2] = data[1];
+			}
+			else if (colour_type == 2 && length >= 6)
+			{
+				has_key = true;
+				key[0] = data[1];
+				key[1] = data[3];
+				key[2] = data[5];
+			}
+		}
+		else if (memcmp(type, "IDAT", 4) == 0)
+		{
+			compressed.insert(compressed.end(), data, data + length);
+		}
+		else if (memcmp(type, "IEND", 4) == 0)
+		{
+			break;
+		}
+		pos += 12 + length;
+	}
+
+	if (width <= 0 || height <= 0)
+	{
+		error = "missing image header";
+		return false;
+	}
+	if (depth != 8)
+	{
+		error = "only 8 bit images are supported";
+		return false;
+	}
+	if (interlace != 0)
+	{
+		error = "interlaced images are not supported";
+		return false;
+	}
+
+	int channels = 0;
+	switch (colour_type)
+	{
+	case 0: channels = 1; break;
+	case 2: channels = 3; break;
+	case 3: channels = 1; break;
+	case 4: channels = 2; break;
+	case 6: channels = 4; break;
+	default:
+		error = "unknown colour type";
+		return false;
+	}
+
+	std::vector<unsigned char> data;
+	if (!inflate(compressed, data) || !unfilter(data, width, height, channels))
+	{
+		error = "corrupt image data";
+		return false;
+	}
+
+	image.width = width;
+	image.height = height;
+	image.pixels.resize((size_t)width * height * 4);
+	for (size_t i = 0; i < (size_t)width * height; i++)
+	{
+		const unsigned char* in = &data[i * channels];
+		unsigned char* out = &image.pixels[i * 4];
+		switch (colour_type)
+		{
+		case 0:
+			out[0] = out[1] = out[2] = in[0];
+			out[3] = (has_key && in[0] == key[0]) ? 0 : 255;
+			break;
+		case 2:
+			out[0] = in[0];
+			out[1] = in[1];
+			out[2] = in[2];
+			out[3] = (has_key && in[0] == key[0] && in[1] == key[1] && in[2] == key[2]) ? 0 : 255;
+			break;
+		case 3:
+			memcpy(out, &palette[in[0] * 4], 4);
+			break;
+		case 4:
+			out[0] = out[1] = out[2] = in[0];
+			out[3] = in[1];
+			break;
+		default:
+			memcpy(out, in, 4);
+			break;
+		}
+	}
+	return true;
+}
+
+/**
+*   @brief   Save
+*   @details Filters each row with whichever filter gives the smallest
+			 sum of absolute differences, then compresses the result.
+*   @return  bool
+*/
+bool PngCodec::save(const std::string& file_name, const Image& image)
+{
+	size_t stride = (size_t)image.width * 4;
+	std::vector<unsigned char> filtered;
+	filtered.reserve((stride + 1) * image.height);
+	std::vector<unsigned char> candidate(stride);
+	std::vector<unsigned char> best(stride);
+	for (int y = 0; y < image.height; y++)
+	{
+		const unsigned char* row = &image.pixels[y * stride];
+		const unsigned char* above = y > 0 ? row - stride : nullptr;
+		long best_cost = -1;
+		int best_filter = 0;
+		for (int filter = 0; filter < 5; filter++)
+		{
+			long cost = 0;
+			for (size_t x = 0; x < stride; x++)
+			{
+				int a = x >= 4 ? row[x - 4] : 0;
+				int b = above ? above[x] : 0;
+				int c = (above && x >= 4) ? above[x - 4] : 0;
+				int predictor = 0;
+				switch (filter)
+				{
+				case 1: predictor = a; break;
+				case 2: predictor = b; break;
+				case 3: predictor = (a + b) / 2; break;
+				case 4: predictor = paeth(a, b, c); break;
+				}
+				candidate[x] = (unsigned char)(row[x] - predictor);
+				cost += candidate[x] < 128 ? candidate[x] : 256 - candidate[x];
+			}
+			if (best_cost < 0 || cost < best_cost)
+			{
+				best_cost = cost;
+				best_filter = filter;
+				best.swap(candidate);
+			}
+		}
+		filtered.push_back((unsigned char)best_filter);
+		filtered.insert(filtered.end(), best.begin(), best.end());
+	}
+
+	std::vector<unsigned char> compressed;
+	deflate(filtered, compressed);
+
+	std::ofstream file(file_name, std::ios::binary);
+	if (!file)
+	{
+		return false;
+	}
+	file.write((const char*)SIGNATURE, 8);
+
+	std::vector<unsigned char> header;
+	appendU32(header, (unsigned int)image.width);
+	appendU32(header, (unsigned int)image.height);
+	header.push_back(8);
+	header.push_back(6);
+	header.push_back(0);
+	header.push_back(0);
+	header.push_back(0);
+	writeChunk(file, "IHDR", header);
+	writeChunk(file, "IDAT", compressed);
+	writeChunk(file, "IEND", std::vector<unsigned char>());
+	return (bool)file;
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include <string>
+#include <vector>
+
+/**
+*  An 8 bit per channel RGBA image held in memory.
+*  Pixels are stored row by row, top to bottom.
+*/
+struct Image
+{
+	int width = 0;
+	int height = 0;
+	std::vector<unsigned char> pixels;
+};
+
+/**
+*  Minimal PNG reader and writer used by the atlas packer.
+*  Reads non-interlaced 8 bit greyscale, greyscale with alpha, RGB,
+*  palette and RGBA images and converts them to RGBA. Always writes
+*  8 bit RGBA, compressed with a small LZ77 encoder that uses the
+*  fixed deflate Huffman codes.
+*/
+class PngCodec
+{
+public:
+	/**
+	*  Loads a PNG file.
+	*  @param [in] file_name The path of the file to load
+	*  @param [out] image The decoded image
+	*  @param [out] error A description of the problem if loading failed
+	*  @return true if the image was loaded
+	*/
+	static bool load(const std::string& file_name, Image& image, std::string& error);
+
+	/**
+	*  Saves an image as a PNG file.
+	*  @param [in] file_name The path of the file to write
+	*  @param [in] image The image to save
+	*  @return true if the file was written
+	*/
+	static bool save(const std::string& file_name, const Image& image);
+};
@@ -0,0 +1,275 @@
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+#include "MaxRectsPacker.h"
+#include "PngCodec.h"
+
+/**
+*  An image read from the manifest and where it ended up.
+*/
+struct Entry
+{
+	std::string path;
+	std::string name;
+	Image image;
+	int page = -1;
+	PackedRect region;
+};
+
+namespace
+{
+	const int DEFAULT_MAX_SIZE = 2048;
+	const int DEFAULT_BORDER = 1;
+
+	std::string fileName(const std::string& path)
+	{
+		size_t slash = path.find_last_of("/\\");
+		return slash == std::string::npos ? path : path.substr(slash + 1);
+	}
+
+	std::string trim(const std::string& line)
+	{
+		size_t first = line.find_first_not_of(" \t\r\n");
+		if (first == std::string::npos)
+		{
+			return std::string();
+		}
+		size_t last = line.find_last_not_of(" \t\r\n");
+		return line.substr(first, last - first + 1);
+	}
+
+	/**
+	*  Reads the image paths listed in the manifest. Blank lines and
+	*  lines starting with a hash are skipped.
+	*/
+	bool readManifest(const std::string& file_name, std::vector<Entry>& entries)
+	{
+		std::ifstream file(file_name);
+		if (!file)
+		{
+			std::cerr << "could not open manifest " << file_name << std::endl;
+			return false;
+		}
+
+		std::string line;
+		while (std::getline(file, line))
+		{
+			line = trim(line);
+			if (line.empty() || line[0] == '#')
+			{
+				continue;
+			}
+
+			Entry entry;
+			entry.path = line;
+			entry.name = fileName(line);
+			for (const Entry& existing : entries)
+			{
+				if (existing.name == entry.name)
+				{
+					std::cerr << "duplicate region name " << entry.name << std::endl;
+					return false;
+				}
+			}
+			entries.push_back(entry);
+		}
+		return true;
+	}
+
+	/**
+	*  Tries to fit every entry not yet placed into a single page,
+	*  leaving a border around each one. Returns the number placed.
+	*/
+	int packPage(std::vector<Entry>& entries, int page, int width, int height, int border)
+	{
+		MaxRectsPacker packer(width, height);
+		int placed = 0;
+		for (Entry& entry : entries)
+		{
+			if (entry.page >= 0)
+			{
+				continue;
+			}
+
+			PackedRect rect;
+			if (packer.insert(entry.image.width + border * 2,
+				entry.image.height + border * 2, rect))
+			{
+				entry.page = page;
+				entry.region.x = rect.x + border;
+				entry.region.y = rect.y + border;
+				entry.region.width = entry.image.width;
+				entry.region.height = entry.image.height;
+				placed++;
+			}
+		}
+		return placed;
+	}
+
+	/**
+	*  Copies an image into the page and repeats its outer pixels into
+	*  the border, so filtering at the edge of a region never samples
+	*  a neighbouring image.
+	*/
+	void blit(Image& page, const Entry& entry, int border)
+	{
+		const Image& image = entry.image;
+		for (int y = -border; y < image.height + border; y++)
+		{
+			int source_y = y < 0 ? 0 : (y >= image.height ? image.height - 1 : y);
+			for (int x = -border; x < image.width + border; x++)
+			{
+				int source_x = x < 0 ? 0 : (x >= image.width ? image.width - 1 : x);
+				const unsigned char* in = &image.pixels[(source_y * image.width + source_x) * 4];
+				unsigned char* out = &page.pixels[((entry.region.y + y) * page.width +
+					entry.region.x + x) * 4];
+				std::copy(in, in + 4, out);
+			}
+		}
+	}
+
+	std::string pageName(const std::string& output, int page)
+	{
+		return page == 0 ? output : output + std::to_string(page);
+	}
+}
+
+/**
+*  Packs the images listed in a manifest into one or more atlas pages.
+*  Writes <output>.png, <output>1.png and so on for each page, and an
+*  index at <output>.xml in the Kenney TextureAtlas format. Regions are
+*  named after the file name of the image they came from.
+*/
+int main(int argc, char* argv[])
+{
+	if (argc < 3)
+	{
+		std::cerr << "usage: AtlasPacker <manifest> <output> [max size] [border]" << std::endl;
+		return 1;
+	}
+	std::string output = argv[2];
+	int max_size = argc > 3 ? atoi(argv[3]) : DEFAULT_MAX_SIZE;
+	int border = argc > 4 ? atoi(argv[4]) : DEFAULT_BORDER;
+
+	std::vector<Entry> entries;
+	if (!readManifest(argv[1], entries))
+	{
+		return 1;
+	}
+	for (Entry& entry : entries)
+	{
+		std::string error;
+		if (!PngCodec::load(entry.path, entry.image, error))
+		{
+			std::cerr << entry.path << ": " << error << std::endl;
+			return 1;
+		}
+		if (entry.image.width + border * 2 > max_size ||
+			entry.image.height + border * 2 > max_size)
+		{
+			std::cerr << entry.path << ": larger than the maximum page size" << std::endl;
+			return 1;
+		}
+	}
+
+	// large images first, as they are the hardest to fit
+	std::stable_sort(entries.begin(), entries.end(), [](const Entry& lhs, const Entry& rhs)
+	{
+		int lhs_side = std::max(lhs.image.width, lhs.image.height);
+		int rhs_side = std::max(rhs.image.width, rhs.image.height);
+		if (lhs_side != rhs_side)
+		{
+			return lhs_side > rhs_side;
+		}
+		return lhs.image.width * lhs.image.height > rhs.image.width * rhs.image.height;
+	});
+
+	// each page takes the smallest power of two size that holds what is left,
+	// otherwise it is filled at the maximum size and the rest spill over
+	std::vector<Image> pages;
+	size_t remaining = entries.size();
+	while (remaining > 0)
+	{
+		int page = (int)pages.size();
+		int width = 0;
+		int height = 0;
+		for (int size = 64; size <= max_size && width == 0; size *= 2)
+		{
+			int sizes[2][2] = { { size, size / 2 }, { size, size } };
+			for (auto& candidate : sizes)
+			{
+				std::vector<Entry> trial = entries;
+				if (packPage(trial, page, candidate[0], candidate[1], border) == (int)remaining)
+				{
+					width = candidate[0];
+					height = candidate[1];
+					break;
+				}
+			}
+		}
+		if (width == 0)
+		{
+			width = max_size;
+			height = max_size;
+		}
+
+		int placed = packPage(entries, page, width, height, border);
+		if (placed == 0)
+		{
+			std::cerr << "could not place any image on page " << page << std::endl;
+			return 1;
+		}
+		remaining -= placed;
+
+		Image image;
+		image.width = width;
+		image.height = height;
+		image.pixels.assign((size_t)width * height * 4, 0);
+		pages.push_back(image);
+	}
+
+	for (const Entry& entry : entries)
+	{
+		blit(pages[entry.page], entry, border);
+	}
+
+	for (size_t i = 0; i < pages.size(); i++)
+	{
+		std::string file_name = pageName(output, (int)i) + ".png";
+		if (!PngCodec::save(file_name, pages[i]))
+		{
+			std::cerr << "could not write " << file_name << std::endl;
+			return 1;
+		}
+		std::cout << file_name << " " << pages[i].width << "x" << pages[i].height << std::endl;
+	}
+
+	std::ofstream index(output + ".xml");
+	if (!index)
+	{
+		std::cerr << "could not write " << output << ".xml" << std::endl;
+		return 1;
+	}
+	index << "<TextureAtlases>\n";
+	for (size_t i = 0; i < pages.size(); i++)
+	{
+		index << "\t<TextureAtlas imagePath=\"" << fileName(pageName(output, (int)i)) << ".png\">\n";
+		for (const Entry& entry : entries)
+		{
+			if (entry.page == (int)i)
+			{
+				index << "\t\t<SubTexture name=\"" << entry.name <<
+					"\" x=\"" << entry.region.x << "\" y=\"" << entry.region.y <<
+					"\" width=\"" << entry.region.width <<
+					"\" height=\"" << entry.region.height << "\"/>\n";
+			}
+		}
+		index << "\t</TextureAtlas>\n";
+	}
+	index << "</TextureAtlases>\n";
+	std::cout << entries.size() << " images packed into " << pages.size() << " page(s)" << std::endl;
+	return 0;
+}
@@ -0,0 +1,344 @@
+#include <chrono>
+#include <iostream>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include "Components.h"
+#include "DrawBuffer.h"
+#include "PngCodec.h"
+#include "Random.h"
+#include "SoftwareBackend.h"
+#include "TextureAtlas.h"
+
+namespace
+{
+	const int FRAME_WIDTH = 1280;
+	const int FRAME_HEIGHT = 720;
+	const int TIMED_FRAMES = 60;
+	const int SCENE_SEED = 1;
+	const int NUM_TOWERS = 4;
+	const int NUM_DEBRIS = 24;
+
+	// a channel may be off by this much before the pixel counts as changed,
+	// and this many pixels in ten thousand may change, so rounding differences
+	// between compilers at the edges of rotated quads do not fail the check
+	const int MAX_CHANNEL_ERROR = 2;
+	const int MAX_CHANGED_PER_TEN_THOUSAND = 1;
+
+	enum { TEXTURE_ATLAS, TEXTURE_BACKGROUND };
+
+	using Clock = std::chrono::high_resolution_clock;
+
+	const std::string ROOT = RENDER_CHECK_ROOT;
+	const std::string GOLDEN_FILE = ROOT + "/Tools/RenderCheck/golden_frame.png";
+	const std::string OUTPUT_FILE = "render_frame.png";
+
+	/**
+	*  Builds the sprite drawing a named atlas region.
+	*/
+	bool regionSprite(const TextureAtlas& atlas, const char* name, Sprite& sprite)
+	{
+		const AtlasRegion* region = atlas.find(name);
+		if (region == nullptr)
+		{
+			std::cerr << "the atlas has no region " << name << std::endl;
+			return false;
+		}
+		sprite.texture = TEXTURE_ATLAS;
+		sprite.source[0] = region->x;
+		sprite.source[1] = region->y;
+		sprite.source[2] = region->width;
+		sprite.source[3] = region->height;
+		return true;
+	}
+
+	float between(Random& random, float lo, float hi)
+	{
+		return lo + (hi - lo) * (random.below(1 << 16) / 65536.f);
+	}
+
+	/**
+	*  Records a level the way the game lays one out: the background and
+	*  platforms on the static layer, then towers of blocks with pigs on
+	*  top, birds by the slingshot, falling debris and the score.
+	*/
+	bool recordScene(const TextureAtlas& atlas, const Image& background,
+		DrawBuffer& static_layer, DrawBuffer& frame)
+	{
+		const char* blocks[] = { "elementGlass012.png", "elementWood010.png",
+			"elementStone004.png", "elementExplosive011.png" };
+		const char* birds[] = { "chick.png", "duck.png", "owl.png", "parrot.png", "penguin.png" };
+		Random random(SCENE_SEED);
+
+		static_layer.begin();
+		Transform transform;
+		transform.width = WORLD_WIDTH;
+		transform.height = WORLD_HEIGHT;
+		Sprite sprite;
+		sprite.texture = TEXTURE_BACKGROUND;
+		sprite.source[2] = (float)background.width;
+		sprite.source[3] = (float)background.height;
+		static_layer.sprite(transform, sprite, LAYER_BACKGROUND);
+
+		if (!regionSprite(atlas, "dirt.png", sprite))
+		{
+			return false;
+		}
+		transform.width = WORLD_WIDTH * 0.08f;
+		transform.height = WORLD_HEIGHT * 0.04f;
+		transform.y = WORLD_HEIGHT * 0.85f;
+		for (int i = 0; i < NUM_TOWERS * 2; ++i)
+		{
+			transform.x = WORLD_WIDTH * 0.45f + i * transform.width;
+			static_layer.sprite(transform, sprite, LAYER_LEVEL);
+		}
+		static_layer.sort();
+
+		float clear[3] = { 0.f, 0.f, 0.f };
+		frame.begin();
+		frame.clearColour(clear);
+		frame.setStaticLayer(&static_layer);
+
+		Transform block;
+		block.width = WORLD_WIDTH * 0.03f;
+		block.height = WORLD_HEIGHT * 0.05f;
+		for (int tower = 0; tower < NUM_TOWERS; ++tower)
+		{
+			int height = 3 + random.below(4);
+			block.x = WORLD_WIDTH * (0.47f + tower * 0.12f);
+			for (int row = 0; row < height; ++row)
+			{
+				if (!regionSprite(atlas, blocks[random.below(4)], sprite))
+				{
+					return false;
+				}
+				block.y = WORLD_HEIGHT * 0.85f - (row + 1) * block.height;
+				frame.sprite(block, sprite, LAYER_LEVEL);
+			}
+			if (!regionSprite(atlas, "pig.png", sprite))
+			{
+				return false;
+			}
+			Transform pig = block;
+			pig.y -= block.height * 1.2f;
+			pig.height = block.height * 1.2f;
+			frame.sprite(pig, sprite, LAYER_ENEMIES);
+		}
+
+		// debris is rotated, translucent and drawn from part of a region
+		for (int i = 0; i < NUM_DEBRIS; ++i)
+		{
+			if (!regionSprite(atlas, blocks[i % 4], sprite))
+			{
+				return false;
+			}
+			sprite.source[2] *= 0.5f;
+			sprite.source[3] *= 0.5f;
+			sprite.opacity = between(random, 0.3f, 1.f);
+			Transform piece;
+			piece.x = between(random, WORLD_WIDTH * 0.4f, WORLD_WIDTH * 0.9f);
+			piece.y = between(random, WORLD_HEIGHT * 0.2f, WORLD_HEIGHT * 0.7f);
+			piece.width = block.width * 0.5f;
+			piece.height = block.height * 0.5f;
+			piece.rotation = between(random, 0.f, 6.2832f);
+			frame.sprite(piece, sprite, LAYER_DEBRIS);
+		}
+
+		if (!regionSprite(atlas, "Slingshot.png", sprite))
+		{
+			return false;
+		}
+		Transform slingshot;
+		slingshot.x = WORLD_WIDTH * 0.15f;
+		slingshot.y = WORLD_HEIGHT * 0.6f;
+		slingshot.width = WORLD_WIDTH * 0.04f;
+		slingshot.height = WORLD_HEIGHT * 0.25f;
+		frame.sprite(slingshot, sprite, LAYER_SLINGSHOT);
+
+		Transform bird;
+		bird.width = WORLD_WIDTH * 0.025f;
+		bird.height = bird.width;
+		bird.y = WORLD_HEIGHT * 0.85f - bird.height;
+		for (int i = 0; i < 5; ++i)
+		{
+			if (!regionSprite(atlas, birds[i], sprite))
+			{
+				return false;
+			}
+			bird.x = WORLD_WIDTH * 0.02f + i * bird.width * 1.1f;
+			frame.sprite(bird, sprite, LAYER_PROJECTILES);
+		}
+
+		// tinted, so the text and tint paths are both drawn
+		if (!regionSprite(atlas, "pig.png", sprite))
+		{
+			return false;
+		}
+		sprite.colour[1] = 0.5f;
+		sprite.colour[2] = 0.5f;
+		Transform counter;
+		counter.x = WORLD_WIDTH * 0.02f;
+		counter.y = WORLD_HEIGHT * 0.03f;
+		counter.width = WORLD_WIDTH * 0.03f;
+		counter.height = counter.width;
+		frame.sprite(counter, sprite, LAYER_TEXT);
+
+		const float orange[3] = { 1.f, 0.55f, 0.f };
+		TextLayout label;
+		label.set("Score: ");
+		frame.text(label, WORLD_WIDTH * 0.60f, WORLD_HEIGHT * 0.088f, WORLD_HEIGHT * 0.002f,
+			orange, LAYER_TEXT);
+		TextLayout score;
+		score.setNumber(12450);
+		frame.text(score, WORLD_WIDTH * 0.73f, WORLD_HEIGHT * 0.088f, WORLD_HEIGHT * 0.002f,
+			orange, LAYER_TEXT);
+		frame.sort();
+		return true;
+	}
+
+	void toImage(const SoftwareBackend& backend, Image& image)
+	{
+		image.width = backend.getWidth();
+		image.height = backend.getHeight();
+		image.pixels.resize((size_t)image.width * image.height * 4);
+		const std::vector<unsigned int>& pixels = backend.getPixels();
+		for (size_t i = 0; i < pixels.size(); ++i)
+		{
+			image.pixels[i * 4] = (unsigned char)(pixels[i] & 0xff);
+			image.pixels[i * 4 + 1] = (unsigned char)((pixels[i] >> 8) & 0xff);
+			image.pixels[i * 4 + 2] = (unsigned char)((pixels[i] >> 16) & 0xff);
+			image.pixels[i * 4 + 3] = 0xff;
+		}
+	}
+
+	/**
+	*  Compares a frame with the golden image.
+	*  @return true if few enough pixels differ by more than the tolerance
+	*/
+	bool compare(const Image& frame, const Image& golden)
+	{
+		if (frame.width != golden.width || frame.height != golden.height)
+		{
+			std::cout << "golden image is " << golden.width << "x" << golden.height
+				<< ", frame is " << frame.width << "x" << frame.height << std::endl;
+			return false;
+		}
+		int changed = 0;
+		int worst = 0;
+		for (size_t i = 0; i < frame.pixels.size(); i += 4)
+		{
+			int error = 0;
+			for (size_t c = 0; c < 4; ++c)
+			{
+				int difference = abs(frame.pixels[i + c] - golden.pixels[i + c]);
+				error = difference > error ? difference : error;
+			}
+			worst = error > worst ? error : worst;
+			changed += error > MAX_CHANNEL_ERROR ? 1 : 0;
+		}
+		int allowed = frame.width * frame.height / 10000 * MAX_CHANGED_PER_TEN_THOUSAND;
+		std::cout << "changed pixels " << changed << " of " << frame.width * frame.height
+			<< " (allowed " << allowed << "), largest channel error " << worst << std::endl;
+		return changed <= allowed;
+	}
+}
+
+/**
+*  Renders a recorded level frame with the software backend, times it
+*  and compares it with a golden image. The frame is written next to
+*  the working directory so a failure can be inspected.
+*  Run with --update-golden to replace the golden image.
+*/
+int main(int argc, char* argv[])
+{
+	bool update_golden = false;
+	bool render_frame = false;
+	for (int i = 1; i < argc; ++i)
+	{
+		update_golden |= strcmp(argv[i], "--update-golden") == 0;
+		render_frame |= strcmp(argv[i], "--render-frame") == 0;
+	}
+	if (!render_frame && !update_golden)
+	{
+		std::cerr << "usage: RenderCheck --render-frame | --update-golden" << std::endl;
+		return 1;
+	}
+
+	TextureAtlas atlas;
+	Image atlas_image;
+	Image background;
+	std::string error;
+	if (!atlas.load(ROOT + "/Resources/Textures/game_atlas.xml") ||
+		!PngCodec::load(ROOT + "/Resources/Textures/game_atlas.png", atlas_image, error) ||
+		!PngCodec::load(ROOT + "/Resources/Textures/lvl1.png", background, error))
+	{
+		std::cerr << "could not load the level textures " << error << std::endl;
+		return 1;
+	}
+
+	SoftwareBackend backend;
+	backend.init(FRAME_WIDTH, FRAME_HEIGHT);
+	backend.setTexture(TEXTURE_ATLAS, atlas_image.width, atlas_image.height,
+		atlas_image.pixels.data());
+	backend.setTexture(TEXTURE_BACKGROUND, background.width, background.height,
+		background.pixels.data());
+	ViewTransform view;
+	view.fit((float)FRAME_WIDTH, (float)FRAME_HEIGHT, WORLD_WIDTH, WORLD_HEIGHT);
+	backend.setView(view);
+
+	DrawBuffer static_layer;
+	DrawBuffer frame;
+	if (!recordScene(atlas, background, static_layer, frame))
+	{
+		return 1;
+	}
+
+	// the first frame also composites the static layer
+	auto start = Clock::now();
+	backend.draw(frame);
+	double first_ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+	start = Clock::now();
+	for (int i = 0; i < TIMED_FRAMES; ++i)
+	{
+		backend.draw(frame);
+	}
+	double frame_ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count() /
+		TIMED_FRAMES;
+
+	std::cout << FRAME_WIDTH << "x" << FRAME_HEIGHT << " frame, "
+		<< frame.getCommands().size() << " commands, "
+		<< static_layer.getCommands().size() << " static" << std::endl;
+	std::cout << "first frame " << first_ms << " ms, then " << frame_ms
+		<< " ms a frame over " << TIMED_FRAMES << std::endl;
+	std::cout << "draw calls " << backend.drawCalls()
+		<< ", static redraws " << backend.staticRedraws() << std::endl;
+
+	Image image;
+	toImage(backend, image);
+	if (!PngCodec::save(OUTPUT_FILE, image))
+	{
+		std::cerr << "could not write " << OUTPUT_FILE << std::endl;
+		return 1;
+	}
+	if (update_golden)
+	{
+		if (!PngCodec::save(GOLDEN_FILE, image))
+		{
+			std::cerr << "could not write " << GOLDEN_FILE << std::endl;
+			return 1;
+		}
+		std::cout << "wrote " << GOLDEN_FILE << std::endl;
+		return 0;
+	}
+
+	Image golden;
+	if (!PngCodec::load(GOLDEN_FILE, golden, error))
+	{
+		std::cerr << GOLDEN_FILE << ": " << error << std::endl;
+		return 1;
+	}
+	bool passed = compare(image, golden) && backend.staticRedraws() == 1;
+	std::cout << (passed ? "PASSED" : "FAILED") << std::endl;
+	return passed ? 0 : 1;
+}